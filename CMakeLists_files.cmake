@@ -48,6 +48,7 @@ list (APPEND MAIN_SOURCE_FILES
       opm/common/utility/numeric/RootFinders.cpp
       opm/material/common/Spline.cpp
       opm/material/common/Tabulated1DFunction.cpp
+      opm/material/common/PiecewiseUniformTabulated2DFunction.cpp
       opm/material/common/TridiagonalMatrix.cpp
       opm/material/common/UniformXTabulated2DFunction.cpp
       opm/material/components/CO2.cpp
@@ -265,6 +266,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/Network/ExtNetwork.cpp
     opm/input/eclipse/Schedule/Network/NetworkKeywordHandlers.cpp
     opm/input/eclipse/Schedule/Network/Node.cpp
+    opm/input/eclipse/Schedule/Network/Topology.cpp
     opm/input/eclipse/Schedule/ResCoup/ReservoirCouplingInfo.cpp
     opm/input/eclipse/Schedule/ResCoup/ReservoirCouplingKeywordHandlers.cpp
     opm/input/eclipse/Schedule/UDQ/UDQKeywordHandlers.cpp
@@ -714,6 +716,7 @@ if(ENABLE_ECL_OUTPUT)
           tests/msim/MSIM_PYACTION_CHANGING_SCHEDULE.DATA
           tests/msim/MSIM_PYACTION_CHANGING_SCHEDULE_ACTIONX_CALLBACK.DATA
           tests/msim/MSIM_PYACTION_INSERT_KEYWORD.DATA
+          tests/msim/MSIM_PYACTION_INSERT_KEYWORD_MULTI_STEP.DATA
           tests/msim/MSIM_PYACTION_INSERT_INVALID_KEYWORD.DATA
           tests/msim/MSIM_PYACTION_NO_RUN_FUNCTION.DATA
           tests/msim/MSIM_PYACTION_OPEN_WELL_AT_PAST_REPORT_STEP.DATA
@@ -728,6 +731,7 @@ if(ENABLE_ECL_OUTPUT)
           tests/msim/action3_actionx_callback.py
           tests/msim/action_count.py
           tests/msim/insert_keyword.py
+          tests/msim/insert_keyword_multi_step.py
           tests/msim/insert_invalid_keyword.py
           tests/msim/action_count_no_run_function.py
           tests/msim/open_well_past.py
@@ -736,6 +740,7 @@ if(ENABLE_ECL_OUTPUT)
 endif()
 
 list (APPEND EXAMPLE_SOURCE_FILES
+      examples/csrgraph_benchmark.cpp
 )
 if(ENABLE_ECL_INPUT)
   list (APPEND TEST_DATA_FILES
@@ -776,6 +781,7 @@ if(ENABLE_ECL_INPUT)
     examples/make_ext_smry.cpp
     examples/co2brinepvt.cpp
     examples/hysteresis.cpp
+    examples/unit_conversion_benchmark.cpp
   )
 endif()
 
@@ -1003,6 +1009,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/common/TridiagonalMatrix.hpp
       opm/material/common/ResetLocale.hpp
       opm/material/common/HasMemberGeneratorMacros.hpp
+      opm/material/common/PiecewiseUniformTabulated2DFunction.hpp
       opm/material/common/UniformTabulated2DFunction.hpp
       opm/material/common/FastSmallVector.hpp
       opm/material/common/ConditionalStorage.hpp
@@ -1297,6 +1304,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/Network/Branch.hpp
        opm/input/eclipse/Schedule/Network/ExtNetwork.hpp
        opm/input/eclipse/Schedule/Network/Node.hpp
+       opm/input/eclipse/Schedule/Network/Topology.hpp
        opm/input/eclipse/Schedule/VFPInjTable.hpp
        opm/input/eclipse/Schedule/VFPProdTable.hpp
        opm/input/eclipse/Schedule/Well/Connection.hpp
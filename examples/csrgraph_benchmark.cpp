@@ -0,0 +1,162 @@
+/*
+  Copyright 2024 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/common/utility/CSRGraphFromCoordinates.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
+namespace {
+
+using Graph = Opm::utility::CSRGraphFromCoordinates<int, true>;
+
+struct Coordinates
+{
+    std::vector<int> rows{};
+    std::vector<int> cols{};
+};
+
+Coordinates randomConnections(const int numVertices, const std::size_t numConns)
+{
+    auto gen = std::mt19937 { 1729 };
+    auto vertex = std::uniform_int_distribution<int> { 0, numVertices - 1 };
+
+    auto coords = Coordinates{};
+    coords.rows.reserve(numConns);
+    coords.cols.reserve(numConns);
+
+    while (coords.rows.size() < numConns) {
+        const auto v1 = vertex(gen);
+        const auto v2 = vertex(gen);
+
+        if (v1 != v2) {
+            coords.rows.push_back(v1);
+            coords.cols.push_back(v2);
+        }
+    }
+
+    return coords;
+}
+
+template <typename Function>
+double secondsPerCall(const int numRepetitions, Function&& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    for (auto rep = 0; rep < numRepetitions; ++rep) {
+        f();
+    }
+
+    const auto elapsed = std::chrono::duration<double> {
+        std::chrono::steady_clock::now() - start
+    };
+
+    return elapsed.count() / numRepetitions;
+}
+
+double timeCompress(const Coordinates& coords, const int numVertices,
+                    const int numRepetitions)
+{
+    auto graph = Graph{};
+
+    return secondsPerCall(numRepetitions, [&]()
+    {
+        graph.clear();
+        graph.addConnections(coords.rows, coords.cols);
+        graph.compress(numVertices);
+    });
+}
+
+double timeRecompress(const Coordinates& coords, const int numVertices,
+                      const int numRepetitions)
+{
+    auto graph = Graph{};
+    graph.addConnections(coords.rows, coords.cols);
+    graph.recompress(numVertices);
+
+    return secondsPerCall(numRepetitions, [&]()
+    {
+        graph.addConnections(coords.rows, coords.cols);
+        graph.recompress(numVertices);
+    });
+}
+
+void setNumThreads([[maybe_unused]] const int numThreads)
+{
+#ifdef _OPENMP
+    omp_set_num_threads(numThreads);
+#endif // _OPENMP
+}
+
+int maxNumThreads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif // _OPENMP
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 4) {
+        std::cerr << "Usage: " << argv[0]
+                  << " [NUM_VERTICES [NUM_CONNECTIONS [NUM_REPETITIONS]]]\n";
+        return EXIT_FAILURE;
+    }
+
+    const auto numVertices    = (argc > 1) ? std::stoi(argv[1]) : 1'000'000;
+    const auto numConns       = (argc > 2) ? std::stoul(argv[2]) : 20'000'000ul;
+    const auto numRepetitions = (argc > 3) ? std::stoi(argv[3]) : 5;
+
+    const auto coords = randomConnections(numVertices, numConns);
+    const auto numThreads = maxNumThreads();
+
+    std::cout << "Vertices: " << numVertices
+              << ", connections: " << numConns
+              << ", repetitions: " << numRepetitions << '\n';
+
+    setNumThreads(1);
+    const auto serial = timeCompress(coords, numVertices, numRepetitions);
+
+    setNumThreads(numThreads);
+    const auto parallel = timeCompress(coords, numVertices, numRepetitions);
+    const auto reuse = timeRecompress(coords, numVertices, numRepetitions);
+
+    std::cout << std::fixed << std::setprecision(4)
+              << "compress(), 1 thread:          " << serial << " s\n"
+              << "compress(), " << std::setw(3) << numThreads << " threads:      "
+              << parallel << " s (speedup " << serial / parallel << ")\n"
+              << "recompress(), reused pattern:  " << reuse << " s (speedup "
+              << serial / reuse << ")\n";
+
+    return EXIT_SUCCESS;
+}
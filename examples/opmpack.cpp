@@ -23,6 +23,7 @@
 #include <getopt.h>
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Deck/DeckOutput.hpp>
 #include <opm/input/eclipse/EclipseState/InitConfig/InitConfig.hpp>
 #include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/I.hpp>
@@ -35,13 +36,17 @@
 
 namespace fs = std::filesystem;
 
-Opm::Deck pack_deck( const char * deck_file, std::ostream& os) {
+Opm::Deck pack_deck( const char * deck_file, std::ostream& os, bool compress_repeats) {
     Opm::ParseContext parseContext(Opm::InputErrorAction::WARN);
     Opm::ErrorGuard errors;
     Opm::Parser parser;
 
     auto deck = parser.parseFile(deck_file, parseContext, errors);
-    os << deck;
+    {
+        Opm::DeckOutput out( os, 10 );
+        out.fmt.compress_repeats = compress_repeats;
+        deck.write( out );
+    }
 
     return deck;
 }
@@ -72,7 +77,10 @@ Print NEW_CASE in cwd:
 
 As an alternative to the -o option you can use -c; that is equivalent to -o -
 but restart and import files referred to in the deck are also copied. The -o and
--c options are mutually exclusive. )";
+-c options are mutually exclusive.
+
+By passing the option -r runs of repeated numeric values are written in
+compressed N*value form, e.g. 1000*0.25. )";
     std::cerr << help_text << std::endl;
     exit(1);
 }
@@ -105,11 +113,12 @@ int main(int argc, char** argv) {
     int arg_offset = 1;
     bool stdout_output = true;
     bool copy_binary = false;
+    bool compress_repeats = false;
     const char * coutput_arg;
 
     while (true) {
         int c;
-        c = getopt(argc, argv, "c:o:");
+        c = getopt(argc, argv, "c:o:r");
         if (c == -1)
             break;
 
@@ -123,6 +132,9 @@ int main(int argc, char** argv) {
             copy_binary = true;
             coutput_arg = optarg;
             break;
+        case 'r':
+            compress_repeats = true;
+            break;
         }
     }
     arg_offset = optind;
@@ -130,7 +142,7 @@ int main(int argc, char** argv) {
         print_help_and_exit();
 
     if (stdout_output)
-        pack_deck(argv[arg_offset], std::cout);
+        pack_deck(argv[arg_offset], std::cout, compress_repeats);
     else {
         std::ofstream os;
         fs::path input_arg(argv[arg_offset]);
@@ -146,7 +158,7 @@ int main(int argc, char** argv) {
         }
 
 
-        const auto& deck = pack_deck(argv[arg_offset], os);
+        const auto& deck = pack_deck(argv[arg_offset], os, compress_repeats);
         if (copy_binary) {
             Opm::InitConfig init_config(deck);
             if (init_config.restartRequested()) {
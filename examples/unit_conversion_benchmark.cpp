@@ -0,0 +1,159 @@
+/*
+  Copyright 2024 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Deck/DeckItem.hpp>
+#include <opm/input/eclipse/Deck/value_status.hpp>
+#include <opm/input/eclipse/Units/Dimension.hpp>
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename Function>
+double secondsPerCall(const int numRepetitions, Function&& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    for (auto rep = 0; rep < numRepetitions; ++rep) {
+        f();
+    }
+
+    const auto elapsed = std::chrono::duration<double> {
+        std::chrono::steady_clock::now() - start
+    };
+
+    return elapsed.count() / numRepetitions;
+}
+
+void report(const std::string& what, const double elementwise, const double bulk)
+{
+    std::cout << std::fixed << std::setprecision(4)
+              << what << ":\n"
+              << "  element-wise: " << elementwise << " s\n"
+              << "  bulk:         " << bulk << " s (speedup "
+              << elementwise / bulk << ")\n";
+}
+
+// Temperature output conversion, affine with non-zero offset.
+void benchmarkUnitSystem(const std::vector<double>& values, const int numRepetitions)
+{
+    constexpr auto temperature = Opm::UnitSystem::measure::temperature;
+
+    const auto usys = Opm::UnitSystem::newFIELD();
+    auto output = std::vector<double>(values.size());
+
+    const auto elementwise = secondsPerCall(numRepetitions, [&]()
+    {
+        for (auto i = 0*values.size(); i < values.size(); ++i) {
+            output[i] = usys.from_si(temperature, values[i]);
+        }
+    });
+
+    const auto bulk = secondsPerCall(numRepetitions, [&]()
+    {
+        usys.from_si(temperature, values.data(), values.size(), output.data());
+    });
+
+    report("UnitSystem::from_si(temperature)", elementwise, bulk);
+}
+
+// Deck item with three values per record, every other value defaulted.
+void benchmarkDeckItem(const std::vector<double>& values, const int numRepetitions)
+{
+    const auto active = std::vector<Opm::Dimension> {
+        Opm::Dimension{ 1.0e5 }, Opm::Dimension{ 1.0, 273.15 }, Opm::Dimension{ 0.3048 }
+    };
+    const auto dflt = std::vector<Opm::Dimension> {
+        Opm::Dimension{ 1.0e3 }, Opm::Dimension{ 1.0, 273.15 }, Opm::Dimension{ 1.0 }
+    };
+
+    auto item = Opm::DeckItem { "ITEM", double{}, active, dflt };
+    for (auto i = 0*values.size(); i < values.size(); ++i) {
+        if (i % 2 == 0) {
+            item.push_back(values[i]);
+        }
+        else {
+            item.push_backDefault(values[i]);
+        }
+    }
+
+    // Copies of the item start without SI values.  Make them up front, so
+    // that each repetition measures a first request.  Both paths write to
+    // newly allocated SI arrays which are kept until the end.
+    auto copies = std::vector<Opm::DeckItem>(2 * numRepetitions, item);
+    auto copy = copies.begin();
+
+    auto siArrays = std::vector<std::vector<double>>{};
+    siArrays.reserve(numRepetitions);
+
+    const auto elementwise = secondsPerCall(numRepetitions, [&]()
+    {
+        const auto& raw = copy->getData<double>();
+        const auto& status = copy->getValueStatus();
+        auto& si = siArrays.emplace_back(raw.size());
+
+        const auto dim_size = active.size();
+        for (auto index = 0*raw.size(); index < raw.size(); ++index) {
+            const auto& dim = Opm::value::defaulted(status[index]) ? dflt : active;
+            si[index] = dim[index % dim_size].convertRawToSi(raw[index]);
+        }
+
+        ++copy;
+    });
+
+    const auto bulk = secondsPerCall(numRepetitions, [&]()
+    {
+        (copy++)->getSIDoubleData();
+    });
+
+    report("DeckItem::getSIDoubleData()", elementwise, bulk);
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 3) {
+        std::cerr << "Usage: " << argv[0] << " [NUM_VALUES [NUM_REPETITIONS]]\n";
+        return EXIT_FAILURE;
+    }
+
+    const auto numValues      = (argc > 1) ? std::stoul(argv[1]) : 2'000'000ul;
+    const auto numRepetitions = (argc > 2) ? std::stoi(argv[2]) : 10;
+
+    auto values = std::vector<double>(numValues);
+    for (auto i = 0*numValues; i < numValues; ++i) {
+        values[i] = 250.0 + 1.0e-5*i;
+    }
+
+    std::cout << "Values: " << numValues
+              << ", repetitions: " << numRepetitions << '\n';
+
+    benchmarkUnitSystem(values, numRepetitions);
+    benchmarkDeckItem(values, numRepetitions);
+
+    return EXIT_SUCCESS;
+}
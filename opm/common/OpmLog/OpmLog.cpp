@@ -21,6 +21,7 @@
 #include <opm/common/OpmLog/Logger.hpp>
 #include <opm/common/OpmLog/StreamLog.hpp>
 #include <iostream>
+#include <mutex>
 #include <errno.h>  // For errno
 #include <stdio.h>  // For fileno() and stdout
 
@@ -38,6 +39,18 @@
 #include <unistd.h> // For isatty()
 #endif
 
+namespace {
+
+    // Serialises messages from concurrent threads, e.g., while input
+    // objects are constructed in parallel.
+    std::mutex& messageMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+} // Anonymous namespace
+
 namespace Opm {
 
     bool OpmLog::stdoutIsTerminal()
@@ -63,14 +76,18 @@ namespace Opm {
 
 
     void OpmLog::addMessage(int64_t messageFlag , const std::string& message) {
-        if (m_logger)
+        if (m_logger) {
+            std::lock_guard<std::mutex> lock(messageMutex());
             m_logger->addMessage( messageFlag , message );
+        }
     }
 
 
     void OpmLog::addTaggedMessage(int64_t messageFlag, const std::string& tag, const std::string& message) {
-        if (m_logger)
+        if (m_logger) {
+            std::lock_guard<std::mutex> lock(messageMutex());
             m_logger->addTaggedMessage( messageFlag, tag, message );
+        }
     }
 
 
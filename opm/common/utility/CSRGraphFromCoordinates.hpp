@@ -84,6 +84,20 @@ namespace Opm { namespace utility {
         /// this function does nothing.
         void addConnection(VertexID v1, VertexID v2);
 
+        /// Add multiple connections.
+        ///
+        /// Equivalent to calling addConnection() for each vertex pair
+        /// (rows[i], cols[i]), in order, but validates and appends the
+        /// pairs in bulk.
+        ///
+        /// \param[in] rows First vertex of each vertex pair.  Used as row
+        ///    indices.
+        ///
+        /// \param[in] cols Second vertex of each vertex pair.  Used as
+        ///    column indices.  Must have the same size as \p rows.
+        void addConnections(const std::vector<VertexID>& rows,
+                            const std::vector<VertexID>& cols);
+
         /// Form CSR adjacency matrix representation of input graph from
         /// connections established in previous calls to addConnection().
         ///
@@ -104,6 +118,29 @@ namespace Opm { namespace utility {
         void compress(Offset maxNumVertices,
                       bool expandExistingIdxMap = false);
 
+        /// Form CSR adjacency matrix representation of input graph from
+        /// connections established since the previous call to compress()
+        /// or recompress(), reusing the existing structure if possible.
+        ///
+        /// Intended for repeatedly forming the same graph, e.g., once per
+        /// time step, from an identical sequence of addConnection() calls.
+        /// If the new connections are exactly those which formed the
+        /// current structure, in the same order, and \p maxNumVertices
+        /// matches numVertices(), then the existing structure and
+        /// compressed index map are retained.  Otherwise any existing
+        /// structure is discarded and the graph is formed from the new
+        /// connections alone.
+        ///
+        /// Available only if client code sets TrackCompressedIdx=true.
+        ///
+        /// \param[in] maxNumVertices Number of rows in resulting CSR
+        ///     matrix.  Same requirements as for compress().
+        ///
+        /// \return Whether or not the existing structure was reused.
+        template <typename Ret = bool>
+        std::enable_if_t<TrackCompressedIdx, Ret>
+        recompress(Offset maxNumVertices);
+
         /// Retrieve number of rows (source entities) in input graph.
         /// Corresponds to value of argument passed to compress().  Valid
         /// only after calling compress().
@@ -258,6 +295,17 @@ namespace Opm { namespace utility {
                        const Offset       maxNumVertices,
                        const bool         expandExistingIdxMap);
 
+            /// Whether or not coordinate format contributions are exactly
+            /// those, in the same order, which formed the current
+            /// structure and its compressed index map.
+            ///
+            /// \param[in] conns Coordinate representation of new
+            ///    contributions.
+            ///
+            /// \param[in] maxNumVertices Maximum number of vertices.
+            bool samePattern(const Connections& conns,
+                             Offset             maxNumVertices) const;
+
             /// Total number of rows in compressed map structure.
             Offset numRows() const;
 
@@ -423,6 +471,10 @@ namespace Opm { namespace utility {
 
             /// Sort column indices within each mapped row.
             ///
+            /// Rows are sorted independently and in parallel, using a
+            /// counting sort for rows which are long compared to the number
+            /// of columns and a comparison sort otherwise.
+            ///
             /// On exit \c ja_ has ascendingly sorted column indices, albeit
             /// possibly with repeated entries.  This function also updates
             /// \c compressedIdx_, if applicable, to account for the new
@@ -444,65 +496,51 @@ namespace Opm { namespace utility {
             // Implementation of assemble()
             // ---------------------------------------------------------
 
-            /// Position end pointers at start of row to prepare for column
-            /// index grouping by corresponding row index.
+            /// Group column indices by corresponding row index and track
+            /// grouped location of original coordinate format element
+            ///
+            /// On exit \c ia_ holds the final start pointers for \p
+            /// numRows rows and \c ja_ holds the column indices of each
+            /// row, possibly repeated and in unspecified order.  Assigns
+            /// the grouped location of each input element to \c
+            /// compressedIdx_ if needed.
             ///
-            /// Also counts total number of non-zero elements, possibly
-            /// including repetitions, in \code this->ia_[0] \endcode.
+            /// Uses a counting sort with per-thread row counts if the
+            /// number of rows is small compared to the number of elements
+            /// and atomic insertion pointers otherwise.
             ///
             /// \param[in] numRows Number of rows in final compressed
             ///    structure.  Used to allocate \code this->ia_ \endcode.
             ///
-            /// \param[in] rowIdx Row indices of all, possibly repeated,
-            ///    coordinate format input contributions.  Needed to count
-            ///    the number of possibly repeated column index entries per
-            ///    row.
-            void preparePushbackRowGrouping(const int         numRows,
-                                            const Neighbours& rowIdx);
-
-            /// Group column indices by corresponding row index and track
-            /// grouped location of original coordinate format element
-            ///
-            /// Appends grouped location to \c compressedIdx_ if needed.
-            ///
             /// \param[in] rowIdx Row index of coordinate format input
             ///    structure.  Used as grouping key.
             ///
             /// \param[in] colIdx Column index of coordinate format intput
             ///    structure.  Inserted into \c ja_ according to its
             ///    corresponding row index.
-            void groupAndTrackColumnIndicesByRow(const Neighbours& rowIdx,
-                                                 const Neighbours& colIdx);
+            void groupAndTrackColumnIndicesByRow(const BaseVertexID numRows,
+                                                 const Neighbours&  rowIdx,
+                                                 const Neighbours&  colIdx);
+
+            /// Counting sort implementation of
+            /// groupAndTrackColumnIndicesByRow().
+            ///
+            /// \param[in] numChunks Number of consecutive, equally sized
+            ///    input chunks with separate row counts.  One chunk
+            ///    corresponds to a sequential counting sort.
+            void groupByRowChunked(const std::size_t numChunks,
+                                   const Neighbours& rowIdx,
+                                   const Neighbours& colIdx);
+
+            /// Atomic insertion implementation of
+            /// groupAndTrackColumnIndicesByRow().
+            void groupByRowAtomic(const Neighbours& rowIdx,
+                                  const Neighbours& colIdx);
 
             // ---------------------------------------------------------
             // General utilities
             // ---------------------------------------------------------
 
-            /// Transpose connectivity structure.
-            ///
-            /// Essentially swaps the roles of rows and columns.  Also used
-            /// as a basic building block for sortColumnIndicesPerRow().
-            void transpose();
-
-            /// Condense sequences of repeated column indices in a single
-            /// map row down to a single copy of each unique column index.
-            ///
-            /// Appends new unique column indices to \code ja_ \endcode
-            ///
-            /// Assumes that the map row has ascendingly sorted column
-            /// indices and therefore has the same requirements as
-            /// std::unique.  Will also update the internal compressedIdx_
-            /// mapping, if needed, to record new compressed locations for
-            /// the current, uncompressed, non-zero map elements.
-            ///
-            /// \param[in] begin Start of map row that contains possibly
-            ///    repeated column indices.
-            ///
-            /// \param[in] end One-past-end of map row that contains
-            ///    possibly repeated column indices.
-            void condenseAndTrackUniqueColumnsForSingleRow(typename Neighbours::const_iterator begin,
-                                                           typename Neighbours::const_iterator end);
-
             /// Update \c compressedIdx_ mapping, if needed, to account for
             /// column index reshuffling.
             ///
@@ -21,14 +21,20 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <exception>
 #include <iterator>
+#include <numeric>
 #include <optional>
 #include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
 // ---------------------------------------------------------------------
 // Class Opm::utility::CSRGraphFromCoordinates::Connections
 // ---------------------------------------------------------------------
@@ -169,6 +175,44 @@ CSR::merge(const Connections& conns,
     this->compress(maxNumVertices);
 }
 
+template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
+bool
+Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
+CSR::samePattern(const Connections& conns,
+                 const Offset       maxNumVertices) const
+{
+    if constexpr (! TrackCompressedIdx) {
+        return false;
+    }
+    else {
+        const auto& rows = conns.rowIndices();
+        const auto& cols = conns.columnIndices();
+
+        if ((rows.size() != this->compressedIdx_.size()) ||
+            (this->numRows() != maxNumVertices))
+        {
+            return false;
+        }
+
+        const auto nnz = static_cast<std::int64_t>(rows.size());
+        auto numMismatch = std::int64_t{0};
+
+#pragma omp parallel for schedule(static) reduction(+:numMismatch)
+        for (std::int64_t nz = 0; nz < nnz; ++nz) {
+            const auto row  = static_cast<Offset>(rows[nz]);
+            const auto edge = this->compressedIdx_[nz];
+
+            const auto same = (row < this->numRows())
+                && (this->ia_[row] <= edge) && (edge < this->ia_[row + 1])
+                && (this->ja_[edge] == cols[nz]);
+
+            numMismatch += ! same;
+        }
+
+        return numMismatch == 0;
+    }
+}
+
 template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
 typename Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::Offset
 Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
@@ -221,15 +265,15 @@ CSR::coordinateFormatRowIndices() const
         return rowIdx;
     }
 
-    rowIdx.reserve(this->ia_.back());
-
-    auto row = BaseVertexID{};
+    rowIdx.resize(this->ia_.back());
 
-    const auto m = this->ia_.size() - 1;
-    for (auto i = 0*m; i < m; ++i, ++row) {
-        const auto n = this->ia_[i + 1] - this->ia_[i + 0];
+    const auto m = static_cast<std::int64_t>(this->ia_.size() - 1);
 
-        rowIdx.insert(rowIdx.end(), n, row);
+#pragma omp parallel for schedule(static)
+    for (std::int64_t i = 0; i < m; ++i) {
+        std::fill(rowIdx.begin() + this->ia_[i + 0],
+                  rowIdx.begin() + this->ia_[i + 1],
+                  static_cast<BaseVertexID>(i));
     }
 
     return rowIdx;
@@ -272,9 +316,7 @@ CSR::assemble(const Neighbours&  rows,
     const auto thisNumRows = std::max(this->numRows_, maxRowIdx + 1);
     const auto thisNumCols = std::max(this->numCols_, maxColIdx + 1);
 
-    this->preparePushbackRowGrouping(thisNumRows, i);
-
-    this->groupAndTrackColumnIndicesByRow(i, j);
+    this->groupAndTrackColumnIndicesByRow(thisNumRows, i, j);
 
     if constexpr (TrackCompressedIdx) {
         if (expandExistingIdxMap) {
@@ -318,202 +360,302 @@ void
 Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
 CSR::sortColumnIndicesPerRow()
 {
-    // Transposition is, in this context, effectively a linear time (O(nnz))
-    // bucket insertion procedure.  In other words transposing the structure
-    // twice creates a structure with column indices in (ascendingly) sorted
-    // order.
+    // Rows are independent, so sort each row's column indices separately.
+    // Track the sorted location of each grouped element in 'sortedIdx'.
 
-    this->transpose();
-    this->transpose();
-}
+    const auto nnz = this->ja_.size();
+    const auto numRows = static_cast<std::int64_t>(this->ia_.size() - 1);
 
-template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
-void
-Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
-CSR::condenseDuplicates()
-{
-    // Note: Must be called *after* sortColumnIndicesPerRow().
-
-    const auto colIdx = this->ja_;
-    auto end          = colIdx.begin();
+    auto ja = Neighbours(nnz);
 
-    this->ja_.clear();
+    [[maybe_unused]] auto sortedIdx =
+        std::conditional_t<TrackCompressedIdx, Start, EmptyPlaceHolder>{};
 
-    [[maybe_unused]] auto compressedIdx = this->compressedIdx_;
     if constexpr (TrackCompressedIdx) {
-        this->compressedIdx_.clear();
+        sortedIdx.resize(nnz);
     }
 
-    const auto numRows = this->ia_.size() - 1;
-    for (auto row = 0*numRows; row < numRows; ++row) {
-        auto begin = end;
+#pragma omp parallel
+    {
+        // Sort keys.  Column index in the high 32 bits and position within
+        // the row in the low 32 bits.  Sorting plain integers is
+        // considerably faster than sorting through an indirection.
+        auto keys = std::vector<std::uint64_t>{};
+        auto colStart = Start{};
+
+#pragma omp for schedule(dynamic, 256)
+        for (std::int64_t row = 0; row < numRows; ++row) {
+            const auto begin = this->ia_[row + 0];
+            const auto end   = this->ia_[row + 1];
+
+            if (std::is_sorted(this->ja_.begin() + begin, this->ja_.begin() + end)) {
+                std::copy(this->ja_.begin() + begin, this->ja_.begin() + end, ja.begin() + begin);
 
-        std::advance(end, this->ia_[row + 1] - this->ia_[row + 0]);
+                if constexpr (TrackCompressedIdx) {
+                    std::iota(sortedIdx.begin() + begin, sortedIdx.begin() + end, begin);
+                }
+
+                continue;
+            }
 
-        const auto q = this->ja_.size();
+            if ((end - begin) * 4 >= static_cast<Offset>(this->numCols_)) {
+                // Long row compared to the number of columns.  Use linear
+                // time counting sort.
+                colStart.assign(this->numCols_ + 1, 0);
+                for (auto k = begin; k < end; ++k) {
+                    colStart[this->ja_[k] + 1] += 1;
+                }
 
-        this->condenseAndTrackUniqueColumnsForSingleRow(begin, end);
+                std::partial_sum(colStart.begin(), colStart.end(), colStart.begin());
 
-        this->ia_[row + 0] = q;
+                for (auto k = begin; k < end; ++k) {
+                    const auto pos = begin + colStart[this->ja_[k]]++;
+
+                    ja[pos] = this->ja_[k];
+
+                    if constexpr (TrackCompressedIdx) {
+                        sortedIdx[k] = pos;
+                    }
+                }
+
+                continue;
+            }
+
+            keys.resize(end - begin);
+            for (auto k = begin; k < end; ++k) {
+                keys[k - begin] = (static_cast<std::uint64_t>(this->ja_[k]) << 32)
+                    | static_cast<std::uint64_t>(k - begin);
+            }
+
+            std::sort(keys.begin(), keys.end());
+
+            for (auto k = begin; k < end; ++k) {
+                const auto key = keys[k - begin];
+
+                ja[k] = static_cast<BaseVertexID>(key >> 32);
+
+                if constexpr (TrackCompressedIdx) {
+                    sortedIdx[begin + (key & 0xFFFFFFFFu)] = k;
+                }
+            }
+        }
     }
 
+    this->ja_.swap(ja);
+
     if constexpr (TrackCompressedIdx) {
+        auto compressedIdx = std::move(this->compressedIdx_);
+        this->compressedIdx_ = std::move(sortedIdx);
+
         this->remapCompressedIndex(std::move(compressedIdx));
     }
-
-    // Record final table sizes.
-    this->ia_.back() = this->ja_.size();
 }
 
 template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
 void
 Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
-CSR::preparePushbackRowGrouping(const int         numRows,
-                                const Neighbours& rowIdx)
+CSR::condenseDuplicates()
 {
-    assert (numRows >= 0);
+    // Note: Must be called *after* sortColumnIndicesPerRow() whence
+    // duplicate elements appear consecutively in each row.
 
-    this->ia_.assign(numRows + 1, 0);
+    const auto numRows = static_cast<std::int64_t>(this->ia_.size() - 1);
+
+    // Number of unique column indices per row.  Accumulate in "next" bin
+    // to form start pointers.
+    auto ia = Start(this->ia_.size(), 0);
+
+#pragma omp parallel for schedule(static)
+    for (std::int64_t row = 0; row < numRows; ++row) {
+        const auto begin = this->ia_[row + 0];
+        const auto end   = this->ia_[row + 1];
+
+        auto numUnique = Offset{0};
+        for (auto k = begin; k < end; ++k) {
+            numUnique += (k == begin) || (this->ja_[k] != this->ja_[k - 1]);
+        }
+
+        ia[row + 1] = numUnique;
+    }
+
+    std::partial_sum(ia.begin(), ia.end(), ia.begin());
+
+    auto ja = Neighbours(ia.back());
 
-    // Count number of neighbouring vertices for each row.  Accumulate in
-    // "next" bin since we're positioning the end pointers.
-    for (const auto& row : rowIdx) {
-        this->ia_[row + 1] += 1;
+    [[maybe_unused]] auto uniqueIdx =
+        std::conditional_t<TrackCompressedIdx, Start, EmptyPlaceHolder>{};
+
+    if constexpr (TrackCompressedIdx) {
+        uniqueIdx.resize(this->ja_.size());
     }
 
-    // Position "end" pointers.
-    //
-    // After this loop, ia_[i + 1] points to the *start* of the range of the
-    // column indices/neighbouring vertices of vertex 'i'.  This, in turn,
-    // enables using the statement ja_[ia_[i+1]++] = v in groupAndTrack()
-    // to insert vertex 'v' as a neighbour, at the end of the range of known
-    // neighbours, *and* advance the end pointer of row/vertex 'i'.  We use
-    // ia_[0] as an accumulator for the total number of neighbouring
-    // vertices in the graph.
-    //
-    // Note index range: 1..numRows inclusive.
-    for (typename Start::size_type i = 1, n = numRows; i <= n; ++i) {
-        this->ia_[0] += this->ia_[i];
-        this->ia_[i]  = this->ia_[0] - this->ia_[i];
+#pragma omp parallel for schedule(static)
+    for (std::int64_t row = 0; row < numRows; ++row) {
+        const auto begin = this->ia_[row + 0];
+        const auto end   = this->ia_[row + 1];
+
+        auto q = ia[row];
+        for (auto k = begin; k < end; ++k) {
+            if ((k != begin) && (this->ja_[k] != this->ja_[k - 1])) {
+                ++q;
+            }
+
+            ja[q] = this->ja_[k];
+
+            if constexpr (TrackCompressedIdx) {
+                uniqueIdx[k] = q;
+            }
+        }
     }
 
-    assert (this->ia_[0] == rowIdx.size());
+    this->ia_.swap(ia);
+    this->ja_.swap(ja);
+
+    if constexpr (TrackCompressedIdx) {
+        auto compressedIdx = std::move(this->compressedIdx_);
+        this->compressedIdx_ = std::move(uniqueIdx);
+
+        this->remapCompressedIndex(std::move(compressedIdx));
+    }
 }
 
 template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
 void
 Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
-CSR::groupAndTrackColumnIndicesByRow(const Neighbours& rowIdx,
-                                     const Neighbours& colIdx)
+CSR::groupAndTrackColumnIndicesByRow(const BaseVertexID numRows,
+                                     const Neighbours&  rowIdx,
+                                     const Neighbours&  colIdx)
 {
-    assert (this->ia_[0] == rowIdx.size());
+    assert (numRows >= 0);
 
     const auto nnz = rowIdx.size();
 
+    this->ia_.assign(numRows + 1, 0);
     this->ja_.resize(nnz);
 
     if constexpr (TrackCompressedIdx) {
-        this->compressedIdx_.clear();
-        this->compressedIdx_.reserve(nnz);
-    }
-
-    // Group/insert column indices according to their associate vertex/row
-    // index.
-    //
-    // At the start of the loop the end pointers ia_[i+1], formed in
-    // preparePushback(), are positioned at the *start* of the column index
-    // range associated to vertex 'i'.  After this loop all vertices
-    // neighbouring vertex 'i' will be placed consecutively, in order of
-    // appearance, into ja_.  Furthermore, the row pointers ia_ will have
-    // their final position.
-    //
-    // The statement ja_[ia_[i+1]++] = v, split into two statements using
-    // the helper object 'k', inserts 'v' as a neighbouring vertex of vertex
-    // 'i' *and* advances the end pointer ia_[i+1] of that vertex.  We use
-    // and maintain the invariant that ia_[i+1] at all times records the
-    // insertion point of the next neighbouring vertex of vertex 'i'.  When
-    // the list of neighbouring vertices for vertex 'i' has been exhausted,
-    // ia_[i+1] will hold the start position for in ja_ for vertex i+1.
-    for (auto nz = 0*nnz; nz < nnz; ++nz) {
-        const auto k = this->ia_[rowIdx[nz] + 1] ++;
+        this->compressedIdx_.resize(nnz);
+    }
 
-        this->ja_[k] = colIdx[nz];
+#ifdef _OPENMP
+    const auto numThreads = static_cast<std::size_t>(std::max(omp_get_max_threads(), 1));
+#else
+    const auto numThreads = std::size_t{1};
+#endif // _OPENMP
 
-        if constexpr (TrackCompressedIdx) {
-            this->compressedIdx_.push_back(k);
-        }
-    }
+    // Small inputs are not worth the threading overhead.
+    constexpr auto minParallelSize = std::size_t{1} << 15;
 
-    this->ia_[0] = 0;
+    if ((numThreads == 1) || (nnz < minParallelSize)) {
+        this->groupByRowChunked(1, rowIdx, colIdx);
+    }
+    else if (numThreads * static_cast<std::size_t>(numRows) <= nnz / 4) {
+        // Few rows compared to the number of elements.  Per-thread row
+        // counts are cheap and avoid contention on the insertion pointers.
+        this->groupByRowChunked(numThreads, rowIdx, colIdx);
+    }
+    else {
+        this->groupByRowAtomic(rowIdx, colIdx);
+    }
 }
 
 template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
 void
 Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
-CSR::transpose()
+CSR::groupByRowChunked(const std::size_t numChunks,
+                       const Neighbours& rowIdx,
+                       const Neighbours& colIdx)
 {
-    [[maybe_unused]] auto compressedIdx = this->compressedIdx_;
+    const auto nnz = rowIdx.size();
+    const auto numRows = this->ia_.size() - 1;
 
+    auto chunkStart = [nnz, numChunks](const std::size_t chunk)
     {
-        const auto rowIdx = this->coordinateFormatRowIndices();
-        const auto colIdx = this->ja_;
+        return (nnz * chunk) / numChunks;
+    };
+
+    // Count number of column indices for each row in each input chunk.
+    auto count = Start(numChunks * numRows, 0);
 
-        this->preparePushbackRowGrouping(this->numCols_, colIdx);
+#pragma omp parallel for schedule(static) if (numChunks > 1)
+    for (std::int64_t chunk = 0; chunk < static_cast<std::int64_t>(numChunks); ++chunk) {
+        auto* rowCount = count.data() + chunk*numRows;
 
-        // Note parameter order.  Transposition switches role of rows and
-        // columns.
-        this->groupAndTrackColumnIndicesByRow(colIdx, rowIdx);
+        for (auto nz = chunkStart(chunk); nz < chunkStart(chunk + 1); ++nz) {
+            ++rowCount[rowIdx[nz]];
+        }
     }
 
-    if constexpr (TrackCompressedIdx) {
-        this->remapCompressedIndex(std::move(compressedIdx));
+    // Position per-chunk insertion pointers.  Elements of row 'i' from
+    // chunk 'c' are inserted after those of row 'i' from chunks 0..c-1.
+    auto offset = Offset{0};
+    for (auto row = 0*numRows; row < numRows; ++row) {
+        this->ia_[row] = offset;
+
+        for (auto chunk = 0*numChunks; chunk < numChunks; ++chunk) {
+            const auto n = count[chunk*numRows + row];
+            count[chunk*numRows + row] = offset;
+            offset += n;
+        }
     }
 
-    std::swap(this->numRows_, this->numCols_);
+    this->ia_[numRows] = offset;
+
+    assert (this->ia_[numRows] == nnz);
+
+    // Group/insert column indices according to their associate row index.
+#pragma omp parallel for schedule(static) if (numChunks > 1)
+    for (std::int64_t chunk = 0; chunk < static_cast<std::int64_t>(numChunks); ++chunk) {
+        auto* insertPos = count.data() + chunk*numRows;
+
+        for (auto nz = chunkStart(chunk); nz < chunkStart(chunk + 1); ++nz) {
+            const auto k = insertPos[rowIdx[nz]]++;
+
+            this->ja_[k] = colIdx[nz];
+
+            if constexpr (TrackCompressedIdx) {
+                this->compressedIdx_[nz] = k;
+            }
+        }
+    }
 }
 
 template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
 void
 Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
-CSR::condenseAndTrackUniqueColumnsForSingleRow(typename Neighbours::const_iterator begin,
-                                               typename Neighbours::const_iterator end)
+CSR::groupByRowAtomic(const Neighbours& rowIdx,
+                      const Neighbours& colIdx)
 {
-    // We assume that we're only called *after* sortColumnIndicesPerRow()
-    // whence duplicate elements appear consecutively in [begin, end).
-    //
-    // Note: This is essentially the same as std::unique(begin, end) save
-    // for the return value and the fact that we additionally record the
-    // 'compressedIdx_' mapping.  That mapping enables subsequent, decoupled
-    // accumulation of the 'sa_' contributions.
+    const auto nnz = static_cast<std::int64_t>(rowIdx.size());
+    const auto numRows = this->ia_.size() - 1;
 
-    while (begin != end) {
-        // Note: Order of ja_ and compressedIdx_ matters here.
+    // Count number of column indices for each row.  Accumulate in "next"
+    // bin to form start pointers.
+#pragma omp parallel for schedule(static)
+    for (std::int64_t nz = 0; nz < nnz; ++nz) {
+#pragma omp atomic
+        this->ia_[rowIdx[nz] + 1] += 1;
+    }
 
-        if constexpr (TrackCompressedIdx) {
-            this->compressedIdx_.push_back(this->ja_.size());
-        }
+    std::partial_sum(this->ia_.begin(), this->ia_.end(), this->ia_.begin());
+
+    auto insertPos = Start(this->ia_.begin(), this->ia_.begin() + numRows);
 
-        this->ja_.push_back(*begin);
+    // Group/insert column indices according to their associate row index.
+    // Order within each row is unspecified, but subsequently fixed by
+    // sortColumnIndicesPerRow().
+#pragma omp parallel for schedule(static)
+    for (std::int64_t nz = 0; nz < nnz; ++nz) {
+        auto k = Offset{0};
 
-        auto next_unique =
-            std::find_if(begin, end, [last = this->ja_.back()]
-                         (const auto j) { return j != last; });
+#pragma omp atomic capture
+        k = insertPos[rowIdx[nz]]++;
+
+        this->ja_[k] = colIdx[nz];
 
         if constexpr (TrackCompressedIdx) {
-            // Number of duplicate elements in [begin, next_unique).
-            const auto ndup = std::distance(begin, next_unique);
-
-            if (ndup > 1) {
-                // Insert ndup - 1 copies of .back() to represent the
-                // duplicate pairs in [begin, next_unique).  We subtract one
-                // to account for .push_back() above representing *begin.
-                this->compressedIdx_.insert(this->compressedIdx_.end(),
-                                            ndup - 1,
-                                            this->compressedIdx_.back());
-            }
+            this->compressedIdx_[nz] = k;
         }
-
-        begin = next_unique;
     }
 }
 
@@ -524,8 +666,11 @@ remapCompressedIndex([[maybe_unused]] Start&&                                  c
                      [[maybe_unused]] std::optional<typename Start::size_type> numOrig)
 {
     if constexpr (TrackCompressedIdx) {
-        for (auto& i : compressedIdx) {
-            i = this->compressedIdx_[i];
+        const auto n = static_cast<std::int64_t>(compressedIdx.size());
+
+#pragma omp parallel for schedule(static)
+        for (std::int64_t i = 0; i < n; ++i) {
+            compressedIdx[i] = this->compressedIdx_[compressedIdx[i]];
         }
 
         if (numOrig.has_value() && (*numOrig < this->compressedIdx_.size())) {
@@ -593,6 +738,81 @@ compress(const Offset maxNumVertices, const bool expandExistingIdxMap)
     this->uncompressed_.clear();
 }
 
+template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
+void
+Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
+addConnections(const std::vector<VertexID>& rows,
+               const std::vector<VertexID>& cols)
+{
+    if (cols.size() != rows.size()) {
+        throw std::invalid_argument {
+            "Column index table size (" + std::to_string(cols.size()) +
+            ") does not match row index table size (" +
+            std::to_string(rows.size()) + ')'
+        };
+    }
+
+    const auto n = static_cast<std::int64_t>(rows.size());
+
+    auto minID = BaseVertexID{0};
+    auto maxRow = BaseVertexID{0};
+    auto maxCol = BaseVertexID{0};
+    auto numSelf = std::int64_t{0};
+
+#pragma omp parallel for schedule(static) \
+    reduction(min:minID) reduction(max:maxRow,maxCol) reduction(+:numSelf)
+    for (std::int64_t i = 0; i < n; ++i) {
+        minID   = std::min({ minID, BaseVertexID{rows[i]}, BaseVertexID{cols[i]} });
+        maxRow  = std::max(maxRow, BaseVertexID{rows[i]});
+        maxCol  = std::max(maxCol, BaseVertexID{cols[i]});
+        numSelf += rows[i] == cols[i];
+    }
+
+    if (minID < 0) {
+        throw std::invalid_argument {
+            "Vertex IDs must be non-negative.  Got minimum vertex ID "
+            + std::to_string(minID)
+        };
+    }
+
+    if (n == 0) {
+        return;
+    }
+
+    if (PermitSelfConnections || (numSelf == 0)) {
+        this->uncompressed_.add(maxRow, maxCol, rows, cols);
+        return;
+    }
+
+    for (auto i = 0*n; i < n; ++i) {
+        this->addConnection(rows[i], cols[i]);
+    }
+}
+
+template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
+template <typename Ret>
+std::enable_if_t<TrackCompressedIdx, Ret>
+Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
+recompress(const Offset maxNumVertices)
+{
+    if (! this->uncompressed_.isValid()) {
+        throw std::logic_error {
+            "Cannot compress invalid connection list"
+        };
+    }
+
+    const auto reuse = this->csr_.samePattern(this->uncompressed_, maxNumVertices);
+
+    if (! reuse) {
+        this->csr_.clear();
+        this->csr_.merge(this->uncompressed_, maxNumVertices, false);
+    }
+
+    this->uncompressed_.clear();
+
+    return reuse;
+}
+
 template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
 typename Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::Offset
 Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::numVertices() const
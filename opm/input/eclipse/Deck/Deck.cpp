@@ -129,6 +129,7 @@ const DeckView& Deck::global_view() const {
     }
 
     UnitSystem& Deck::getActiveUnitSystem() {
+#pragma omp atomic
         this->unit_system_access_count++;
         if (this->activeUnits.has_value())
             return this->activeUnits.value();
@@ -147,6 +148,7 @@ const DeckView& Deck::global_view() const {
 
 
     const UnitSystem& Deck::getActiveUnitSystem() const {
+#pragma omp atomic
         this->unit_system_access_count++;
         if (this->activeUnits.has_value())
             return this->activeUnits.value();
@@ -208,13 +210,12 @@ const DeckView& Deck::global_view() const {
 
 
     void Deck::write( DeckOutput& output ) const {
-        size_t kw_index = 1;
-        for (const auto& keyword: *this) {
-            keyword.write( output );
-            kw_index++;
-            if (kw_index < size())
-                output.write_string( output.fmt.keyword_sep );
-        }
+        output.write_keywords(this->size(), [this](const std::size_t kw_index, DeckOutput& out)
+        {
+            this->keywordList[kw_index].write( out );
+            if (kw_index + 2 < this->size())
+                out.write_string( out.fmt.keyword_sep );
+        });
     }
 
     Deck& Deck::operator=(const Deck& data) {
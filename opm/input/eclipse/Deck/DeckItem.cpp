@@ -23,15 +23,159 @@
 #include <opm/common/utility/String.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <stdexcept>
+#include <type_traits>
+
+namespace {
+
+// Pool of mutexes guarding the first SI conversion of DeckItems.  Sharing a
+// small pool, rather than having one mutex per item, keeps the items small.
+std::mutex& siConversionMutex(const void* item)
+{
+    static std::array<std::mutex, 64> mutexes{};
+
+    const auto i = reinterpret_cast<std::uintptr_t>(item) / alignof(std::max_align_t);
+    return mutexes[i % mutexes.size()];
+}
+
+bool isIdentity(const std::vector<Opm::Dimension>& dimensions)
+{
+    return std::all_of(dimensions.begin(), dimensions.end(),
+                       [](const Opm::Dimension& dim) { return dim == Opm::Dimension{}; });
+}
+
+bool isContextDependent(const std::vector<Opm::Dimension>& dimensions)
+{
+    return std::any_of(dimensions.begin(), dimensions.end(),
+                       [](const Opm::Dimension& dim) { return dim.isContextDependent(); });
+}
+
+// Element-wise conversion.  Throws if a value, which is not otherwise
+// converted, has a context dependent unit.
+void convertRawToSiElementwise(const std::vector<double>& raw,
+                               const std::vector<Opm::value::status>& status,
+                               const std::vector<Opm::Dimension>& active,
+                               const std::vector<Opm::Dimension>& dflt,
+                               std::vector<double>& si)
+{
+    const auto dim_size = active.size();
+    const auto sz = raw.size();
+
+    for (auto index = 0*sz; index < sz; ++index) {
+        const auto& dim = Opm::value::defaulted(status[index]) ? dflt : active;
+
+        si[index] = dim[index % dim_size].convertRawToSi(raw[index]);
+    }
+}
+
+// Convert record-structured raw values, with one dimension per position in
+// the record, to SI.  Defaulted values use the default dimensions.
+void convertRawToSi(const std::vector<double>& raw,
+                    const std::vector<Opm::value::status>& status,
+                    const std::vector<Opm::Dimension>& active,
+                    const std::vector<Opm::Dimension>& dflt,
+                    std::vector<double>& si)
+{
+    if ((dflt.size() != active.size()) ||
+        isContextDependent(active) || isContextDependent(dflt))
+    {
+        convertRawToSiElementwise(raw, status, active, dflt, si);
+        return;
+    }
+
+    const auto dim_size = active.size();
+    const auto sz = raw.size();
+
+    const auto anyDefaulted = (active != dflt) &&
+        std::any_of(status.begin(), status.end(),
+                    [](const Opm::value::status st) { return Opm::value::defaulted(st); });
+
+    if ((dim_size == 1) && !anyDefaulted) {
+        // Common case.  Single affine transformation of whole array.
+        active.front().convertRawToSi(raw.data(), sz, si.data());
+        return;
+    }
+
+    auto fa = std::vector<double>(dim_size);
+    auto oa = std::vector<double>(dim_size);
+    auto fd = std::vector<double>(dim_size);
+    auto od = std::vector<double>(dim_size);
+    for (auto d = 0*dim_size; d < dim_size; ++d) {
+        fa[d] = active[d].getSIScaling();
+        oa[d] = active[d].getSIOffset();
+        fd[d] = dflt[d].getSIScaling();
+        od[d] = dflt[d].getSIOffset();
+    }
+
+    // Single pass, record by record, selecting active or default
+    // conversion per element without branches.
+    for (auto record = 0*sz; record < sz; record += dim_size) {
+        const auto n = std::min(dim_size, sz - record);
+        const auto* x = raw.data() + record;
+        const auto* st = status.data() + record;
+        auto* y = si.data() + record;
+
+        for (auto d = 0*n; d < n; ++d) {
+            const auto def = Opm::value::defaulted(st[d]);
+            y[d] = x[d]*(def ? fd[d] : fa[d]) + (def ? od[d] : oa[d]);
+        }
+    }
+}
+
+} // Anonymous namespace
 
 namespace Opm {
 
+DeckItem::SIDataCache&
+DeckItem::SIDataCache::operator=(const SIDataCache&)
+{
+    this->reset();
+    return *this;
+}
+
+DeckItem::SIDataCache&
+DeckItem::SIDataCache::operator=(SIDataCache&&) noexcept
+{
+    this->reset();
+    return *this;
+}
+
+template <typename Convert>
+const std::vector<double>&
+DeckItem::SIDataCache::get(const std::vector<double>& raw, Convert&& convert) const
+{
+    if (const auto* si = this->data.load(std::memory_order_acquire); si != nullptr) {
+        return *si;
+    }
+
+    std::lock_guard<std::mutex> lock { siConversionMutex(this) };
+
+    const auto* si = this->data.load(std::memory_order_relaxed);
+    if (si == nullptr) {
+        si = convert(this->values) ? &this->values : &raw;
+        this->data.store(si, std::memory_order_release);
+    }
+
+    return *si;
+}
+
+void DeckItem::SIDataCache::reset() noexcept
+{
+    this->data.store(nullptr, std::memory_order_relaxed);
+    this->values = std::vector<double>{};
+}
+
+// Mutable access invalidates any SI values computed from the raw values.
 template< typename T >
 std::vector< T >& DeckItem::value_ref() {
+    this->si_data.reset();
+
     return const_cast< std::vector< T >& >(
             const_cast< const DeckItem& >( *this ).value_ref< T >()
          );
@@ -123,7 +267,6 @@ DeckItem DeckItem::serializationTestObject()
     result.type = type_tag::string;
     result.item_name = "test2";
     result.value_status = {value::status::deck_value};
-    result.raw_data = false;
     result.active_dimensions = {Dimension::serializationTestObject()};
     result.default_dimensions = {Dimension::serializationTestObject()};
 
@@ -304,33 +447,9 @@ double DeckItem::getSIDouble( size_t index ) const {
     return this->getSIDoubleData().at( index );
 }
 
-template<>
-const std::vector<double>& DeckItem::getData() const {
-    auto& data = (const_cast<DeckItem*>(this))->value_ref< double >();
-    if (this->raw_data)
-        return data;
-
-    const auto dim_size = this->active_dimensions.size();
-    for( size_t index = 0; index < data.size(); index++ ) {
-        const auto dimIndex = index % dim_size;
-        if (value::defaulted(this->value_status[index])) {
-            const auto& dim = this->default_dimensions[dimIndex];
-            data[ index ] = dim.convertSiToRaw( data[ index ] );
-        } else {
-            const auto& dim = this->active_dimensions[dimIndex];
-            data[ index ] = dim.convertSiToRaw( data[ index ] );
-        }
-    }
-    this->raw_data = true;
-    return data;
-}
-
 const std::vector<double>& DeckItem::getSIDoubleData() const
 {
-    auto& data = (const_cast<DeckItem*>(this))->value_ref<double>();
-    if (!this->raw_data) {
-        return data;
-    }
+    const auto& data = this->value_ref<double>();
 
     if (this->active_dimensions.empty()) {
         throw std::invalid_argument {
@@ -340,22 +459,23 @@ const std::vector<double>& DeckItem::getSIDoubleData() const
         };
     }
 
-    // This is an unobservable state change - SIData is lazily converted to
-    // SI units, so externally the object still behaves as const.
-
-    const auto dim_size = this->active_dimensions.size();
-    const auto sz = data.size();
-    for (auto index = 0*sz; index < sz; ++index) {
-        const auto& dim = value::defaulted(this->value_status[index])
-            ? this->default_dimensions
-            : this->active_dimensions;
-
-        data[index] = dim[index % dim_size].convertRawToSi(data[index]);
-    }
+    // The raw values are never modified.  SI values are computed once, into
+    // a separate buffer, so that the item may be read concurrently.
+    return this->si_data.get(data, [this, &data](std::vector<double>& si)
+    {
+        if (isIdentity(this->active_dimensions) &&
+            isIdentity(this->default_dimensions))
+        {
+            return false;
+        }
 
-    this->raw_data = false;
+        si.resize(data.size());
+        convertRawToSi(data, this->value_status,
+                       this->active_dimensions,
+                       this->default_dimensions, si);
 
-    return data;
+        return true;
+    });
 }
 
 
@@ -367,6 +487,28 @@ type_tag DeckItem::getType() const {
 
 template< typename T >
 void DeckItem::write_vector(DeckOutput& stream, const std::vector<T>& data) const {
+    if constexpr (std::is_arithmetic_v<T>) {
+        if (stream.fmt.compress_repeats) {
+            size_t index = 0;
+            while (index < this->data_size()) {
+                if (this->defaultApplied(index)) {
+                    stream.stash_default( );
+                    index++;
+                    continue;
+                }
+
+                auto end = index + 1;
+                while ((end < this->data_size()) && !this->defaultApplied(end) && (data[end] == data[index]))
+                    end++;
+
+                stream.write_repeated( end - index, data[index] );
+                index = end;
+            }
+
+            return;
+        }
+    }
+
     for (size_t index = 0; index < this->data_size(); index++) {
         if (this->defaultApplied(index))
             stream.stash_default( );
@@ -459,13 +601,7 @@ bool DeckItem::equal(const DeckItem& other, bool cmp_default, bool cmp_numeric)
                     return false;
             }
         } else {
-            if (this->raw_data == other.raw_data)
-                return (this->dval == other.dval);
-            else {
-                const auto& this_data = this->getData<double>();
-                const auto& other_data = other.getData<double>();
-                return (this_data == other_data);
-            }
+            return (this->dval == other.dval);
         }
         break;
     default:
@@ -544,6 +680,7 @@ template void DeckItem::push_backDummyDefault<RawString>( std::size_t );
 template void DeckItem::push_backDummyDefault<UDAValue>( std::size_t );
 
 template const std::vector< int >& DeckItem::getData< int >() const;
+template const std::vector< double >& DeckItem::getData< double >() const;
 template const std::vector< UDAValue >& DeckItem::getData< UDAValue >() const;
 template const std::vector< std::string >& DeckItem::getData< std::string >() const;
 template const std::vector<RawString>& DeckItem::getData<RawString>() const;
@@ -20,6 +20,7 @@
 #ifndef DECKITEM_HPP
 #define DECKITEM_HPP
 
+#include <atomic>
 #include <string>
 #include <vector>
 #include <memory>
@@ -145,14 +146,39 @@ namespace Opm {
             serializer(type);
             serializer(item_name);
             serializer(value_status);
-            serializer(raw_data);
             serializer(active_dimensions);
             serializer(default_dimensions);
         }
 
         void reserve_additionalRawString(std::size_t);
     private:
-        mutable std::vector< double > dval;
+        /*
+          SI values of a double item, computed from the raw values on first
+          request.  Concurrent requests are safe and do the conversion once.
+          Copies start out empty and recompute on demand.
+        */
+        class SIDataCache {
+        public:
+            SIDataCache() = default;
+            SIDataCache(const SIDataCache&) {}
+            SIDataCache(SIDataCache&&) noexcept {}
+            SIDataCache& operator=(const SIDataCache&);
+            SIDataCache& operator=(SIDataCache&&) noexcept;
+
+            // convert(si) fills si from the raw values and returns false
+            // if the SI values equal the raw values, in which case a
+            // reference to raw is returned and no copy is kept.
+            template <typename Convert>
+            const std::vector<double>& get(const std::vector<double>& raw, Convert&& convert) const;
+
+            void reset() noexcept;
+
+        private:
+            mutable std::atomic<const std::vector<double>*> data{nullptr};
+            mutable std::vector<double> values{};
+        };
+
+        std::vector< double > dval;
         std::vector< int > ival;
         std::vector< std::string > sval;
         std::vector< RawString > rsval;
@@ -162,14 +188,9 @@ namespace Opm {
 
         std::string item_name;
         std::vector<value::status> value_status;
-        /*
-          To save space we mutate the dval object in place when asking for SI
-          data; the current state of of the dval member is tracked with the
-          raw_data bool member.
-        */
-        mutable bool raw_data = true;
         std::vector< Dimension > active_dimensions;
         std::vector< Dimension > default_dimensions;
+        SIDataCache si_data;
 
         template< typename T > std::vector< T >& value_ref();
         template< typename T > const std::vector< T >& value_ref() const;
@@ -17,12 +17,33 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <iterator>
 #include <ostream>
+#include <sstream>
+#include <vector>
+
+#include <fmt/format.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include <opm/input/eclipse/Deck/DeckOutput.hpp>
 #include <opm/input/eclipse/Deck/UDAValue.hpp>
 #include <opm/input/eclipse/Utility/Typetools.hpp>
 
+namespace {
+
+    // Keyword sets smaller than this are written directly to the stream.
+    constexpr auto minParallelKeywordCount = std::int64_t{16};
+
+    // Number of keywords buffered at a time when formatting concurrently.
+    constexpr auto keywordBatchSize = std::int64_t{1024};
+
+} // Anonymous namespace
 
 namespace Opm {
 
@@ -47,7 +68,7 @@ namespace Opm {
 
 
     void DeckOutput::endl() {
-        this->os << std::endl;
+        this->os << '\n';
     }
 
     void DeckOutput::write_string(const std::string& s) {
@@ -57,6 +78,29 @@ namespace Opm {
 
     template <typename T>
     void DeckOutput::write( const T& value ) {
+        write_pending_defaults( );
+
+        write_sep( );
+        write_value( value );
+        row_count++;
+    }
+
+    template <typename T>
+    void DeckOutput::write_repeated( std::size_t count, const T& value ) {
+        if (count == 1) {
+            this->write(value);
+            return;
+        }
+
+        write_pending_defaults( );
+
+        write_sep( );
+        os << count << "*";
+        write_value( value );
+        row_count++;
+    }
+
+    void DeckOutput::write_pending_defaults( ) {
         if (default_count > 0) {
             write_sep( );
 
@@ -64,10 +108,6 @@ namespace Opm {
             default_count = 0;
             row_count++;
         }
-
-        write_sep( );
-        write_value( value );
-        row_count++;
     }
 
     template <>
@@ -82,12 +122,17 @@ namespace Opm {
 
     template <>
     void DeckOutput::write_value( const int& value ) {
-        this->os << value;
+        const auto text = fmt::format_int(value);
+        this->os.write(text.data(), text.size());
     }
 
     template <>
     void DeckOutput::write_value( const double& value ) {
-        this->os << value;
+        // Same text as 'os << value' with the default float field, without
+        // going through the stream's locale dependent number formatting.
+        fmt::memory_buffer text;
+        fmt::format_to(std::back_inserter(text), "{:.{}g}", value, this->os.precision());
+        this->os.write(text.data(), text.size());
     }
 
     template <>
@@ -106,14 +151,64 @@ namespace Opm {
 
 
     void DeckOutput::start_keyword(const std::string& kw, bool split_line_arg) {
-        this->os << kw << std::endl;
+        this->os << kw << '\n';
         this->split_line = split_line_arg;
     }
 
 
     void DeckOutput::end_keyword(bool add_slash) {
         if (add_slash)
-            this->os << "/" << std::endl;
+            this->os << "/\n";
+    }
+
+
+    void DeckOutput::write_keywords(std::size_t num_keywords,
+                                    const std::function<void(std::size_t, DeckOutput&)>& write_keyword) {
+        const auto n = static_cast<std::int64_t>(num_keywords);
+
+#ifdef _OPENMP
+        const auto parallel = (n >= minParallelKeywordCount) && (omp_get_max_threads() > 1);
+#else
+        const auto parallel = false;
+#endif
+
+        if (! parallel) {
+            for (std::size_t index = 0; index < num_keywords; index++)
+                write_keyword(index, *this);
+
+            return;
+        }
+
+        const auto precision = static_cast<int>(this->os.precision());
+        auto buffers = std::vector<std::string>(std::min(n, keywordBatchSize));
+        auto failures = std::vector<std::exception_ptr>(buffers.size());
+
+        for (std::int64_t batch = 0; batch < n; batch += keywordBatchSize) {
+            const auto batch_size = std::min(n - batch, keywordBatchSize);
+
+#pragma omp parallel for schedule(dynamic)
+            for (std::int64_t i = 0; i < batch_size; ++i) {
+                try {
+                    std::ostringstream buffer;
+                    {
+                        DeckOutput out(buffer, precision);
+                        out.fmt = this->fmt;
+                        write_keyword(batch + i, out);
+                    }
+                    buffers[i] = buffer.str();
+                }
+                catch (...) {
+                    failures[i] = std::current_exception();
+                }
+            }
+
+            for (std::int64_t i = 0; i < batch_size; ++i) {
+                if (failures[i])
+                    std::rethrow_exception(failures[i]);
+
+                this->os << buffers[i];
+            }
+        }
     }
 
 
@@ -137,13 +232,13 @@ namespace Opm {
 
 
     void DeckOutput::split_record() {
-        this->os << std::endl;
+        this->os << '\n';
         this->row_count = 0;
     }
 
 
     void DeckOutput::end_record( ) {
-        this->os << " /" << std::endl;
+        this->os << " /\n";
         this->record_on = false;
     }
 
@@ -153,4 +248,7 @@ namespace Opm {
     template void DeckOutput::write( const std::string& value);
     template void DeckOutput::write( const RawString& value);
     template void DeckOutput::write( const UDAValue& value);
+
+    template void DeckOutput::write_repeated( std::size_t count, const int& value);
+    template void DeckOutput::write_repeated( std::size_t count, const double& value);
 }
@@ -21,6 +21,7 @@
 #define DECK_OUTPUT_HPP
 
 #include <iosfwd>
+#include <functional>
 #include <string>
 #include <cstddef>
 
@@ -33,6 +34,7 @@ namespace Opm {
             size_t      columns = 7;          // The maximum number of columns on a record.
             std::string record_indent = " "; // The indentation when starting a new line.
             std::string keyword_sep = "";  // The separation between keywords;
+            bool        compress_repeats = false; // Write runs of equal numeric values as N*value.
         };
 
         explicit DeckOutput(std::ostream& s, int precision = 10);
@@ -48,6 +50,14 @@ namespace Opm {
         void endl();
         void write_string(const std::string& s);
         template <typename T> void write(const T& value);
+        template <typename T> void write_repeated(std::size_t count, const T& value);
+
+        // Emit keywords 0..num_keywords-1 through write_keyword(index,
+        // output).  Large keyword sets are formatted concurrently into
+        // separate buffers and written to the stream in index order, so
+        // write_keyword() must only depend on its arguments.
+        void write_keywords(std::size_t num_keywords,
+                            const std::function<void(std::size_t, DeckOutput&)>& write_keyword);
         format fmt;
     private:
         std::ostream& os;
@@ -58,6 +68,7 @@ namespace Opm {
         bool split_line;
 
         template <typename T> void write_value(const T& value);
+        void write_pending_defaults();
         void split_record();
         void write_sep( );
         void set_precision(int precision);
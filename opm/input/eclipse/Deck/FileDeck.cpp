@@ -211,10 +211,11 @@ void FileDeck::Block::insert(std::size_t keyword_index, const DeckKeyword& keywo
 }
 
 void FileDeck::Block::dump(DeckOutput& out) const {
-    for (const auto& kw : this->keywords) {
-        kw.write( out );
-        out.write_string( out.fmt.keyword_sep );
-    }
+    out.write_keywords(this->keywords.size(), [this](const std::size_t kw_index, DeckOutput& kw_out)
+    {
+        this->keywords[kw_index].write( kw_out );
+        kw_out.write_string( kw_out.fmt.keyword_sep );
+    });
 }
 
 
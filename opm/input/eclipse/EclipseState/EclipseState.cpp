@@ -56,16 +56,35 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <exception>
 #include <filesystem>
 #include <map>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
 namespace {
+    // At most one thread per DeckComponents section, but never more than
+    // requested through OMP_NUM_THREADS or omp_set_num_threads().
+    int numDeckComponentThreads()
+    {
+#ifdef _OPENMP
+        return std::min(omp_get_max_threads(), 2);
+#else
+        return 1;
+#endif // _OPENMP
+    }
+
     void verify_consistent_restart_information(const Opm::DeckKeyword& restart_keyword,
                                                const Opm::IOConfig&    io_config,
                                                const Opm::InitConfig&  init_config)
@@ -97,6 +116,66 @@ namespace {
 
 namespace Opm {
 
+    struct EclipseState::DeckComponents
+    {
+        explicit DeckComponents(const Deck& deck);
+
+        std::optional<TableManager> tables{};
+        std::optional<EclipseGrid> grid{};
+        std::optional<NNC> nnc{};
+    };
+
+    // Construct the tables and the input grid, along with its NNCs,
+    // concurrently.  These are the most expensive deck-only members and
+    // they read disjoint sets of keywords.
+    //
+    // The remaining members are constructed serially in EclipseState's
+    // constructor.  The field properties, simulation configuration,
+    // aquifers, transmissibility multipliers, LGRs and faults all need the
+    // tables or the grid.  Runspec, EclipseConfig, GridDims, the tracer,
+    // compositional, MICP, WAG hysteresis and CO2STORE configurations only
+    // depend on the deck, but each reads a handful of keywords, so running
+    // them in a separate section costs more than it saves.
+    EclipseState::DeckComponents::DeckComponents(const Deck& deck)
+    {
+        // Deck::hasKeyword() builds the deck's keyword index on first use.
+        // Do so before the deck is shared between threads.
+        static_cast<void>(deck.hasKeyword<ParserKeywords::RUNSPEC>());
+
+        auto failure = std::array<std::exception_ptr, 2>{};
+
+#pragma omp parallel sections num_threads(numDeckComponentThreads())
+        {
+#pragma omp section
+            {
+                try {
+                    this->tables.emplace(deck);
+                }
+                catch (...) {
+                    failure[0] = std::current_exception();
+                }
+            }
+
+#pragma omp section
+            {
+                try {
+                    this->grid.emplace(deck, nullptr);
+                    this->nnc.emplace(*this->grid, deck);
+                }
+                catch (...) {
+                    failure[1] = std::current_exception();
+                }
+            }
+        }
+
+        // Report failures in order of original, sequential, construction.
+        for (const auto& ex : failure) {
+            if (ex) {
+                std::rethrow_exception(ex);
+            }
+        }
+    }
+
 // The field_props and grid both have a relationship to the number of active
 // cells, and update eachother through an inelegant dance through the
 // EclispeState construction:
@@ -131,12 +210,25 @@ namespace Opm {
 
     EclipseState::EclipseState(const Deck& deck)
     try
-        : m_tables(            deck )
+        : EclipseState(deck, DeckComponents { deck })
+    {}
+    catch (const OpmInputError& opm_error) {
+        OpmLog::error(opm_error.what());
+        throw;
+    }
+    catch (const std::exception& std_error) {
+        OpmLog::error(fmt::format("\nAn error occurred while creating the reservoir properties\n"
+                                  "Internal error: {}\n", std_error.what()));
+        throw;
+    }
+
+    EclipseState::EclipseState(const Deck& deck, DeckComponents&& components)
+        : m_tables(            std::move(*components.tables) )
         , m_runspec(           deck )
         , m_eclipseConfig(     deck )
         , m_deckUnitSystem(    deck.getActiveUnitSystem() )
-        , m_inputGrid(         deck, nullptr )
-        , m_inputNnc(          m_inputGrid, deck)
+        , m_inputGrid(         std::move(*components.grid) )
+        , m_inputNnc(          std::move(*components.nnc) )
         , m_gridDims(          deck )
         , field_props(         deck, m_runspec.phases(), m_inputGrid, m_tables, m_runspec.numComps())
         , m_simulationConfig(  m_eclipseConfig.init().restartRequested(), deck, field_props)
@@ -168,15 +260,6 @@ namespace Opm {
                                                   this->getIOConfig(), this->getInitConfig());
         }
     }
-    catch (const OpmInputError& opm_error) {
-        OpmLog::error(opm_error.what());
-        throw;
-    }
-    catch (const std::exception& std_error) {
-        OpmLog::error(fmt::format("\nAn error occurred while creating the reservoir properties\n"
-                                  "Internal error: {}\n", std_error.what()));
-        throw;
-    }
 
 
 
@@ -557,6 +640,31 @@ bool rst_cmp_obj(const T& full_arg, const T& rst_arg, const std::string& object_
 }
 
 }
+    bool EclipseState::operator==(const EclipseState& data) const {
+        return (this->m_tables == data.m_tables)
+            && (this->m_runspec == data.m_runspec)
+            && (this->m_eclipseConfig == data.m_eclipseConfig)
+            && (this->m_deckUnitSystem == data.m_deckUnitSystem)
+            && this->m_inputGrid.equal(data.m_inputGrid)
+            && (this->m_inputNnc == data.m_inputNnc)
+            && (this->m_gridDims == data.m_gridDims)
+            && (this->field_props == data.field_props)
+            && (this->m_lgrs == data.m_lgrs)
+            && (this->m_simulationConfig == data.m_simulationConfig)
+            && (this->aquifer_config == data.aquifer_config)
+            && (this->compositional_config == data.compositional_config)
+            && (this->m_transMult == data.m_transMult)
+            && (this->tracer_config == data.tracer_config)
+            && (this->m_micppara == data.m_micppara)
+            && (this->wag_hyst_config == data.wag_hyst_config)
+            && (this->co2_store_config == data.co2_store_config)
+            && (this->m_title == data.m_title)
+            && (this->m_faults == data.m_faults)
+            && (this->m_restart_network_pressures == data.m_restart_network_pressures)
+            && (this->fipRegionStatistics_ == data.fipRegionStatistics_)
+            ;
+    }
+
     bool EclipseState::rst_cmp(const EclipseState& full_state, const EclipseState& rst_state) {
         return Runspec::rst_cmp(full_state.m_runspec, rst_state.m_runspec) &&
             EclipseConfig::rst_cmp(full_state.m_eclipseConfig, rst_state.m_eclipseConfig) &&
@@ -164,9 +164,16 @@ namespace Opm {
             serializer(this->fipRegionStatistics_);
         }
 
+        bool operator==(const EclipseState& data) const;
         static bool rst_cmp(const EclipseState& full_state, const EclipseState& rst_state);
 
     private:
+        /// Members which depend on the input deck only and which are
+        /// therefore constructed concurrently.
+        struct DeckComponents;
+
+        EclipseState(const Deck& deck, DeckComponents&& components);
+
         void initIOConfigPostSchedule(const Deck& deck);
         void assignRunTitle(const Deck& deck);
         void reportNumberOfActivePhases() const;
@@ -1796,26 +1796,14 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         // Preparing vectors to be saved
 
         // create coord vector of floats with input units, converted from SI
-        std::vector<float> coord_f;
-        coord_f.resize(m_coord.size());
-
-        auto convert_length = [&units](const double x) { return static_cast<float>(units.from_si(length, x)); };
-
-        if (m_input_coord.has_value()) {
-            std::transform(m_input_coord.value().begin(), m_input_coord.value().end(), coord_f.begin(), convert_length);
-        } else {
-            std::transform(m_coord.begin(), m_coord.end(), coord_f.begin(), convert_length);
-        }
+        const auto& coord = m_input_coord.has_value() ? m_input_coord.value() : m_coord;
+        std::vector<float> coord_f(coord.size());
+        units.from_si(length, coord.data(), coord.size(), coord_f.data());
 
         // create zcorn vector of floats with input units, converted from SI
-        std::vector<float> zcorn_f;
-        zcorn_f.resize(m_zcorn.size());
-
-        if (m_input_zcorn.has_value()) {
-            std::transform(m_input_zcorn.value().begin(), m_input_zcorn.value().end(), zcorn_f.begin(), convert_length);
-        } else {
-            std::transform(m_zcorn.begin(), m_zcorn.end(), zcorn_f.begin(), convert_length);
-        }
+        const auto& zcorn = m_input_zcorn.has_value() ? m_input_zcorn.value() : m_zcorn;
+        std::vector<float> zcorn_f(zcorn.size());
+        units.from_si(length, zcorn.data(), zcorn.size(), zcorn_f.data());
 
         m_input_coord.reset();
         m_input_zcorn.reset();
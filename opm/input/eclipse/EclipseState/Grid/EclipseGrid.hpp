@@ -163,6 +163,13 @@ namespace Opm {
         std::array<double, 3> getCellCenter(size_t i,size_t j, size_t k) const;
         std::array<double, 3> getCellCenter(size_t globalIndex) const;
         std::array<double, 3> getCornerPos(size_t i,size_t j, size_t k, size_t corner_index) const;
+
+        /// All eight corners of a cell, in getCornerPos() order.  Cheaper
+        /// than eight getCornerPos() calls.
+        void getCellCorners(const std::size_t globalIndex,
+                            std::array<double,8>& X,
+                            std::array<double,8>& Y,
+                            std::array<double,8>& Z) const;
         const std::vector<double>& activeVolume() const;
         double getCellVolume(size_t globalIndex) const;
         double getCellVolume(size_t i , size_t j , size_t k) const;
@@ -310,10 +317,6 @@ namespace Opm {
         std::vector<double> makeCoordDxvDyvDzvDepthz(const std::vector<double>& dxv, const std::vector<double>& dyv, const std::vector<double>& dzv, const std::vector<double>& depthz) const;
 
         void getCellCorners(const std::array<int, 3>& ijk, const std::array<int, 3>& dims, std::array<double,8>& X, std::array<double,8>& Y, std::array<double,8>& Z) const;
-        void getCellCorners(const std::size_t globalIndex,
-                            std::array<double,8>& X,
-                            std::array<double,8>& Y,
-                            std::array<double,8>& Z) const;
 
    };
 
@@ -1616,10 +1616,13 @@ void FieldProps::init_tempi(Fieldprops::FieldData<double>& tempi)
         const auto& rtempvd = this->tables.getRtempvdTables();
         std::vector< double > tempi_values( this->active_size, 0 );
 
+        // All RTEMPVD tables share the same columns.
+        const auto temperature = rtempvd.getTable<RtempvdTable>(0).columnIndex("Temperature");
+
         for (size_t active_index = 0; active_index < this->active_size; active_index++) {
             const auto& table = rtempvd.getTable<RtempvdTable>(eqlnum[active_index] - 1);
             double depth = this->cell_depth[active_index];
-            tempi_values[active_index] = table.evaluate("Temperature", depth);
+            tempi_values[active_index] = table.evaluate(temperature, depth);
         }
 
         tempi.default_update(tempi_values);
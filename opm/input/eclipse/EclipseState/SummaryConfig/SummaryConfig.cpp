@@ -53,12 +53,15 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstdint>
+#include <exception>
 #include <iterator>
 #include <map>
-#include <regex>
+#include <numeric>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -323,25 +326,78 @@ struct SummaryConfigContext {
             && is_in_set(countkw, keyword.substr(1));
     }
 
-    bool is_supported_region_to_region(const std::string& keyword)
+    // Keyword classification below is done character by character
+    // rather than through regular expressions.  These predicates run at
+    // least once for every summary keyword in the deck, and std::regex
+    // matching is orders of magnitude slower than the equivalent direct
+    // comparisons.
+
+    bool is_one_of(const char c, std::string_view set)
     {
-        static const auto supported_kw = std::regex {
-            R"~~(R[OGW]F[RT][-+GL_]?([A-Z0-9_]{3})?)~~"
-        };
+        return set.find(c) != std::string_view::npos;
+    }
 
-        // R[OGW]F[RT][-+GL]? (e.g., "ROFTG", "RGFR+", or "RWFT")
-        return std::regex_match(keyword, supported_kw);
+    bool is_upper_alnum(const char c)
+    {
+        return ((c >= 'A') && (c <= 'Z'))
+            || ((c >= '0') && (c <= '9'))
+            || (c == '_');
     }
 
-    bool is_unsupported_region_to_region(const std::string& keyword)
+    bool is_digit(const char c)
     {
-        static const auto unsupported_kw = std::regex {
-            R"~~(R([EK]|NL)F[RT][-+_]?([A-Z0-9_]{3})?)~~"
-        };
+        return (c >= '0') && (c <= '9');
+    }
+
+    // ([A-Z0-9_]{3})? at the end of 'keyword', starting at 'pos'.
+    bool is_region_set_tag(const std::string& keyword, const std::string::size_type pos)
+    {
+        return (keyword.size() == pos)
+            || ((keyword.size() == pos + 3) &&
+                std::all_of(keyword.begin() + pos, keyword.end(), &is_upper_alnum));
+    }
+
+    // [<optional>]?([A-Z0-9_]{3})? at the end of 'keyword', starting at 'pos'.
+    bool is_region_to_region_tail(const std::string&           keyword,
+                                  const std::string::size_type pos,
+                                  std::string_view             optional)
+    {
+        return is_region_set_tag(keyword, pos)
+            || ((keyword.size() > pos) &&
+                is_one_of(keyword[pos], optional) &&
+                is_region_set_tag(keyword, pos + 1));
+    }
 
+    bool is_supported_region_to_region(const std::string& keyword)
+    {
+        // R[OGW]F[RT][-+GL_]?([A-Z0-9_]{3})? (e.g., "ROFTG", "RGFR+", or "RWFT")
+        return (keyword.size() >= std::string::size_type{4})
+            && (keyword[0] == 'R')
+            && is_one_of(keyword[1], "OGW")
+            && (keyword[2] == 'F')
+            && is_one_of(keyword[3], "RT")
+            && is_region_to_region_tail(keyword, 4, "-+GL_");
+    }
+
+    bool is_unsupported_region_to_region(const std::string& keyword)
+    {
+        // R([EK]|NL)F[RT][-+_]?([A-Z0-9_]{3})?
+        //
         // R[EK]F[RT][-+]? (e.g., "REFT" or "RKFR+")
         // RNLF[RT][-+]? (e.g., "RNLFR-" or "RNLFT")
-        return std::regex_match(keyword, unsupported_kw);
+        if ((keyword.size() < std::string::size_type{4}) || (keyword[0] != 'R')) {
+            return false;
+        }
+
+        const auto pos = is_one_of(keyword[1], "EK") ? std::string::size_type{2}
+            : (keyword.compare(1, 2, "NL") == 0)     ? std::string::size_type{3}
+            : std::string::npos;
+
+        return (pos != std::string::npos)
+            && (keyword.size() >= pos + 2)
+            && (keyword[pos] == 'F')
+            && is_one_of(keyword[pos + 1], "RT")
+            && is_region_to_region_tail(keyword, pos + 2, "-+_");
     }
 
     bool is_region_to_region(const std::string& keyword)
@@ -372,22 +428,33 @@ struct SummaryConfigContext {
 
     bool is_connection_completion(const std::string& keyword)
     {
-        static const auto conn_compl_kw = std::regex {
-            R"(C[OGW][IP][RT]L)"
-        };
-
-        return std::regex_match(keyword, conn_compl_kw);
+        // C[OGW][IP][RT]L
+        return (keyword.size() == std::string::size_type{5})
+            && (keyword[0] == 'C')
+            && is_one_of(keyword[1], "OGW")
+            && is_one_of(keyword[2], "IP")
+            && is_one_of(keyword[3], "RT")
+            && (keyword[4] == 'L');
     }
 
     bool is_well_completion(const std::string& keyword)
     {
-        static const auto well_compl_kw = std::regex {
-            R"(W[OGWLV][PIGOLCF][RT]L([0-9_]{2}[0-9])?)"
-        };
-
+        // W[OGWLV][PIGOLCF][RT]L([0-9_]{2}[0-9])?
+        //
         // True, e.g., for WOPRL, WOPRL__8, WOPRL123, but not WOPRL___ or
         // WKITL.
-        return std::regex_match(keyword, well_compl_kw);
+        const auto size = keyword.size();
+
+        return ((size == std::string::size_type{5}) ||
+                ((size == std::string::size_type{8}) &&
+                 (is_digit(keyword[5]) || (keyword[5] == '_')) &&
+                 (is_digit(keyword[6]) || (keyword[6] == '_')) &&
+                 is_digit(keyword[7])))
+            && (keyword[0] == 'W')
+            && is_one_of(keyword[1], "OGWLV")
+            && is_one_of(keyword[2], "PIGOLCF")
+            && is_one_of(keyword[3], "RT")
+            && (keyword[4] == 'L');
     }
 
     bool is_well_comp(const std::string& keyword)
@@ -585,6 +652,63 @@ inline std::array< int, 3 > getijk( const DeckRecord& record ) {
 }
 
 
+// Append one summary node for each connection, satisfying 'include', of
+// each named well.  Node lists are created independently for each well,
+// possibly in parallel, and appended to 'list' in well order.
+template <typename Predicate>
+void appendConnectionNodes(SummaryConfig::keyword_list&    list,
+                           const SummaryConfigNode&        param,
+                           const std::vector<std::string>& well_names,
+                           const Schedule&                 schedule,
+                           Predicate&&                     include)
+{
+    const auto numWells = static_cast<int>(well_names.size());
+
+    std::vector<SummaryConfig::keyword_list> wellNodes(numWells);
+    std::vector<std::exception_ptr> failures(numWells);
+
+#pragma omp parallel for schedule(dynamic)
+    for (int w = 0; w < numWells; ++w) {
+        try {
+            const auto& connections = schedule.getWellatEnd(well_names[w]).getConnections();
+
+            auto node = param;
+            node.namedEntity(well_names[w]);
+
+            auto& nodes = wellNodes[w];
+            nodes.reserve(connections.size());
+
+            for (const auto& conn : connections) {
+                if (include(conn)) {
+                    nodes.push_back(node.number(1 + conn.global_index()));
+                }
+            }
+        }
+        catch (...) {
+            failures[w] = std::current_exception();
+        }
+    }
+
+    for (const auto& failure : failures) {
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
+
+    const auto numNodes = std::accumulate(wellNodes.begin(), wellNodes.end(), list.size(),
+        [](const std::size_t n, const SummaryConfig::keyword_list& nodes)
+    {
+        return n + nodes.size();
+    });
+
+    list.reserve(numNodes);
+    for (auto& nodes : wellNodes) {
+        list.insert(list.end(),
+                    std::make_move_iterator(nodes.begin()),
+                    std::make_move_iterator(nodes.end()));
+    }
+}
+
 inline void keywordCL(SummaryConfig::keyword_list& list,
                       const ParseContext& parseContext,
                       ErrorGuard& errors,
@@ -607,28 +731,28 @@ inline void keywordCL(SummaryConfig::keyword_list& list,
         }
 
         const auto ijk_defaulted = record.getItem(1).defaultApplied(0);
+        if (ijk_defaulted) {
+            appendConnectionNodes(list, node, well_names, schedule,
+                                  [](const Connection&) { return true; });
+            continue;
+        }
+
+        const auto ijk = getijk(record);
+        const auto global_index = dims.getGlobalIndex(ijk[0], ijk[1], ijk[2]);
+
         for (const auto& wname : well_names) {
-            const auto& well = schedule.getWellatEnd(wname);
-            const auto& all_connections = well.getConnections();
+            const auto& all_connections = schedule.getWellatEnd(wname).getConnections();
 
             node.namedEntity(wname);
-            if (ijk_defaulted) {
-                for (const auto& conn : all_connections)
-                    list.push_back(node.number(1 + conn.global_index()));
+            if (all_connections.hasGlobalIndex(global_index)) {
+                const auto& conn = all_connections.getFromGlobalIndex(global_index);
+                list.push_back( node.number( 1 + conn.global_index()));
             } else {
-                const auto& ijk = getijk(record);
-                auto global_index = dims.getGlobalIndex(ijk[0], ijk[1], ijk[2]);
-
-                if (all_connections.hasGlobalIndex(global_index)) {
-                    const auto& conn = all_connections.getFromGlobalIndex(global_index);
-                    list.push_back( node.number( 1 + conn.global_index()));
-                } else {
-                    std::string msg = fmt::format("Problem with keyword {{keyword}}\n"
-                                                  "In {{file}} line {{line}}\n"
-                                                  "Connection ({},{},{}) not defined for well {}",
-                                                  ijk[0] + 1, ijk[1] + 1, ijk[2] + 1, wname);
-                    parseContext.handleError( ParseContext::SUMMARY_UNHANDLED_KEYWORD, msg, keyword.location(), errors);
-                }
+                std::string msg = fmt::format("Problem with keyword {{keyword}}\n"
+                                              "In {{file}} line {{line}}\n"
+                                              "Connection ({},{},{}) not defined for well {}",
+                                              ijk[0] + 1, ijk[1] + 1, ijk[2] + 1, wname);
+                parseContext.handleError( ParseContext::SUMMARY_UNHANDLED_KEYWORD, msg, keyword.location(), errors);
             }
         }
     }
@@ -1146,21 +1270,20 @@ inline void keywordMISC( SummaryConfig::keyword_list& list,
         if( well_names.empty() )
             handleMissingWell( parseContext, errors, keyword.location(), wellitem.getTrimmedString( 0 ) );
 
-        for(const auto& name : well_names) {
-            param.namedEntity(name);
-            const auto& well = schedule.getWellatEnd(name);
-            /*
-             * we don't want to add connections that don't exist, so we iterate
-             * over a well's connections regardless of the desired block is
-             * defaulted or not
-             */
-            for( const auto& connection : well.getConnections() ) {
-                auto cijk = getijk( connection );
-                int global_index = 1 + dims.getGlobalIndex(cijk[0], cijk[1], cijk[2]);
-
-                if( ijk_defaulted || ( cijk == getijk(record) ) )
-                    list.push_back( param.number(global_index) );
-            }
+        /*
+         * we don't want to add connections that don't exist, so we iterate
+         * over a well's connections regardless of the desired block is
+         * defaulted or not
+         */
+        if (ijk_defaulted) {
+            appendConnectionNodes(list, param, well_names, schedule,
+                                  [](const Connection&) { return true; });
+        }
+        else {
+            const auto ijk = getijk( record );
+            appendConnectionNodes(list, param, well_names, schedule,
+                                  [&ijk](const Connection& connection)
+                                  { return getijk(connection) == ijk; });
         }
     }
 }
@@ -1816,10 +1939,27 @@ SummaryConfig::SummaryConfig( const Deck& deck,
         }
 
         uniq(this->m_keywords);
+
+        // m_keywords is sorted on keyword name, save for the ROEW vectors
+        // at the end, so inserting at the end of short_keywords is usually
+        // constant time.  Unique node keys are formed in parallel and
+        // sorted before insertion for the same reason.
+        std::vector<std::string> nodeKeys(this->m_keywords.size());
+        const auto numKeys = static_cast<std::int64_t>(nodeKeys.size());
+
+#pragma omp parallel for schedule(static)
+        for (std::int64_t i = 0; i < numKeys; ++i) {
+            nodeKeys[i] = this->m_keywords[i].uniqueNodeKey();
+        }
+
+        std::sort(nodeKeys.begin(), nodeKeys.end());
+
         for (const auto& kw : this->m_keywords) {
-            this->short_keywords.insert(kw.keyword());
-            this->summary_keywords.insert(kw.uniqueNodeKey());
+            this->short_keywords.insert(this->short_keywords.end(), kw.keyword());
         }
+
+        this->summary_keywords.insert(std::make_move_iterator(nodeKeys.begin()),
+                                      std::make_move_iterator(nodeKeys.end()));
     }
     catch (const OpmInputError& opm_error) {
         throw;
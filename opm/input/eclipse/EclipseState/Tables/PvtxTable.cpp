@@ -119,14 +119,15 @@ namespace Opm {
     {
         TableIndex outerIndex = m_outerColumn.lookup( outerArg );
         const auto& underSaturatedTable1 = getUnderSaturatedTable( outerIndex.getIndex1( ) );
+        const auto columnIdx = underSaturatedTable1.columnIndex( column );
         double weight1 = outerIndex.getWeight1( );
-        double value = weight1 * underSaturatedTable1.evaluate( column , innerArg );
+        double value = weight1 * underSaturatedTable1.evaluate( columnIdx , innerArg );
 
         if (weight1 < 1) {
             const auto& underSaturatedTable2 = getUnderSaturatedTable( outerIndex.getIndex2( ) );
             double weight2 = outerIndex.getWeight2( );
 
-            value += weight2 * underSaturatedTable2.evaluate( column , innerArg );
+            value += weight2 * underSaturatedTable2.evaluate( columnIdx , innerArg );
         }
 
         return value;
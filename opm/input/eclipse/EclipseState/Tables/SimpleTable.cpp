@@ -16,6 +16,7 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
+#include <stdexcept>
 #include <utility>
 #include <iostream>
 
@@ -172,6 +173,23 @@ namespace Opm {
         return valueColumn.eval( index );
     }
 
+    size_t SimpleTable::columnIndex(const std::string& name) const
+    {
+        if (this->m_jfunc && (name == "PCOW" || name == "PCOG"))
+            assertJFuncPressure(false); // this will throw since m_jfunc=true
+
+        return m_columns.index(name);
+    }
+
+    double SimpleTable::evaluate(size_t columnIndex, double xPos) const
+    {
+        const auto& argColumn = getColumn( 0 );
+        const auto& valueColumn = getColumn( columnIndex );
+
+        const auto index = argColumn.lookup( xPos );
+        return valueColumn.eval( index );
+    }
+
     void SimpleTable::assertJFuncPressure(const bool jf) const {
         if (jf == m_jfunc)
             return;
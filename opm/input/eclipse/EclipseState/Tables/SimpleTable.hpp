@@ -70,6 +70,22 @@ namespace Opm {
          */
         double evaluate(const std::string& columnName, double xPos) const;
 
+        /*!
+         * \brief Index of a named column.
+         *
+         * Resolve the index once and use it with the index based accessors
+         * when evaluating the same column repeatedly.
+         */
+        size_t columnIndex(const std::string& name) const;
+
+        /*!
+         * \brief Evaluate a column, identified by its index, at a given position.
+         *
+         * Same as evaluate(const std::string&, double), without the column
+         * name lookup.
+         */
+        double evaluate(size_t columnIndex, double xPos) const;
+
         /// throws std::invalid_argument if jf != m_jfunc
         void assertJFuncPressure(const bool jf) const;
 
@@ -20,6 +20,7 @@
 #include <stddef.h>
 #include <stdexcept>
 #include <algorithm>
+#include <functional>
 
 #include <opm/input/eclipse/EclipseState/Tables/ColumnSchema.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/TableColumn.hpp>
@@ -153,8 +154,15 @@ namespace Opm {
     double TableColumn::max( ) const {
         if (hasDefault())
             throw std::invalid_argument("Can not lookup elements in a column with defaulted values.");
-        if (m_values.size() > 0)
+        if (m_values.size() > 0) {
+            // Ordered columns have their extreme values at the ends.
+            if (m_schema.isIncreasing())
+                return m_values.back();
+            if (m_schema.isDecreasing())
+                return m_values.front();
+
             return *std::max_element( m_values.begin() , m_values.end());
+        }
         else
             throw std::invalid_argument("Can not find max in empty column");
     }
@@ -163,8 +171,14 @@ namespace Opm {
     double TableColumn::min( ) const {
         if (hasDefault())
             throw std::invalid_argument("Can not lookup elements in a column with defaulted values.");
-        if (m_values.size() > 0)
+        if (m_values.size() > 0) {
+            if (m_schema.isIncreasing())
+                return m_values.front();
+            if (m_schema.isDecreasing())
+                return m_values.back();
+
             return *std::min_element( m_values.begin() , m_values.end());
+        }
         else
             throw std::invalid_argument("Can not find max in empty column");
     }
@@ -195,43 +209,40 @@ namespace Opm {
         if (hasDefault())
             throw std::invalid_argument("Can not lookup elements in a column with defaulted values.");
 
+        // The column is ordered, so its extreme values are at the ends and
+        // the interval containing argValue is found by binary search.  Ties
+        // at the ends resolve to the first occurrence of the end value.
+        const auto isDescending = m_schema.isDecreasing( );
+        const auto first = m_values.begin();
+        const auto last = m_values.end();
+
         if (argValue >= max()) {
-            const auto max_iter = std::max_element( m_values.begin() , m_values.end());
-            const size_t max_index = max_iter - m_values.begin();
-            return TableIndex( max_index , 1.0 );
+            const auto max_iter = isDescending
+                ? first
+                : std::lower_bound(first, last, m_values.back());
+            return TableIndex( static_cast<size_t>(max_iter - first) , 1.0 );
         }
 
         if (argValue <= min()) {
-            const auto min_iter = std::min_element( m_values.begin() , m_values.end());
-            const size_t min_index = min_iter - m_values.begin();
-            return TableIndex( min_index , 1.0 );
+            const auto min_iter = isDescending
+                ? std::lower_bound(first, last, m_values.back(), std::greater<>{})
+                : first;
+            return TableIndex( static_cast<size_t>(min_iter - first) , 1.0 );
         }
 
-        {
-            bool isDescending = m_schema.isDecreasing( );
-            size_t lowIntervalIdx = 0;
-            size_t intervalIdx = (size() - 1)/2;
-            size_t highIntervalIdx = size() - 1;
-            double weight1;
-
-            while (lowIntervalIdx + 1 < highIntervalIdx) {
-                if (isDescending) {
-                    if (m_values[intervalIdx] < argValue)
-                        highIntervalIdx = intervalIdx;
-                    else
-                        lowIntervalIdx = intervalIdx;
-                }
-                else {
-                    if (m_values[intervalIdx] < argValue)
-                        lowIntervalIdx = intervalIdx;
-                    else
-                        highIntervalIdx = intervalIdx;
-                }
+        if (size() < 2)
+            return TableIndex( 0 , 1.0 );
 
-                intervalIdx = (highIntervalIdx + lowIntervalIdx)/2;
-            }
-
-            weight1 = 1 - (argValue - m_values[intervalIdx])/(m_values[intervalIdx + 1] - m_values[intervalIdx]);
+        {
+            // Find the interval [i, i+1] for which m_values[i] < argValue
+            // <= m_values[i+1] for increasing columns, or m_values[i] >=
+            // argValue > m_values[i+1] for decreasing columns.
+            const auto upper = isDescending
+                ? std::upper_bound(first + 1, last - 1, argValue, std::greater<>{})
+                : std::lower_bound(first + 1, last - 1, argValue);
+
+            const auto intervalIdx = static_cast<size_t>(upper - first) - 1;
+            const double weight1 = 1 - (argValue - m_values[intervalIdx])/(m_values[intervalIdx + 1] - m_values[intervalIdx]);
 
             return TableIndex( intervalIdx , weight1 );
         }
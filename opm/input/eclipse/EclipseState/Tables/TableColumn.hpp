@@ -35,6 +35,7 @@ namespace Opm {
         explicit TableColumn( const ColumnSchema& schema );
 
         TableColumn(const TableColumn& c2) { *this = c2; }
+        TableColumn(TableColumn&&) = default;
 
         static TableColumn serializationTestObject();
 
@@ -62,6 +63,7 @@ namespace Opm {
         void applyDefaults( const TableColumn& argColumn, std::string tableName );
         void assertUnitRange() const;
         TableColumn& operator= (const TableColumn& other);
+        TableColumn& operator= (TableColumn&& other) = default;
 
         std::vector<double> vectorCopy() const;
         std::vector<double>::const_iterator begin() const;
@@ -191,7 +191,9 @@ public:
     }
 
 
-    T& get(const std::string& key) {
+    // Position of key in insertion order.  Throws std::invalid_argument,
+    // listing similar keys, if key is not present.
+    std::size_t index(const std::string& key) const {
         auto iter = m_map.find( key );
         if (iter == m_map.end())
         {
@@ -205,10 +207,13 @@ public:
             throw std::invalid_argument("Key "s + key + " not found."s
                                         + startsWithSame);
         }
-        else {
-            size_t index = iter->second;
-            return iget(index);
-        }
+
+        return iter->second;
+    }
+
+
+    T& get(const std::string& key) {
+        return iget(this->index(key));
     }
 
 
@@ -219,23 +224,7 @@ public:
     }
 
     const T& get(const std::string& key) const {
-        const auto& iter = this->m_map.find( key );
-        if (iter == m_map.end())
-        {
-            auto startsWithSame = OrderedMapDetail::findSimilarStrings(key, m_vector);
-            if (!startsWithSame.empty())
-            {
-                startsWithSame = std::string(" Similar entries are ") +
-                    startsWithSame + std::string(".");
-            }
-            using namespace std::string_literals;
-            throw std::invalid_argument("Key "s + key + " not found."s
-                                        + startsWithSame);
-        }
-        else {
-            size_t index = iter->second;
-            return iget(index);
-        }
+        return iget(this->index(key));
     }
 
 
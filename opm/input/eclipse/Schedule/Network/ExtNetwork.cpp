@@ -17,9 +17,13 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include <algorithm>
+#include <atomic>
 #include <iterator>
+#include <memory>
 #include <stdexcept>
 #include <fmt/format.h>
+#include <string>
+#include <unordered_set>
 #include <vector>
 #include <functional>
 
@@ -94,6 +98,7 @@ void ExtNetwork::add_branch(Branch branch)
         }
     }
     this->m_branches.push_back( std::move(branch) );
+    this->reset_topology();
 }
 
 void ExtNetwork::add_or_replace_branch(Branch branch)
@@ -113,13 +118,15 @@ void ExtNetwork::add_or_replace_branch(Branch branch)
 
     // Remove any existing branch uptree from downtree_node (gathering tree structure required)
     // (If it is an existing branch that should be updated, it will be added again below)
-    auto uptree_link = this->uptree_branch( downtree_node );
-    if (uptree_link.has_value()){
-        const auto& old_uptree_node = uptree_link.value().uptree_node();
-        this->drop_branch(old_uptree_node, downtree_node);
+    // Search linearly rather than through topology() to avoid rebuilding
+    // the topology for every branch while parsing.
+    auto uptree_link = this->find_uptree_branch( downtree_node );
+    if (uptree_link != this->m_branches.end()) {
+        this->m_branches.erase(uptree_link);
     }
 
     this->m_branches.push_back( std::move(branch) );
+    this->reset_topology();
 }
 
 void ExtNetwork::drop_branch(const std::string& uptree_node, const std::string& downtree_node) {
@@ -128,6 +135,7 @@ void ExtNetwork::drop_branch(const std::string& uptree_node, const std::string&
                                     [&uptree_node, &downtree_node](const Branch& b) { return (b.uptree_node() == uptree_node && b.downtree_node() == downtree_node); });
     if (branch_iter != this->m_branches.end()) {
         this->m_branches.erase(branch_iter);
+        this->reset_topology();
     }
 }
 
@@ -138,13 +146,13 @@ std::optional<Branch> ExtNetwork::uptree_branch(const std::string& node) const {
         throw std::out_of_range(msg);
     }
 
-    std::vector<Branch> branches;
-    std::copy_if(this->m_branches.begin(), this->m_branches.end(), std::back_inserter(branches), [&node](const Branch& b) { return b.downtree_node() == node; });
+    const auto topology = this->topology();
+    const auto branches = topology->uptreeBranches(*topology->nodeId(node));
     if (branches.empty())
         return {};
 
     if (branches.size() == 1)
-        return std::move(branches[0]);
+        return this->m_branches[branches[0]];
 
     throw std::logic_error("Bug - more than one uptree branch for node: " + node);
 }
@@ -156,8 +164,12 @@ std::vector<Branch> ExtNetwork::downtree_branches(const std::string& node) const
         throw std::out_of_range(msg);
     }
 
+    const auto topology = this->topology();
+
     std::vector<Branch> branches;
-    std::copy_if(this->m_branches.begin(), this->m_branches.end(), std::back_inserter(branches), [&node](const Branch& b) { return b.uptree_node() == node; });
+    for (const auto& branch : topology->downtreeBranches(*topology->nodeId(node))) {
+        branches.push_back(this->m_branches[branch]);
+    }
     return branches;
 }
 
@@ -169,6 +181,10 @@ std::vector<const Branch*> ExtNetwork::branches() const {
     return branch_pointer;
 }
 
+const Branch& ExtNetwork::branch(const std::size_t index) const {
+    return this->m_branches.at(index);
+}
+
 int ExtNetwork::NoOfBranches() const {
     return this->m_branches.size();
 }
@@ -203,6 +219,7 @@ void ExtNetwork::update_node(Node node)
 
 
     this->m_nodes.insert_or_assign(name, std::move(node) );
+    this->reset_topology();
 }
 
 void ExtNetwork::add_indexed_node_name(std::string name)
@@ -218,9 +235,63 @@ bool ExtNetwork::has_indexed_node_name(const std::string& name) const
     return (it != this->insert_indexed_node_names.end());
 }
 
-std::vector<std::string> ExtNetwork::node_names() const
+const std::vector<std::string>& ExtNetwork::node_names() const
 {
     return this->insert_indexed_node_names;
 }
+
+std::shared_ptr<const Topology> ExtNetwork::topology() const
+{
+    auto topology = std::atomic_load(&this->m_topology);
+    if (topology != nullptr) {
+        return topology;
+    }
+
+    // Nodes created by update_node() alone are not in the list of indexed
+    // node names.  Give those the highest IDs.
+    auto names = this->insert_indexed_node_names;
+    if (names.size() < this->m_nodes.size()) {
+        const auto indexed = std::unordered_set<std::string> {
+            this->insert_indexed_node_names.begin(),
+            this->insert_indexed_node_names.end()
+        };
+
+        for (const auto& node : this->m_nodes) {
+            if (indexed.count(node.first) == 0) {
+                names.push_back(node.first);
+            }
+        }
+    }
+
+    auto expected = std::shared_ptr<const Topology>{};
+    topology = std::make_shared<const Topology>(names, this->m_branches);
+
+    // Publish.  If another thread got there first, use its topology.
+    if (! std::atomic_compare_exchange_strong(&this->m_topology, &expected, topology)) {
+        return expected;
+    }
+
+    return topology;
+}
+
+std::vector<Branch>::const_iterator
+ExtNetwork::find_uptree_branch(const std::string& node) const
+{
+    auto is_uptree = [&node](const Branch& b) { return b.downtree_node() == node; };
+
+    auto branch = std::find_if(this->m_branches.begin(), this->m_branches.end(), is_uptree);
+    if ((branch != this->m_branches.end()) &&
+        (std::find_if(branch + 1, this->m_branches.end(), is_uptree) != this->m_branches.end()))
+    {
+        throw std::logic_error("Bug - more than one uptree branch for node: " + node);
+    }
+
+    return branch;
+}
+
+void ExtNetwork::reset_topology()
+{
+    std::atomic_store(&this->m_topology, std::shared_ptr<const Topology>{});
+}
 }
 }
@@ -21,7 +21,9 @@
 #ifndef EXT_NETWORK_HPP
 #define EXT_NETWORK_HPP
 
+#include <cstddef>
 #include <map>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -29,6 +31,7 @@
 
 #include <opm/input/eclipse/Schedule/Network/Branch.hpp>
 #include <opm/input/eclipse/Schedule/Network/Node.hpp>
+#include <opm/input/eclipse/Schedule/Network/Topology.hpp>
 
 namespace Opm {
 namespace Network {
@@ -49,10 +52,17 @@ public:
     std::vector<std::reference_wrapper<const Node>> roots() const;
     std::vector<Branch> downtree_branches(const std::string& node) const;
     std::vector<const Branch*> branches() const;
+    const Branch& branch(std::size_t index) const;
     std::optional<Branch> uptree_branch(const std::string& node) const;
-    std::vector<std::string> node_names() const;
+    const std::vector<std::string>& node_names() const;
     int NoOfBranches() const;
 
+    // Index based view of the current network structure.  Built on first
+    // use and shared by copies of this network until it is modified.
+    // Branch indices refer to branch().  The returned topology stays valid
+    // after the network is modified, but then no longer describes it.
+    std::shared_ptr<const Topology> topology() const;
+
     bool operator==(const ExtNetwork& other) const;
     static ExtNetwork serializationTestObject();
 
@@ -63,6 +73,9 @@ public:
         serializer(insert_indexed_node_names);
         serializer(m_nodes);
         serializer(m_is_standard_network);
+
+        // Topology is derived data.  Rebuild on demand after unpacking.
+        this->reset_topology();
     }
 
 private:
@@ -70,8 +83,12 @@ private:
     std::vector<std::string> insert_indexed_node_names;
     std::map<std::string, Node> m_nodes;
     bool m_is_standard_network{false};
+    mutable std::shared_ptr<const Topology> m_topology{};
+
     bool has_indexed_node_name(const std::string& name) const;
     void add_indexed_node_name(std::string name);
+    std::vector<Branch>::const_iterator find_uptree_branch(const std::string& node) const;
+    void reset_topology();
 };
 
 }
@@ -0,0 +1,150 @@
+/*
+  Copyright 2024 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/Network/Topology.hpp>
+
+#include <opm/input/eclipse/Schedule/Network/Branch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    // Compressed sparse row representation of the mapping from node to
+    // the branches whose end point, as given by 'endPoint', is that node.
+    void compressBranches(const int               numNodes,
+                          const std::vector<int>& endPoint,
+                          std::vector<int>&       start,
+                          std::vector<int>&       branches)
+    {
+        start.assign(numNodes + 1, 0);
+        for (const auto& node : endPoint) {
+            ++start[node + 1];
+        }
+
+        std::partial_sum(start.begin(), start.end(), start.begin());
+
+        branches.resize(endPoint.size());
+        auto pos = std::vector<int>(start.begin(), start.end() - 1);
+        for (auto branch = 0*endPoint.size(); branch < endPoint.size(); ++branch) {
+            branches[pos[endPoint[branch]]++] = static_cast<int>(branch);
+        }
+    }
+
+} // Anonymous namespace
+
+Opm::Network::Topology::Topology(const std::vector<std::string>& node_names,
+                                 const std::vector<Branch>&      branches)
+    : node_names_ { node_names }
+{
+    this->node_ids_.reserve(this->node_names_.size());
+    for (auto node = 0*this->node_names_.size(); node < this->node_names_.size(); ++node) {
+        this->node_ids_.emplace(this->node_names_[node], static_cast<int>(node));
+    }
+
+    this->branch_uptree_.reserve(branches.size());
+    this->branch_downtree_.reserve(branches.size());
+
+    auto id = [this](const std::string& name)
+    {
+        const auto node = this->nodeId(name);
+        if (! node.has_value()) {
+            throw std::invalid_argument {
+                fmt::format("Branch end point {} is not a network node", name)
+            };
+        }
+
+        return *node;
+    };
+
+    for (const auto& branch : branches) {
+        this->branch_uptree_.push_back(id(branch.uptree_node()));
+        this->branch_downtree_.push_back(id(branch.downtree_node()));
+    }
+
+    this->buildAdjacency();
+    this->buildTopologicalOrder();
+}
+
+std::optional<int>
+Opm::Network::Topology::nodeId(const std::string& name) const
+{
+    auto pos = this->node_ids_.find(name);
+    if (pos == this->node_ids_.end()) {
+        return {};
+    }
+
+    return pos->second;
+}
+
+void Opm::Network::Topology::buildAdjacency()
+{
+    compressBranches(this->numNodes(), this->branch_uptree_,
+                     this->downtree_start_, this->downtree_branches_);
+
+    compressBranches(this->numNodes(), this->branch_downtree_,
+                     this->uptree_start_, this->uptree_branches_);
+}
+
+void Opm::Network::Topology::buildTopologicalOrder()
+{
+    // Kahn's algorithm.  A node is ready once all of its uptree branches
+    // have been visited.
+    const auto numNodes = this->numNodes();
+
+    auto numPending = std::vector<int>(numNodes);
+    for (auto node = 0; node < numNodes; ++node) {
+        numPending[node] = static_cast<int>(this->uptreeBranches(node).size());
+    }
+
+    auto& order = this->topological_order_;
+    order.reserve(numNodes);
+
+    for (auto node = 0; node < numNodes; ++node) {
+        if (numPending[node] == 0) {
+            order.push_back(node);
+        }
+    }
+
+    for (auto next = 0*order.size(); next < order.size(); ++next) {
+        for (const auto& branch : this->downtreeBranches(order[next])) {
+            const auto downtree = this->downtreeNode(branch);
+            if (--numPending[downtree] == 0) {
+                order.push_back(downtree);
+            }
+        }
+    }
+
+    // Nodes on, or downtree of, a cycle are never ready.  Include them in
+    // ID order to keep the order a permutation of all nodes.
+    if (order.size() < static_cast<std::size_t>(numNodes)) {
+        for (auto node = 0; node < numNodes; ++node) {
+            if (numPending[node] > 0) {
+                order.push_back(node);
+            }
+        }
+    }
+}
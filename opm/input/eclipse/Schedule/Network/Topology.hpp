@@ -0,0 +1,152 @@
+/*
+  Copyright 2024 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NETWORK_TOPOLOGY_HPP
+#define NETWORK_TOPOLOGY_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm { namespace Network {
+    class Branch;
+}} // namespace Opm::Network
+
+namespace Opm { namespace Network {
+
+/// Immutable, index based view of the node/branch structure of an
+/// extended network.
+///
+/// Nodes are identified by integers 0..numNodes()-1 and branches by their
+/// position in the network's branch list.  Adjacency is stored in
+/// compressed sparse row format in both directions, so that iterative
+/// network calculations may traverse the network without string lookups
+/// or memory allocation.
+class Topology
+{
+public:
+    /// Contiguous sequence of branch indices.
+    class BranchRange
+    {
+    public:
+        using const_iterator = std::vector<int>::const_iterator;
+
+        BranchRange(const_iterator begin, const_iterator end)
+            : begin_(begin), end_(end)
+        {}
+
+        const_iterator begin() const { return this->begin_; }
+        const_iterator end() const { return this->end_; }
+
+        std::size_t size() const { return this->end_ - this->begin_; }
+        bool empty() const { return this->begin_ == this->end_; }
+
+        int operator[](const std::size_t i) const { return this->begin_[i]; }
+
+    private:
+        const_iterator begin_;
+        const_iterator end_;
+    };
+
+    /// Constructor.
+    ///
+    /// \param[in] node_names Names of all network nodes.  Node IDs are
+    ///    assigned in this order.
+    ///
+    /// \param[in] branches Network branches.  Both end points of every
+    ///    branch must be in \p node_names.
+    Topology(const std::vector<std::string>& node_names,
+             const std::vector<Branch>&      branches);
+
+    int numNodes() const { return static_cast<int>(this->node_names_.size()); }
+    int numBranches() const { return static_cast<int>(this->branch_uptree_.size()); }
+
+    /// ID of named node.  Nullopt if no such node exists.
+    std::optional<int> nodeId(const std::string& name) const;
+
+    /// Name of node with ID \p node.
+    const std::string& nodeName(const int node) const
+    {
+        return this->node_names_[node];
+    }
+
+    /// ID of uptree node of branch \p branch.
+    int uptreeNode(const int branch) const
+    {
+        return this->branch_uptree_[branch];
+    }
+
+    /// ID of downtree node of branch \p branch.
+    int downtreeNode(const int branch) const
+    {
+        return this->branch_downtree_[branch];
+    }
+
+    /// Branches for which \p node is the uptree node, in branch order.
+    BranchRange downtreeBranches(const int node) const
+    {
+        return this->range(this->downtree_start_, this->downtree_branches_, node);
+    }
+
+    /// Branches for which \p node is the downtree node, in branch order.
+    /// At most one element in a well-formed gathering network.
+    BranchRange uptreeBranches(const int node) const
+    {
+        return this->range(this->uptree_start_, this->uptree_branches_, node);
+    }
+
+    /// All node IDs ordered such that the uptree node of every branch
+    /// precedes its downtree node.  Traverse in reverse for a leaves to
+    /// root sweep.  Nodes on a cycle, if any, are placed last.
+    const std::vector<int>& topologicalOrder() const
+    {
+        return this->topological_order_;
+    }
+
+private:
+    std::vector<std::string> node_names_{};
+    std::unordered_map<std::string, int> node_ids_{};
+
+    std::vector<int> branch_uptree_{};
+    std::vector<int> branch_downtree_{};
+
+    std::vector<int> downtree_start_{};
+    std::vector<int> downtree_branches_{};
+
+    std::vector<int> uptree_start_{};
+    std::vector<int> uptree_branches_{};
+
+    std::vector<int> topological_order_{};
+
+    static BranchRange range(const std::vector<int>& start,
+                             const std::vector<int>& branches,
+                             const int               node)
+    {
+        return { branches.begin() + start[node], branches.begin() + start[node + 1] };
+    }
+
+    void buildAdjacency();
+    void buildTopologicalOrder();
+};
+
+}} // namespace Opm::Network
+
+#endif // NETWORK_TOPOLOGY_HPP
@@ -731,6 +731,8 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
         } else if (report_step >= this->m_sched_deck.size()) {
             throw std::invalid_argument(fmt::format("Well status change for report step {} requested, this exceeds the total number of report steps, being {}.", report_step, this->m_sched_deck.size() - 1));
         }
+        // The action needs the report steps left pending by inserted keywords.
+        this->applyPendingUpdates();
         std::time_t start_time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::from_time_t(0));
         Opm::Action::ActionX action("openwell", 1, 0.0, start_time);
         DeckItem wellItem("WELL", std::string());
@@ -1434,14 +1436,25 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         } else if (reportStep >= this->m_sched_deck.size()) {
             throw std::invalid_argument("Insert keyword for report step " + std::to_string(reportStep) + " requested, this exceeds the total number of report steps, being " + std::to_string(this->m_sched_deck.size() -1) + ".");
         }
+
+        // Keywords for this report step may depend on keywords inserted for an
+        // earlier step whose effect on later steps is still pending.  Only
+        // the steps up to and including this one are needed; the rest stays
+        // pending.
+        this->applyPendingUpdates(reportStep + 1);
+
         ParseContext parseContext;
         ErrorGuard errors;
         ScheduleGrid grid(this->completed_cells);
         SimulatorUpdate sim_update;
         std::unordered_map<std::string, double> target_wellpi;
         std::vector<std::string> matching_wells;
-        const std::string prefix = "| "; /* logger prefix string */
         this->snapshots.resize(reportStep + 1);
+        if (reportStep < this->m_sched_deck.size() - 1) {
+            // Re-evaluating the later report steps is the expensive part; while a
+            // PYACTION script runs it is done once, when the script returns.
+            this->pending_update_step = std::min(reportStep + 1, this->pending_update_step.value_or(reportStep + 1));
+        }
         auto& input_block = this->m_sched_deck[reportStep];
         std::unordered_map<std::string, double> wpimult_global_factor;
         for (auto& keyword : keywords) {
@@ -1465,17 +1478,48 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         }
         this->applyGlobalWPIMULT(wpimult_global_factor);
         this->end_report(reportStep);
-        if (reportStep < this->m_sched_deck.size() - 1) {
-            iterateScheduleSection(
-                reportStep + 1,
-                this->m_sched_deck.size(),
-                parseContext,
-                errors,
-                grid,
-                &target_wellpi,
-                prefix);
-        }
         this->simUpdateFromPython->append(sim_update);
+
+        if (this->pending_update_step.has_value()) {
+            this->pending_target_wellpi.insert(target_wellpi.begin(), target_wellpi.end());
+        }
+        if (!this->defer_python_updates) {
+            this->applyPendingUpdates();
+        }
+    }
+
+    void Schedule::applyPendingUpdates() {
+        this->applyPendingUpdates(this->m_sched_deck.size());
+    }
+
+    void Schedule::applyPendingUpdates(const std::size_t load_end) {
+        if (!this->pending_update_step.has_value() || (*this->pending_update_step >= load_end))
+            return;
+
+        const auto load_start = *this->pending_update_step;
+        auto target_wellpi = this->pending_target_wellpi;
+        if (load_end < this->m_sched_deck.size()) {
+            // The WELPI targets are still needed for the remaining steps.
+            this->pending_update_step = load_end;
+        }
+        else {
+            this->pending_update_step.reset();
+            this->pending_target_wellpi.clear();
+        }
+
+        ParseContext parseContext;
+        ErrorGuard errors;
+        ScheduleGrid grid(this->completed_cells);
+        const std::string prefix = "| "; /* logger prefix string */
+        this->snapshots.resize(load_start);
+        iterateScheduleSection(
+            load_start,
+            load_end,
+            parseContext,
+            errors,
+            grid,
+            &target_wellpi,
+            prefix);
     }
 
 
@@ -1646,12 +1690,34 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         this->current_report_step = reportStep;
 
         // Set up the actionx_callback - simulator updates from this also get appended to simUpdateFromPython.
+        // Report steps left pending by inserted keywords must be in place before the action is applied.
         auto apply_action_callback = [&reportStep, this](const std::string& action_name, const std::vector<std::string>& matching_wells) {
+            this->applyPendingUpdates();
             SimulatorUpdate simUpdateFromActionXCallback = this->applyAction(reportStep, action_name, matching_wells);
             this->simUpdateFromPython->append(simUpdateFromActionXCallback);
         };
 
-        auto result = pyaction.run(ecl_state, *this, reportStep, summary_state, apply_action_callback);
+        // Report steps after keywords inserted by the script are re-evaluated once it returns.
+        this->defer_python_updates = true;
+        bool result = false;
+        try {
+            result = pyaction.run(ecl_state, *this, reportStep, summary_state, apply_action_callback);
+        }
+        catch (...) {
+            // Keywords inserted before the error are kept, as they would have
+            // been without the deferral; complete the schedule before rethrowing.
+            this->defer_python_updates = false;
+            try {
+                this->applyPendingUpdates();
+            }
+            catch (...) {
+                // The error from the script is the one to report.
+            }
+            throw;
+        }
+        this->defer_python_updates = false;
+        this->applyPendingUpdates();
+
         action_state.add_run(pyaction, result);
 
         // The whole pyaction script was executed, now the simUpdateFromPython is returned.
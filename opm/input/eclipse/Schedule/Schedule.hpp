@@ -248,6 +248,11 @@ namespace Opm
           PYACTION is to invoke a "normal" ACTIONX keyword internally from the
           Python code. he return value from runPyAction() comes from such a
           internal ACTIONX.
+
+          Keywords inserted with applyKeywords() while the script runs are
+          applied to their report step immediately, so errors are raised from
+          the insert call. Re-evaluating the later report steps is deferred,
+          and done once when the script returns; see applyPendingUpdates().
         */
         SimulatorUpdate runPyAction(std::size_t reportStep, const Action::PyAction& pyaction, Action::State& action_state, EclipseState& ecl_state, SummaryState& summary_state);
 
@@ -277,6 +282,14 @@ namespace Opm
         static bool cmp(const Schedule& sched1, const Schedule& sched2, std::size_t report_step);
         void applyKeywords(std::vector<std::unique_ptr<DeckKeyword>>& keywords, std::size_t report_step);
         void applyKeywords(std::vector<std::unique_ptr<DeckKeyword>>& keywords);
+        /*
+          While a PYACTION script runs, the report steps after the last step
+          which received keywords from applyKeywords() are not re-evaluated
+          and may be missing. The applyPendingUpdates() function re-evaluates
+          them; code reading the schedule from within a script must call it
+          first. It is a no-op when there are no pending updates.
+        */
+        void applyPendingUpdates();
 
         template<class Serializer>
         void serializeOp(Serializer& serializer)
@@ -479,6 +492,17 @@ namespace Opm
         // It is a shared_ptr, so a Schedule can be constructed using the copy constructor sharing the simUpdateFromPython.
         // The copy constructor is needed for creating a mocked simulator (msim).
         std::shared_ptr<SimulatorUpdate> simUpdateFromPython{};
+        // While runPyAction() executes a script, the first report step which must
+        // be re-evaluated after keywords were inserted, and the WELPI targets of
+        // the inserted keywords. They are only held for the duration of the
+        // script and are therefore neither serialized nor compared.
+        bool defer_python_updates = false;
+        std::optional<std::size_t> pending_update_step{};
+        std::unordered_map<std::string, double> pending_target_wellpi{};
+
+        // Re-evaluates the pending report steps before load_end and leaves
+        // the later ones pending.
+        void applyPendingUpdates(std::size_t load_end);
 
         void load_rst(const RestartIO::RstState& rst,
                       const TracerConfig& tracer_config,
@@ -24,7 +24,10 @@
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
 
+#include <opm/input/eclipse/Schedule/WellTraj/RigEclipseWellLogExtractor.hpp>
+
 #include <cstddef>
+#include <stdexcept>
 #include <string>
 
 #include <fmt/format.h>
@@ -97,3 +100,18 @@ const Opm::EclipseGrid* Opm::ScheduleGrid::get_grid() const
 {
     return this->grid;
 }
+
+const external::cvf::ref<external::cvf::BoundingBoxTree>&
+Opm::ScheduleGrid::get_cell_search_tree() const
+{
+    if (this->grid == nullptr) {
+        throw std::logic_error("Cell search tree requires an EclipseGrid");
+    }
+
+    if (this->cell_search_tree.isNull()) {
+        this->cell_search_tree = external::RigEclipseWellLogExtractor::
+            buildCellSearchTree(*this->grid);
+    }
+
+    return this->cell_search_tree;
+}
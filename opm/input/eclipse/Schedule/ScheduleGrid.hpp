@@ -21,6 +21,8 @@
 
 #include <opm/input/eclipse/Schedule/CompletedCells.hpp>
 
+#include <external/resinsight/LibGeometry/cvfBoundingBoxTree.h>
+
 #include <cstddef>
 #include <string>
 
@@ -47,10 +49,17 @@ public:
 
     const Opm::EclipseGrid* get_grid() const;
 
+    /// Bounding box search tree over the active cells of the grid, for
+    /// intersecting well trajectories (WELTRAJ/COMPTRAJ) with the grid.
+    /// Built on first use and shared by all subsequent wells and report
+    /// steps.  Not safe for concurrent first use.
+    const external::cvf::ref<external::cvf::BoundingBoxTree>& get_cell_search_tree() const;
+
 private:
     const EclipseGrid* grid{nullptr};
     const FieldPropsManager* fp{nullptr};
     CompletedCells& cells;
+    mutable external::cvf::ref<external::cvf::BoundingBoxTree> cell_search_tree{};
 };
 
 } // namespace Opm
@@ -166,6 +166,28 @@ namespace {
         return l;
     }
 
+    template <class T>
+    std::vector<T>
+    var2_values(const map2<T>&                  values,
+                const std::string&              var1,
+                const std::vector<std::string>& var2,
+                const T                         fallback)
+    {
+        auto result = std::vector<T>(var2.size(), fallback);
+
+        const auto var1_iter = values.find(var1);
+        if (var1_iter == values.end())
+            return result;
+
+        for (std::size_t i = 0; i < var2.size(); ++i) {
+            const auto var2_iter = var1_iter->second.find(var2[i]);
+            if (var2_iter != var1_iter->second.end())
+                result[i] = var2_iter->second;
+        }
+
+        return result;
+    }
+
     std::string normalise_region_set_name(const std::string& regSet)
     {
         if (regSet.empty()) {
@@ -750,6 +772,30 @@ namespace Opm
             : groupPos->second;
     }
 
+    std::vector<double>
+    SummaryState::get_well_vars(const std::string&              var,
+                                const std::vector<std::string>& wells,
+                                const double                    default_value) const
+    {
+        const auto fallback = is_well_udq(var)
+            ? this->udq_undefined
+            : default_value;
+
+        return var2_values(this->well_values, var, wells, fallback);
+    }
+
+    std::vector<double>
+    SummaryState::get_group_vars(const std::string&              var,
+                                 const std::vector<std::string>& groups,
+                                 const double                    default_value) const
+    {
+        const auto fallback = is_group_udq(var)
+            ? this->udq_undefined
+            : default_value;
+
+        return var2_values(this->group_values, var, groups, fallback);
+    }
+
     double SummaryState::get_conn_var(const std::string& well,
                                       const std::string& var,
                                       const std::size_t  global_index,
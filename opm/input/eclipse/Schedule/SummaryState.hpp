@@ -125,6 +125,13 @@ public:
     double get_segment_var(const std::string& well, const std::string& var, std::size_t segment, double) const;
     double get_region_var(const std::string& regSet, const std::string& var, std::size_t region, double) const;
 
+    // Values of variable 'var' for each of the given wells or groups, with
+    // the same fallback as get_well_var()/get_group_var() with a default
+    // value.  The variable is looked up once for all wells or groups; UDQ
+    // results are included since update_udq() stores them here.
+    std::vector<double> get_well_vars(const std::string& var, const std::vector<std::string>& wells, double default_value) const;
+    std::vector<double> get_group_vars(const std::string& var, const std::vector<std::string>& groups, double default_value) const;
+
     const std::vector<std::string>& wells() const;
     std::vector<std::string> wells(const std::string& var) const;
     const std::vector<std::string>& groups() const;
@@ -109,11 +109,13 @@ namespace Opm {
                              const std::string& var) const
     {
         if (is_udq(var)) {
-            if (this->udq_state.has_well_var(well, var)) {
-                return this->udq_state.get_well_var(well, var);
+            const auto varID = this->udq_state.well_var_handle(var);
+            const auto wellID = this->udq_state.well_handle(well);
+            if (! varID.has_value() || ! wellID.has_value()) {
+                return std::nullopt;
             }
 
-            return std::nullopt;
+            return this->udq_state.well_value(*varID, *wellID);
         }
 
         if (this->summary_state.has_well_var(var)) {
@@ -134,11 +136,13 @@ namespace Opm {
                               const std::string& var) const
     {
         if (is_udq(var)) {
-            if (this->udq_state.has_group_var(group, var)) {
-                return this->udq_state.get_group_var(group, var);
+            const auto varID = this->udq_state.group_var_handle(var);
+            const auto groupID = this->udq_state.group_handle(group);
+            if (! varID.has_value() || ! groupID.has_value()) {
+                return std::nullopt;
             }
 
-            return std::nullopt;
+            return this->udq_state.group_value(*varID, *groupID);
         }
 
         if (this->summary_state.has_group_var(var)) {
@@ -21,30 +21,20 @@
 
 #include <opm/io/eclipse/rst/state.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <utility>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
 namespace {
 
-template <typename K, typename V>
-using UMap = std::unordered_map<K, V>;
-
-template <typename V>
-using SMap = UMap<std::string, V>;
-
-template <typename T>
-using S2Map = SMap<SMap<T>>;
-
-template <typename K, typename V>
-using SKMap = SMap<UMap<K, V>>;
-
-template <typename K, typename V>
-using S2KMap = S2Map<UMap<K, V>>;
+using EntityValues = std::vector<std::optional<double>>;
 
 bool is_udq(const std::string& key)
 {
@@ -52,137 +42,160 @@ bool is_udq(const std::string& key)
         && (key[1] == 'U');
 }
 
-bool has_var(const S2Map<double>& values,
-             const std::string&   wgname,
-             const std::string&   udq_key)
+std::optional<double> value_at(const EntityValues& values,
+                               const std::size_t   i)
 {
-    auto res_iter = values.find(udq_key);
-    return (res_iter != values.end())
-        && (res_iter->second.count(wgname) > 0);
+    return (i < values.size()) ? values[i] : std::nullopt;
 }
 
-void undefine_results(const Opm::UDQScalar& result,
-                      SMap<double>&         values)
+void assign_at(EntityValues&                values,
+               const std::size_t            i,
+               const std::optional<double>& value)
 {
-    values.erase(result.wgname());
-}
+    if (i >= values.size()) {
+        if (! value.has_value()) {
+            // Nothing to undefine.
+            return;
+        }
 
-void undefine_results(const Opm::UDQScalar&       result,
-                      SKMap<std::size_t, double>& values)
-{
-    auto wellPos = values.find(result.wgname());
-    if (wellPos == values.end()) {
-        // No results for this well.  Nothing to do.
-        return;
+        values.resize(i + 1);
     }
 
-    wellPos->second.erase(result.number());
+    values[i] = value;
 }
 
-void add_defined_results(const Opm::UDQScalar& result,
-                         SMap<double>&         values)
+std::optional<double> value_at(const EntityValues&                values,
+                               const std::optional<std::size_t>& i)
 {
-    values.insert_or_assign(result.wgname(), result.get());
+    return i.has_value() ? value_at(values, *i) : std::nullopt;
 }
 
-void add_defined_results(const Opm::UDQScalar&       result,
-                         SKMap<std::size_t, double>& values)
+// Values equal up to trailing undefined entries.
+bool equal_values(const EntityValues& values1, const EntityValues& values2)
 {
-    auto wellPos = values.find(result.wgname());
-    if (wellPos == values.end()) {
-        values.insert_or_assign(result.wgname(), std::unordered_map<std::size_t, double>
-                                {{ result.number(), result.get() }});
-
-        return;
+    const auto n = std::max(values1.size(), values2.size());
+    for (auto i = std::size_t{0}; i < n; ++i) {
+        if (value_at(values1, i) != value_at(values2, i)) {
+            return false;
+        }
     }
 
-    wellPos->second.insert_or_assign(result.number(), result.get());
+    return true;
 }
 
-void add_results(const std::string& udq_key,
-                 const Opm::UDQSet& result,
-                 S2Map<double>&     values)
+template <typename T>
+const T& entry_at(const std::vector<T>& values, const std::optional<std::size_t>& i)
 {
-    auto& udq_values = values[udq_key];
-    for (const auto& res1 : result) {
-        if (! res1.defined()) {
-            undefine_results(res1, udq_values);
-        }
-        else {
-            add_defined_results(res1, udq_values);
-        }
-    }
+    static const T empty{};
+    return (i.has_value() && (*i < values.size())) ? values[*i] : empty;
 }
 
-void add_results(const std::string&           udq_key,
-                 const Opm::UDQSet&           result,
-                 S2KMap<std::size_t, double>& values)
+// Whether equal(i1, i2) holds for the positions i1 and i2 of every name
+// in either of the indices, independently of the order in which the
+// names were inserted.  Positions are nullopt for missing names.
+template <typename Index, typename Equal>
+bool equal_by_name(const Index& index1, const Index& index2, Equal&& equal)
 {
-    auto& udq_values = values[udq_key];
-    for (const auto& res1 : result) {
-        if (! res1.defined()) {
-            undefine_results(res1, udq_values);
+    for (const auto& name : index1.names()) {
+        if (! equal(index1.find(name), index2.find(name))) {
+            return false;
         }
-        else {
-            add_defined_results(res1, udq_values);
+    }
+
+    for (const auto& name : index2.names()) {
+        if (! index1.find(name).has_value() &&
+            ! equal(std::optional<std::size_t>{}, index2.find(name)))
+        {
+            return false;
         }
     }
+
+    return true;
 }
 
-double get_scalar(const SMap<double>& values,
-                  const std::string&  udq_key,
-                  const double        undef_value)
+template <typename Index>
+bool equal_wg_values(const Index& names1, const EntityValues& udq1,
+                     const Index& names2, const EntityValues& udq2)
 {
-    auto iter = values.find(udq_key);
-    if (iter == values.end()) {
-        return undef_value;
-    }
+    return equal_by_name(names1, names2, [&udq1, &udq2](const auto& i1, const auto& i2)
+    {
+        return value_at(udq1, i1) == value_at(udq2, i2);
+    });
+}
 
-    return iter->second;
+template <typename Index>
+bool equal_segment_values(const Index& names1, const std::vector<EntityValues>& udq1,
+                          const Index& names2, const std::vector<EntityValues>& udq2)
+{
+    return equal_by_name(names1, names2, [&udq1, &udq2](const auto& i1, const auto& i2)
+    {
+        return equal_values(entry_at(udq1, i1), entry_at(udq2, i2));
+    });
 }
 
-double get_wg(const S2Map<double>& values,
-              const std::string&   wgname,
-              const std::string&   udq_key,
-              const double         undef_value)
+template <typename T>
+T& value_slot(std::vector<T>& values, const std::size_t var)
 {
-    auto res_iter = values.find(udq_key);
-    if (res_iter == values.end()) {
-        if (is_udq(udq_key)) {
-            throw std::out_of_range("No such UDQ variable: " + udq_key);
-        }
-        else {
-            throw std::logic_error("No such UDQ variable: " + udq_key);
-        }
+    if (var >= values.size()) {
+        values.resize(var + 1);
     }
 
-    return get_scalar(res_iter->second, wgname, undef_value);
+    return values[var];
+}
+
+[[noreturn]] void throw_unknown_variable(const std::string& udq_key)
+{
+    if (is_udq(udq_key)) {
+        throw std::out_of_range("No such UDQ variable: " + udq_key);
+    }
+    else {
+        throw std::logic_error("No such UDQ variable: " + udq_key);
+    }
 }
 
 } // Anonymous namespace
 
 namespace Opm {
 
+std::optional<std::size_t>
+UDQState::NameIndex::find(const std::string& name) const
+{
+    auto pos = this->index.find(name);
+    if (pos == this->index.end()) {
+        return std::nullopt;
+    }
+
+    return pos->second;
+}
+
+std::size_t UDQState::NameIndex::insert(const std::string& name)
+{
+    auto [pos, inserted] = this->index.try_emplace(name, this->names_.size());
+    if (inserted) {
+        this->names_.push_back(name);
+    }
+
+    return pos->second;
+}
+
 void UDQState::load_rst(const RestartIO::RstState& rst_state)
 {
     for (const auto& udq : rst_state.udqs) {
         if (udq.is_define()) {
             if (udq.var_type == UDQVarType::WELL_VAR) {
-                auto& values = this->well_values[udq.name];
                 for (const auto& [wname, value] : udq.values()) {
-                    values.insert_or_assign(wname, value);
+                    this->set_well_var(udq.name, wname, value);
                 }
             }
 
             if (udq.var_type == UDQVarType::GROUP_VAR) {
-                auto& values = this->group_values[udq.name];
                 for (const auto& [gname, value] : udq.values()) {
-                    values.insert_or_assign(gname, value);
+                    this->set_group_var(udq.name, gname, value);
                 }
             }
 
             if (const auto& field_value = udq.field_value(); field_value.has_value()) {
-                this->scalar_values[udq.name] = field_value.value();
+                this->set_scalar(udq.name, field_value.value());
             }
         }
         else {
@@ -191,21 +204,19 @@ void UDQState::load_rst(const RestartIO::RstState& rst_state)
             if ((udq.var_type == UDQVarType::WELL_VAR) &&
                 ! udq.assign_selector().empty())
             {
-                auto& values = this->well_values[udq.name];
                 for (const auto& wname : udq.assign_selector()) {
-                    values.insert_or_assign(wname, value);
+                    this->set_well_var(udq.name, wname, value);
                 }
             }
 
             if (udq.var_type == UDQVarType::GROUP_VAR) {
-                auto& values = this->group_values[udq.name];
                 for (const auto& gname : udq.assign_selector()) {
-                    values.insert_or_assign(gname, value);
+                    this->set_group_var(udq.name, gname, value);
                 }
             }
 
             if (udq.var_type == UDQVarType::FIELD_VAR) {
-                this->scalar_values[udq.name] = value;
+                this->set_scalar(udq.name, value);
             }
         }
     }
@@ -222,34 +233,143 @@ UDQState::UDQState(double undefined)
 
 bool UDQState::has(const std::string& key) const
 {
-    return this->scalar_values.count(key);
+    const auto var = this->scalar_keys.find(key);
+    return var.has_value()
+        && value_at(this->scalar_values, *var).has_value();
 }
 
 bool UDQState::has_well_var(const std::string& well, const std::string& key) const
 {
-    return has_var(this->well_values, well, key);
+    const auto var = this->well_var_handle(key);
+    const auto wellID = this->well_handle(well);
+
+    return var.has_value() && wellID.has_value()
+        && this->well_value(*var, *wellID).has_value();
 }
 
 bool UDQState::has_group_var(const std::string& group, const std::string& key) const
 {
-    return has_var(this->group_values, group, key);
+    const auto var = this->group_var_handle(key);
+    const auto groupID = this->group_handle(group);
+
+    return var.has_value() && groupID.has_value()
+        && this->group_value(*var, *groupID).has_value();
 }
 
 bool UDQState::has_segment_var(const std::string& well,
                                const std::string& key,
                                const std::size_t  segment) const
 {
-    auto varPos = this->segment_values.find(key);
-    if (varPos == this->segment_values.end()) {
+    const auto var = this->segment_keys.find(key);
+    const auto wellID = this->well_handle(well);
+    if (! var.has_value() || ! wellID.has_value()) {
         return false;
     }
 
-    auto wellPos = varPos->second.find(well);
-    if (wellPos == varPos->second.end()) {
-        return false;
+    const auto& udq_values = this->segment_values[*var];
+    return (*wellID < udq_values.size())
+        && value_at(udq_values[*wellID], segment).has_value();
+}
+
+std::optional<std::size_t> UDQState::well_var_handle(const std::string& key) const
+{
+    return this->well_keys.find(key);
+}
+
+std::optional<std::size_t> UDQState::group_var_handle(const std::string& key) const
+{
+    return this->group_keys.find(key);
+}
+
+std::optional<std::size_t> UDQState::well_handle(const std::string& well) const
+{
+    return this->well_names.find(well);
+}
+
+std::optional<std::size_t> UDQState::group_handle(const std::string& group) const
+{
+    return this->group_names.find(group);
+}
+
+std::optional<double> UDQState::well_value(const std::size_t var, const std::size_t well) const
+{
+    return (var < this->well_values.size())
+        ? value_at(this->well_values[var], well)
+        : std::nullopt;
+}
+
+std::optional<double> UDQState::group_value(const std::size_t var, const std::size_t group) const
+{
+    return (var < this->group_values.size())
+        ? value_at(this->group_values[var], group)
+        : std::nullopt;
+}
+
+void UDQState::add_wg_results(const std::string&         udq_key,
+                              const UDQSet&              result,
+                              NameIndex&                 keys,
+                              NameIndex&                 names,
+                              std::vector<EntityValues>& values)
+{
+    auto& udq_values = value_slot(values, keys.insert(udq_key));
+    for (const auto& res1 : result) {
+        if (! res1.defined()) {
+            if (const auto entity = names.find(res1.wgname()); entity.has_value()) {
+                assign_at(udq_values, *entity, std::nullopt);
+            }
+        }
+        else {
+            assign_at(udq_values, names.insert(res1.wgname()), res1.get());
+        }
+    }
+}
+
+void UDQState::add_segment_results(const std::string& udq_key, const UDQSet& result)
+{
+    auto& udq_values = value_slot(this->segment_values, this->segment_keys.insert(udq_key));
+    for (const auto& res1 : result) {
+        if (! res1.defined()) {
+            const auto well = this->well_names.find(res1.wgname());
+            if (well.has_value() && (*well < udq_values.size())) {
+                assign_at(udq_values[*well], res1.number(), std::nullopt);
+            }
+        }
+        else {
+            auto& well_values = value_slot(udq_values, this->well_names.insert(res1.wgname()));
+            assign_at(well_values, res1.number(), res1.get());
+        }
+    }
+}
+
+void UDQState::set_scalar(const std::string& udq_key, const std::optional<double>& value)
+{
+    if (! value.has_value() && ! this->scalar_keys.find(udq_key).has_value()) {
+        return;
     }
 
-    return wellPos->second.find(segment) != wellPos->second.end();
+    const auto var = this->scalar_keys.insert(udq_key);
+    value_slot(this->scalar_values, var) = value;
+}
+
+void UDQState::set_well_var(const std::string& udq_key, const std::string& well, const double value)
+{
+    auto& udq_values = value_slot(this->well_values, this->well_keys.insert(udq_key));
+    assign_at(udq_values, this->well_names.insert(well), value);
+}
+
+void UDQState::set_group_var(const std::string& udq_key, const std::string& group, const double value)
+{
+    auto& udq_values = value_slot(this->group_values, this->group_keys.insert(udq_key));
+    assign_at(udq_values, this->group_names.insert(group), value);
+}
+
+void UDQState::set_segment_var(const std::string&           udq_key,
+                               const std::string&           well,
+                               const std::size_t            segment,
+                               const std::optional<double>& value)
+{
+    auto& udq_values = value_slot(this->segment_values, this->segment_keys.insert(udq_key));
+    assign_at(value_slot(udq_values, this->well_names.insert(well)), segment, value);
 }
 
 void UDQState::add(const std::string& udq_key, const UDQSet& result)
@@ -262,24 +382,26 @@ void UDQState::add(const std::string& udq_key, const UDQSet& result)
 
     switch (result.var_type()) {
     case UDQVarType::WELL_VAR:
-        add_results(udq_key, result, this->well_values);
+        this->add_wg_results(udq_key, result, this->well_keys,
+                             this->well_names, this->well_values);
         break;
 
     case UDQVarType::GROUP_VAR:
-        add_results(udq_key, result, this->group_values);
+        this->add_wg_results(udq_key, result, this->group_keys,
+                             this->group_names, this->group_values);
         break;
 
     case UDQVarType::SEGMENT_VAR:
-        add_results(udq_key, result, this->segment_values);
+        this->add_segment_results(udq_key, result);
         break;
 
     default:
         // Scalar
         if (const auto& scalar = result[0]; scalar.defined()) {
-            this->scalar_values.insert_or_assign(udq_key, scalar.get());
+            this->set_scalar(udq_key, scalar.get());
         }
         else {
-            this->scalar_values.erase(udq_key);
+            this->set_scalar(udq_key, std::nullopt);
         }
         break;
     }
@@ -302,21 +424,41 @@ double UDQState::get(const std::string& key) const
         throw std::logic_error("Key is not a UDQ variable:" + key);
     }
 
-    auto iter = this->scalar_values.find(key);
-    if (iter == this->scalar_values.end())
+    const auto var = this->scalar_keys.find(key);
+    const auto value = var.has_value()
+        ? value_at(this->scalar_values, *var)
+        : std::nullopt;
+
+    if (! value.has_value())
         throw std::out_of_range("Invalid key: " + key);
 
-    return iter->second;
+    return *value;
 }
 
 double UDQState::get_group_var(const std::string& group, const std::string& key) const
 {
-    return get_wg(this->group_values, group, key, this->undef_value);
+    const auto var = this->group_var_handle(key);
+    if (! var.has_value()) {
+        throw_unknown_variable(key);
+    }
+
+    const auto groupID = this->group_handle(group);
+    return groupID.has_value()
+        ? this->group_value(*var, *groupID).value_or(this->undef_value)
+        : this->undef_value;
 }
 
 double UDQState::get_well_var(const std::string& well, const std::string& key) const
 {
-    return get_wg(this->well_values, well, key, this->undef_value);
+    const auto var = this->well_var_handle(key);
+    if (! var.has_value()) {
+        throw_unknown_variable(key);
+    }
+
+    const auto wellID = this->well_handle(well);
+    return wellID.has_value()
+        ? this->well_value(*var, *wellID).value_or(this->undef_value)
+        : this->undef_value;
 }
 
 double UDQState::get_segment_var(const std::string& well,
@@ -329,23 +471,24 @@ double UDQState::get_segment_var(const std::string& well,
         };
     }
 
-    auto varPos = this->segment_values.find(var);
-    if (varPos == this->segment_values.end()) {
+    const auto varID = this->segment_keys.find(var);
+    if (! varID.has_value()) {
         throw std::out_of_range {
             fmt::format("'{}' is not a valid segment UDQ variable", var)
         };
     }
 
-    auto wellPos = varPos->second.find(well);
-    if (wellPos == varPos->second.end()) {
+    const auto& udq_values = this->segment_values[*varID];
+    const auto wellID = this->well_handle(well);
+    if (! wellID.has_value() || (*wellID >= udq_values.size()) || udq_values[*wellID].empty()) {
         throw std::out_of_range {
             fmt::format("'{}' is not a valid segment UDQ "
                         "variable for well '{}'", var, well)
         };
     }
 
-    auto valPos = wellPos->second.find(segment);
-    if (valPos == wellPos->second.end()) {
+    const auto value = value_at(udq_values[*wellID], segment);
+    if (! value.has_value()) {
         throw std::invalid_argument {
             fmt::format("'{}' is not a valid segment UDQ "
                         "variable for segment {} in well '{}'",
@@ -353,16 +496,45 @@ double UDQState::get_segment_var(const std::string& well,
         };
     }
 
-    return valPos->second;
+    return *value;
 }
 
 bool UDQState::operator==(const UDQState& other) const
 {
+    // Names are numbered in order of first insertion and undefined values
+    // may or may not occupy a slot, so compare values by name.
+    const auto equal_scalars = [this, &other](const auto& var1, const auto& var2)
+    {
+        return value_at(this->scalar_values, var1) == value_at(other.scalar_values, var2);
+    };
+
+    // Known variables are known irrespective of their values.
+    const auto equal_well_vars = [this, &other](const auto& var1, const auto& var2)
+    {
+        return (var1.has_value() == var2.has_value())
+            && equal_wg_values(this->well_names, entry_at(this->well_values, var1),
+                               other.well_names, entry_at(other.well_values, var2));
+    };
+
+    const auto equal_group_vars = [this, &other](const auto& var1, const auto& var2)
+    {
+        return (var1.has_value() == var2.has_value())
+            && equal_wg_values(this->group_names, entry_at(this->group_values, var1),
+                               other.group_names, entry_at(other.group_values, var2));
+    };
+
+    const auto equal_segment_vars = [this, &other](const auto& var1, const auto& var2)
+    {
+        return (var1.has_value() == var2.has_value())
+            && equal_segment_values(this->well_names, entry_at(this->segment_values, var1),
+                                    other.well_names, entry_at(other.segment_values, var2));
+    };
+
     return (this->undef_value == other.undef_value)
-        && (this->scalar_values == other.scalar_values)
-        && (this->well_values == other.well_values)
-        && (this->group_values == other.group_values)
-        && (this->segment_values == other.segment_values)
+        && equal_by_name(this->scalar_keys, other.scalar_keys, equal_scalars)
+        && equal_by_name(this->well_keys, other.well_keys, equal_well_vars)
+        && equal_by_name(this->group_keys, other.group_keys, equal_group_vars)
+        && equal_by_name(this->segment_keys, other.segment_keys, equal_segment_vars)
         && (this->defines == other.defines);
 }
 
@@ -370,39 +542,31 @@ UDQState UDQState::serializationTestObject()
 {
     UDQState st;
     st.undef_value = 78;
-    st.scalar_values = {{"FU1", 100}, {"FU2", 200}};
+    st.set_scalar("FU1", 100);
+    st.set_scalar("FU2", 200);
     st.defines = {{"DU1", 299}, {"DU2", 399}};
 
-    st.well_values.emplace("W1", std::unordered_map<std::string, double>{{"U1", 100}, {"U2", 200}});
-    st.well_values.emplace("W2", std::unordered_map<std::string, double>{{"U1", 700}, {"32", 600}});
+    st.set_well_var("WU1", "W1", 100);
+    st.set_well_var("WU2", "W1", 200);
+    st.set_well_var("WU1", "W2", 700);
+    st.set_well_var("WU3", "W2", 600);
 
-    st.group_values.emplace("G1", std::unordered_map<std::string, double>{{"U1", 100}, {"U2", 200}});
-    st.group_values.emplace("G2", std::unordered_map<std::string, double>{{"U1", 700}, {"32", 600}});
+    st.set_group_var("GU1", "G1", 100);
+    st.set_group_var("GU2", "G1", 200);
+    st.set_group_var("GU1", "G2", 700);
+    st.set_group_var("GU3", "G2", 600);
 
-    {
-        auto& sval = st.segment_values["SU1"];
-        sval.emplace("W1", std::unordered_map<std::size_t, double> {
-                { std::size_t{ 1},  123.456   },
-                { std::size_t{ 2},   17.29    },
-                { std::size_t{10}, -  2.71828 },
-            });
-
-        sval.emplace("W6", std::unordered_map<std::size_t, double> {
-                { std::size_t{ 7}, 3.1415926535 },
-            });
-    }
+    st.set_segment_var("SU1", "W1", std::size_t{ 1},  123.456);
+    st.set_segment_var("SU1", "W1", std::size_t{ 2},   17.29);
+    st.set_segment_var("SU1", "W1", std::size_t{10}, -  2.71828);
+    st.set_segment_var("SU1", "W6", std::size_t{ 7}, 3.1415926535);
 
-    {
-        auto& sval = st.segment_values["SUVIS"];
-        sval.emplace("I2", std::unordered_map<std::size_t, double> {
-                { std::size_t{17},  29.0   },
-                { std::size_t{42}, - 1.618 },
-            });
-    }
+    st.set_segment_var("SUVIS", "I2", std::size_t{17},  29.0);
+    st.set_segment_var("SUVIS", "I2", std::size_t{42}, - 1.618);
 
     // Deliberately creating an element with an empty value.  Not likely to
     // occur in a real run, but we should be able to handle that case too.
-    st.segment_values["SUSPECT"];
+    value_slot(st.segment_values, st.segment_keys.insert("SUSPECT"));
 
     return st;
 }
@@ -23,6 +23,7 @@
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 
 #include <cstddef>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -52,6 +53,20 @@ public:
     double get_well_var(const std::string& well, const std::string& var) const;
     double get_segment_var(const std::string& well, const std::string& var, const std::size_t segment) const;
 
+    // Integer handles of UDQ variables and of the wells and groups for
+    // which they have values.  Handles remain valid for the lifetime of
+    // the state object, so callers which look up the same variables for
+    // many wells or groups may resolve the names once and use
+    // well_value() and group_value() to bypass the string lookups.
+    // Functions return nullopt for unknown names or undefined values.
+    std::optional<std::size_t> well_var_handle(const std::string& key) const;
+    std::optional<std::size_t> group_var_handle(const std::string& key) const;
+    std::optional<std::size_t> well_handle(const std::string& well) const;
+    std::optional<std::size_t> group_handle(const std::string& group) const;
+
+    std::optional<double> well_value(const std::size_t var, const std::size_t well) const;
+    std::optional<double> group_value(const std::size_t var, const std::size_t group) const;
+
     void add_define(std::size_t report_step, const std::string& udq_key, const UDQSet& result);
     void add_assign(const std::string& udq_key, const UDQSet& result);
     bool define(const std::string& udq_key, const std::pair<UDQUpdate, std::size_t>& update_status) const;
@@ -65,30 +80,82 @@ public:
     void serializeOp(Serializer& serializer)
     {
         serializer(this->undef_value);
+        serializer(this->scalar_keys);
         serializer(this->scalar_values);
+        serializer(this->well_keys);
         serializer(this->well_values);
+        serializer(this->group_keys);
         serializer(this->group_values);
+        serializer(this->segment_keys);
         serializer(this->segment_values);
+        serializer(this->well_names);
+        serializer(this->group_names);
         serializer(this->defines);
     }
 
 private:
+    // Dense numbering of a set of names, in order of first insertion.
+    class NameIndex
+    {
+    public:
+        std::optional<std::size_t> find(const std::string& name) const;
+        std::size_t insert(const std::string& name);
+
+        const std::vector<std::string>& names() const
+        {
+            return this->names_;
+        }
+
+        template <class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(this->index);
+            serializer(this->names_);
+        }
+
+    private:
+        std::unordered_map<std::string, std::size_t> index{};
+        std::vector<std::string> names_{};
+    };
+
+    // Values of a single variable, indexed by well or group handle.
+    using EntityValues = std::vector<std::optional<double>>;
+
     double undef_value;
-    std::unordered_map<std::string, double> scalar_values{};
+
+    // [var] -> double
+    NameIndex scalar_keys{};
+    std::vector<std::optional<double>> scalar_values{};
 
     // [var][well] -> double
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> well_values{};
+    NameIndex well_keys{};
+    std::vector<EntityValues> well_values{};
 
     // [var][group] -> double
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> group_values{};
+    NameIndex group_keys{};
+    std::vector<EntityValues> group_values{};
 
     // [var][well][segment] -> double
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> segment_values{};
+    NameIndex segment_keys{};
+    std::vector<std::vector<EntityValues>> segment_values{};
+
+    NameIndex well_names{};
+    NameIndex group_names{};
 
     std::unordered_map<std::string, std::size_t> defines;
 
     void add(const std::string& udq_key, const UDQSet& result);
-    double get_wg_var(const std::string& well, const std::string& key, UDQVarType var_type) const;
+    void add_wg_results(const std::string& udq_key,
+                        const UDQSet& result,
+                        NameIndex& keys,
+                        NameIndex& names,
+                        std::vector<EntityValues>& values);
+    void add_segment_results(const std::string& udq_key, const UDQSet& result);
+    void set_scalar(const std::string& udq_key, const std::optional<double>& value);
+    void set_well_var(const std::string& udq_key, const std::string& well, const double value);
+    void set_group_var(const std::string& udq_key, const std::string& group, const double value);
+    void set_segment_var(const std::string& udq_key, const std::string& well,
+                         const std::size_t segment, const std::optional<double>& value);
 };
 
 } // namespace Opm
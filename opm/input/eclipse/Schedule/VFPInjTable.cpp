@@ -30,6 +30,11 @@
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
 #include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
+#include <opm/input/eclipse/Schedule/VFPInterpolation.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 //Anonymous namespace
 namespace {
@@ -46,6 +51,9 @@ inline const Opm::DeckItem& getNonEmptyItem( const Opm::DeckRecord& record) {
     return retval;
 }
 
+// Batches smaller than this are interpolated by a single thread.
+constexpr auto minParallelInterpolationSize = std::size_t{1024};
+
 } //Namespace
 
 
@@ -343,4 +351,39 @@ std::array<size_t,2> VFPInjTable::shape() const {
 }
 
 
+void VFPInjTable::interpolate(const std::vector<EvaluationPoint>& points,
+                              std::vector<InterpolatedBHP>& result) const
+{
+    using VFPInterpolation::axisPosition;
+
+    result.resize(points.size());
+
+    const auto nf = this->m_flo_data.size();
+    const auto thp_step = (this->m_thp_data.size() > 1) ? nf : 0;
+    const auto flo_step = (nf > 1) ? 1 : 0;
+
+    const auto* data = this->m_data.data();
+    const auto size = static_cast<std::int64_t>(points.size());
+
+#pragma omp parallel for schedule(static) if (points.size() >= minParallelInterpolationSize)
+    for (std::int64_t i = 0; i < size; ++i) {
+        const auto thp = axisPosition(this->m_thp_data, points[i].thp);
+        const auto flo = axisPosition(this->m_flo_data, points[i].flo);
+
+        const auto* v00 = data + thp.index*nf + flo.index;
+        const auto* v10 = v00 + thp_step;
+
+        // Interpolate along FLO at the two THP end points.
+        const auto lower = v00[0] + flo.factor*(v00[flo_step] - v00[0]);
+        const auto upper = v10[0] + flo.factor*(v10[flo_step] - v10[0]);
+
+        auto& bhp = result[i];
+        bhp.bhp  = lower + thp.factor*(upper - lower);
+        bhp.dthp = (upper - lower) * thp.inverseDistance;
+        bhp.dflo = ((1.0 - thp.factor)*(v00[flo_step] - v00[0]) +
+                    thp.factor*(v10[flo_step] - v10[0])) * flo.inverseDistance;
+    }
+}
+
+
 } //Namespace
@@ -99,6 +99,34 @@ public:
 
     double operator()(size_t thp_idx, size_t flo_idx) const;
 
+    /**
+     * Coordinates, in SI units, at which to evaluate the table.
+     */
+    struct EvaluationPoint {
+        double flo;
+        double thp;
+    };
+
+    /**
+     * Interpolated bottom hole pressure and its partial derivatives with
+     * respect to each of the table's axes.
+     */
+    struct InterpolatedBHP {
+        double bhp;
+        double dflo;
+        double dthp;
+    };
+
+    /**
+     * Evaluate the bottom hole pressure at many points, e.g., one per
+     * well, by bilinear interpolation in the table.  Values outside an
+     * axis' range are extrapolated linearly.
+     *
+     * Large batches are evaluated in parallel.
+     */
+    void interpolate(const std::vector<EvaluationPoint>& points,
+                     std::vector<InterpolatedBHP>& result) const;
+
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
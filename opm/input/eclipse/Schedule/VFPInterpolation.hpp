@@ -0,0 +1,67 @@
+/*
+  Copyright 2024 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_VFP_INTERPOLATION_HPP
+#define OPM_VFP_INTERPOLATION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace Opm { namespace VFPInterpolation {
+
+// Position of a value relative to a VFP table axis.  Interpolate between
+// axis[index] and axis[index + 1] using weights 1-factor and factor.
+// Values outside the axis range are extrapolated linearly from the first
+// or last interval.  Single-point axes have index 0 and zero factor and
+// inverse distance.
+struct AxisPosition
+{
+    std::size_t index{0};
+    double factor{0.0};
+    double inverseDistance{0.0};
+};
+
+inline AxisPosition axisPosition(const std::vector<double>& axis, const double value)
+{
+    auto pos = AxisPosition{};
+
+    if (axis.size() < 2) {
+        return pos;
+    }
+
+    // First element strictly greater than value, limited to the interior
+    // so that end points fall into the first and last intervals.
+    const auto upper = std::upper_bound(axis.begin() + 1, axis.end() - 1, value);
+
+    pos.index = static_cast<std::size_t>(upper - axis.begin()) - 1;
+
+    const auto start = axis[pos.index];
+    const auto end   = axis[pos.index + 1];
+    if (end > start) {
+        pos.inverseDistance = 1.0 / (end - start);
+        pos.factor = (value - start) * pos.inverseDistance;
+    }
+
+    return pos;
+}
+
+}} // namespace Opm::VFPInterpolation
+
+#endif // OPM_VFP_INTERPOLATION_HPP
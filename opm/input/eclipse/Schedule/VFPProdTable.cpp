@@ -32,8 +32,14 @@
 #include <opm/input/eclipse/Units/Dimension.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include <opm/input/eclipse/Schedule/VFPInterpolation.hpp>
 #include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 
 namespace Opm {
 
@@ -117,6 +123,9 @@ VFPProdTable::ALQ_TYPE getALQType( const DeckItem& item, bool gaslift_opt_active
     }
 }
 
+// Batches smaller than this are interpolated by a single thread.
+constexpr auto minParallelInterpolationSize = std::size_t{1024};
+
 }
 
 
@@ -605,4 +614,101 @@ std::array<size_t,5> VFPProdTable::shape() const {
     return {nt, nw, ng, na, nf};
 }
 
+
+void VFPProdTable::interpolate(const std::vector<EvaluationPoint>& points,
+                               std::vector<InterpolatedBHP>& result) const
+{
+    using VFPInterpolation::axisPosition;
+
+    result.resize(points.size());
+    if (points.empty()) {
+        return;
+    }
+
+    // Axes in table order, FLO innermost.  Bit 4-k of a corner number
+    // selects the upper end point along axis k.  The two FLO corners are
+    // therefore adjacent in m_data, and the 32 corners of a hypercube
+    // form 16 contiguous pairs.
+    const auto shape = this->shape();
+
+    auto stride = std::array<std::size_t,5>{};
+    stride[4] = 1;
+    for (auto k = 4; k > 0; --k) {
+        stride[k - 1] = stride[k] * shape[k];
+    }
+
+    auto corner_offset = std::array<std::size_t,32>{};
+    for (auto corner = 0; corner < 32; ++corner) {
+        for (auto k = 0; k < 5; ++k) {
+            if (((corner >> (4 - k)) & 1) && (shape[k] > 1)) {
+                corner_offset[corner] += stride[k];
+            }
+        }
+    }
+
+    const auto* data = this->m_data.data();
+    const auto size = static_cast<std::int64_t>(points.size());
+
+#pragma omp parallel for schedule(static) if (points.size() >= minParallelInterpolationSize)
+    for (std::int64_t i = 0; i < size; ++i) {
+        const auto& point = points[i];
+
+        const auto pos = std::array {
+            axisPosition(this->m_thp_data, point.thp),
+            axisPosition(this->m_wfr_data, point.wfr),
+            axisPosition(this->m_gfr_data, point.gfr),
+            axisPosition(this->m_alq_data, point.alq),
+            axisPosition(this->m_flo_data, point.flo),
+        };
+
+        auto base = std::size_t{0};
+        for (auto k = 0; k < 5; ++k) {
+            base += pos[k].index * stride[k];
+        }
+
+        // Gather corner values and evaluate weights in separate passes to
+        // let the compiler vectorise the accumulation over all corners.
+        auto value = std::array<double,32>{};
+        for (auto corner = 0; corner < 32; ++corner) {
+            value[corner] = data[base + corner_offset[corner]];
+        }
+
+        auto bhp = 0.0, d0 = 0.0, d1 = 0.0, d2 = 0.0, d3 = 0.0, d4 = 0.0;
+
+#pragma omp simd reduction(+:bhp,d0,d1,d2,d3,d4)
+        for (auto corner = 0; corner < 32; ++corner) {
+            const auto u0 = (corner >> 4) & 1;
+            const auto u1 = (corner >> 3) & 1;
+            const auto u2 = (corner >> 2) & 1;
+            const auto u3 = (corner >> 1) & 1;
+            const auto u4 = corner & 1;
+
+            const auto w0 = u0 ? pos[0].factor : 1.0 - pos[0].factor;
+            const auto w1 = u1 ? pos[1].factor : 1.0 - pos[1].factor;
+            const auto w2 = u2 ? pos[2].factor : 1.0 - pos[2].factor;
+            const auto w3 = u3 ? pos[3].factor : 1.0 - pos[3].factor;
+            const auto w4 = u4 ? pos[4].factor : 1.0 - pos[4].factor;
+
+            const auto v = value[corner];
+            const auto w01 = w0 * w1;
+            const auto w34 = w3 * w4;
+
+            bhp += w01 * w2 * w34 * v;
+            d0  += (u0 ? v : -v) * w1 * w2 * w34;
+            d1  += (u1 ? v : -v) * w0 * w2 * w34;
+            d2  += (u2 ? v : -v) * w01 * w34;
+            d3  += (u3 ? v : -v) * w01 * w2 * w4;
+            d4  += (u4 ? v : -v) * w01 * w2 * w3;
+        }
+
+        auto& bhp_i = result[i];
+        bhp_i.bhp  = bhp;
+        bhp_i.dthp = d0 * pos[0].inverseDistance;
+        bhp_i.dwfr = d1 * pos[1].inverseDistance;
+        bhp_i.dgfr = d2 * pos[2].inverseDistance;
+        bhp_i.dalq = d3 * pos[3].inverseDistance;
+        bhp_i.dflo = d4 * pos[4].inverseDistance;
+    }
+}
+
 } //Namespace opm
@@ -22,6 +22,7 @@
 
 
 #include <array>
+#include <cstddef>
 #include <vector>
 #include <opm/input/eclipse/Units/Dimension.hpp>
 #include <opm/common/OpmLog/KeywordLocation.hpp>
@@ -161,6 +162,41 @@ public:
 
     double operator()(size_t thp_idx, size_t wfr_idx, size_t gfr_idx, size_t alq_idx, size_t flo_idx) const;
 
+    /**
+     * Coordinates, in SI units, at which to evaluate the table.
+     */
+    struct EvaluationPoint {
+        double flo;
+        double thp;
+        double wfr;
+        double gfr;
+        double alq;
+    };
+
+    /**
+     * Interpolated bottom hole pressure and its partial derivatives with
+     * respect to each of the table's axes.
+     */
+    struct InterpolatedBHP {
+        double bhp;
+        double dflo;
+        double dthp;
+        double dwfr;
+        double dgfr;
+        double dalq;
+    };
+
+    /**
+     * Evaluate the bottom hole pressure at many points, e.g., one per
+     * well, by multi-linear interpolation in the table.  Values outside an
+     * axis' range are extrapolated linearly.  Flow rates are used as given,
+     * so callers must apply the sign convention of the table's axis.
+     *
+     * Large batches are evaluated in parallel.
+     */
+    void interpolate(const std::vector<EvaluationPoint>& points,
+                     std::vector<InterpolatedBHP>& result) const;
+
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
@@ -25,6 +25,7 @@
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 
 #include <opm/input/eclipse/Schedule/Action/WGNames.hpp>
+#include <opm/input/eclipse/Schedule/ScheduleGrid.hpp>
 #include <opm/input/eclipse/Schedule/ScheduleState.hpp>
 #include <opm/input/eclipse/Schedule/Well/WDFAC.hpp>
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
@@ -34,14 +35,24 @@
 
 #include "../HandlerContext.hpp"
 
+#include <external/resinsight/ReservoirDataModel/RigWellLogExtractor.h>
+
 #include <fmt/format.h>
 
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
 #include <unordered_set>
+#include <vector>
 
 namespace Opm {
 
 namespace {
 
+// Fewer COMPTRAJ perforations than this are intersected by a single thread.
+constexpr auto minParallelTrajectoryCount = std::int64_t{8};
+
 void handleCOMPDAT(HandlerContext& handlerContext)
 {
     std::unordered_set<std::string> wells;
@@ -130,45 +141,86 @@ void handleCOMPTRAJ(HandlerContext& handlerContext)
 {
     // Keyword WELTRAJ must be read first
     std::unordered_set<std::string> wells;
-    external::cvf::ref<external::cvf::BoundingBoxTree> cellSearchTree = nullptr;
 
+    struct Perforation
+    {
+        const DeckRecord* record{nullptr};
+        std::string name{};
+        std::shared_ptr<Well> well{};
+        std::vector<external::WellPathCellIntersectionInfo> intersections{};
+    };
+
+    auto perforations = std::vector<Perforation>{};
     for (const auto& record : handlerContext.keyword) {
         const auto wellNamePattern = record.getItem("WELL").getTrimmedString(0);
         const auto wellnames = handlerContext.wellNames(wellNamePattern, false);
 
         for (const auto& name : wellnames) {
-            auto well2 = handlerContext.state().wells.get(name);
-            auto connections = std::make_shared<WellConnections>(well2.getConnections());
+            perforations.push_back({ &record, name, handlerContext.state().wells.get_ptr(name) });
+        }
+    }
 
-            // cellsearchTree is calculated only once and is used to
-            // calculated cell intersections of the perforations
-            // specified in COMPTRAJ
-            connections->loadCOMPTRAJ(record, handlerContext.grid, name,
-                                      handlerContext.keyword.location(),
-                                      cellSearchTree);
-
-            // In the case that defaults are used in WELSPECS for
-            // headI/J the headI/J are calculated based on the well
-            // trajectory data
-            well2.updateHead(connections->getHeadI(), connections->getHeadJ());
-            if (well2.updateConnections(connections, handlerContext.grid)) {
-                handlerContext.state().wells.update( well2 );
-                wells.insert( name );
-            }
+    // Intersect all perforated intervals with the grid up front.  The
+    // intersections only depend on the WELTRAJ trajectories, which COMPTRAJ
+    // does not change, and use the grid's shared cell search tree.  Build
+    // that tree here since its construction is not thread safe.
+    if (! perforations.empty()) {
+        handlerContext.grid.get_cell_search_tree();
+    }
 
-            if (connections->empty() && well2.getConnections().empty()) {
-                const auto& location = handlerContext.keyword.location();
-                const auto msg = fmt::format(R"(Problem with COMPTRAJ/{}
+    const auto numPerforations = static_cast<std::int64_t>(perforations.size());
+    auto failures = std::vector<std::exception_ptr>(numPerforations);
+
+#pragma omp parallel for schedule(dynamic) if (numPerforations >= minParallelTrajectoryCount)
+    for (std::int64_t i = 0; i < numPerforations; ++i) {
+        try {
+            auto& perforation = perforations[i];
+            perforation.intersections = perforation.well->getConnections()
+                .intersectCOMPTRAJ(*perforation.record, handlerContext.grid);
+        }
+        catch (...) {
+            failures[i] = std::current_exception();
+        }
+    }
+
+    for (const auto& failure : failures) {
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
+
+    for (const auto& perforation : perforations) {
+        const auto& record = *perforation.record;
+        const auto& name = perforation.name;
+
+        auto well2 = handlerContext.state().wells.get(name);
+        auto connections = std::make_shared<WellConnections>(well2.getConnections());
+
+        connections->loadCOMPTRAJ(record, handlerContext.grid, name,
+                                  handlerContext.keyword.location(),
+                                  perforation.intersections);
+
+        // In the case that defaults are used in WELSPECS for
+        // headI/J the headI/J are calculated based on the well
+        // trajectory data
+        well2.updateHead(connections->getHeadI(), connections->getHeadJ());
+        if (well2.updateConnections(connections, handlerContext.grid)) {
+            handlerContext.state().wells.update( well2 );
+            wells.insert( name );
+        }
+
+        if (connections->empty() && well2.getConnections().empty()) {
+            const auto& location = handlerContext.keyword.location();
+            const auto msg = fmt::format(R"(Problem with COMPTRAJ/{}
 In {} line {}
 Well {} is not connected to grid - will remain SHUT)",
-                                             name, location.filename,
-                                             location.lineno, name);
-                OpmLog::warning(msg);
-            }
-
-            handlerContext.state().wellgroup_events()
-                .addEvent(name, ScheduleEvents::COMPLETION_CHANGE);
+                                         name, location.filename,
+                                         location.lineno, name);
+            OpmLog::warning(msg);
         }
+
+        handlerContext.state().wellgroup_events()
+            .addEvent(name, ScheduleEvents::COMPLETION_CHANGE);
     }
 
     handlerContext.state().events().addEvent(ScheduleEvents::COMPLETION_CHANGE);
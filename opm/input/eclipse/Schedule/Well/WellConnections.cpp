@@ -544,15 +544,58 @@ The cell ({},{},{}) in well {} is not active and the connection will be ignored)
         }
     }
 
+    std::vector<external::WellPathCellIntersectionInfo>
+    WellConnections::intersectCOMPTRAJ(const DeckRecord&   record,
+                                       const ScheduleGrid& grid) const
+    {
+        const auto& perf_top = record.getItem("PERF_TOP");
+        const auto& perf_bot = record.getItem("PERF_BOT");
+
+        // Calulate the x,y,z coordinates of the begin and end of a perforation
+        external::cvf::Vec3d p_top;
+        external::cvf::Vec3d p_bot;
+        for (size_t i = 0; i < 3 ; ++i) {
+            p_top[i] = linearInterpolation(this->md, this->coord[i], perf_top.getSIDouble(0));
+            p_bot[i] = linearInterpolation(this->md, this->coord[i], perf_bot.getSIDouble(0));
+        }
+
+        std::vector<external::cvf::Vec3d> points{p_top, p_bot};
+        std::vector<double> md_interval{perf_top.getSIDouble(0), perf_bot.getSIDouble(0)};
+
+        external::cvf::ref<external::RigWellPath> wellPathGeometry { new external::RigWellPath };
+        wellPathGeometry->setWellPathPoints(points);
+        wellPathGeometry->setMeasuredDepths(md_interval);
+
+        // The AABB search tree of the grid is shared by all trajectory
+        // wells to avoid redoing an expensive calculation.
+        auto cellSearchTree = grid.get_cell_search_tree();
+
+        external::cvf::ref<external::RigEclipseWellLogExtractor> e {
+            new external::RigEclipseWellLogExtractor {
+                wellPathGeometry.p(), *grid.get_grid(), cellSearchTree
+            }
+        };
+
+        // This gives the intersected grid cells IJK, cell face entrance &
+        // exit cell face point and connection length.
+        return e->cellIntersectionInfosAlongWellPath();
+    }
+
     void WellConnections::loadCOMPTRAJ(const DeckRecord&      record,
                                        const ScheduleGrid&    grid,
                                        const std::string&     wname,
-                                       const KeywordLocation& location,
-                                       external::cvf::ref<external::cvf::BoundingBoxTree>& cellSearchTree)
+                                       const KeywordLocation& location)
     {
-        const auto& perf_top = record.getItem("PERF_TOP");
-        const auto& perf_bot = record.getItem("PERF_BOT");
+        this->loadCOMPTRAJ(record, grid, wname, location,
+                           this->intersectCOMPTRAJ(record, grid));
+    }
 
+    void WellConnections::loadCOMPTRAJ(const DeckRecord&      record,
+                                       const ScheduleGrid&    grid,
+                                       const std::string&     wname,
+                                       const KeywordLocation& location,
+                                       const std::vector<external::WellPathCellIntersectionInfo>& intersections)
+    {
         const auto& CFItem = record.getItem("CONNECTION_TRANSMISSIBILITY_FACTOR");
         const auto& diameterItem = record.getItem("DIAMETER");
         const auto& KhItem = record.getItem("Kh");
@@ -582,35 +625,6 @@ The cell ({},{},{}) in well {} is not active and the connection will be ignored)
         // Get the grid
         const auto& ecl_grid = grid.get_grid();
 
-        // Calulate the x,y,z coordinates of the begin and end of a perforation
-        external::cvf::Vec3d p_top;
-        external::cvf::Vec3d p_bot;
-        for (size_t i = 0; i < 3 ; ++i) {
-            p_top[i] = linearInterpolation(this->md, this->coord[i], perf_top.getSIDouble(0));
-            p_bot[i] = linearInterpolation(this->md, this->coord[i], perf_bot.getSIDouble(0));
-        }
-
-        std::vector<external::cvf::Vec3d> points{p_top, p_bot};
-        std::vector<double> md_interval{perf_top.getSIDouble(0), perf_bot.getSIDouble(0)};
-
-        external::cvf::ref<external::RigWellPath> wellPathGeometry { new external::RigWellPath };
-        wellPathGeometry->setWellPathPoints(points);
-        wellPathGeometry->setMeasuredDepths(md_interval);
-
-        external::cvf::ref<external::RigEclipseWellLogExtractor> e {
-            new external::RigEclipseWellLogExtractor {
-                wellPathGeometry.p(), *ecl_grid, cellSearchTree
-            }
-        };
-
-        // Keep the AABB search tree of the grid to avoid redoing an
-        // expensive calulation.
-        cellSearchTree = e->getCellSearchTree();
-
-        // This gives the intersected grid cells IJK, cell face entrance &
-        // exit cell face point and connection length.
-        auto intersections = e->cellIntersectionInfosAlongWellPath();
-
         for (size_t is = 0; is < intersections.size(); ++is) {
             const auto ijk = ecl_grid->getIJK(intersections[is].globCellIndex);
 
@@ -21,7 +21,6 @@
 #define CONNECTIONSET_HPP_
 
 #include <opm/input/eclipse/Schedule/Well/Connection.hpp>
-#include <external/resinsight/LibGeometry/cvfBoundingBoxTree.h>
 
 #include <array>
 #include <cstddef>
@@ -42,6 +41,10 @@ namespace Opm {
     class WDFAC;
 } // namespace Opm
 
+namespace external {
+    struct WellPathCellIntersectionInfo;
+} // namespace external
+
 namespace Opm {
 
     class WellConnections
@@ -92,11 +95,24 @@ namespace Opm {
                          const WDFAC&           wdfac,
                          const KeywordLocation& location);
 
+        // Grid cells intersected by the perforated interval of a COMPTRAJ
+        // record along this well's WELTRAJ trajectory.  Does not modify
+        // the connection set, so may run concurrently for several wells.
+        std::vector<external::WellPathCellIntersectionInfo>
+        intersectCOMPTRAJ(const DeckRecord&   record,
+                          const ScheduleGrid& grid) const;
+
+        void loadCOMPTRAJ(const DeckRecord&      record,
+                          const ScheduleGrid&    grid,
+                          const std::string&     wname,
+                          const KeywordLocation& location);
+
+        // As above, with intersections from a prior intersectCOMPTRAJ().
         void loadCOMPTRAJ(const DeckRecord&      record,
                           const ScheduleGrid&    grid,
                           const std::string&     wname,
                           const KeywordLocation& location,
-                          external::cvf::ref<external::cvf::BoundingBoxTree>& cellSearchTree);
+                          const std::vector<external::WellPathCellIntersectionInfo>& intersections);
 
         void loadWELTRAJ(const DeckRecord&      record,
                          const ScheduleGrid&    grid,
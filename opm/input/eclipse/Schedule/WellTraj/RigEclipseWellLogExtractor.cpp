@@ -36,6 +36,8 @@
 #include <external/resinsight/CommonCode/cvfStructGrid.h>
 #include <external/resinsight/LibGeometry/cvfBoundingBox.h>
 
+#include <array>
+#include <cstdint>
 #include <map>
 
 
@@ -186,72 +188,65 @@ void RigEclipseWellLogExtractor::findCellLocalXYZ( const std::array<cvf::Vec3d,
 // Convert opm to resinsight numbering of cornerpoints, see RigCellGeometryTools.cpp
 void RigEclipseWellLogExtractor::hexCornersOpmToResinsight( cvf::Vec3d hexCorners[8], size_t cellIndex ) const
 {
-    const auto[i,j,k] = m_grid.getIJK(cellIndex);
     std::array<std::size_t, 8> opm2resinsight = {0, 1, 3, 2, 4, 5, 7, 6};
-   
+
+    std::array<double, 8> X, Y, Z;
+    m_grid.getCellCorners(cellIndex, X, Y, Z);
+
     for (std::size_t l = 0; l < 8; l++) {
-         std::array<double, 3> cornerPointArray;
-         cornerPointArray = m_grid.getCornerPos(i,j,k,l);
-         hexCorners[opm2resinsight[l]]= cvf::Vec3d(cornerPointArray[0], cornerPointArray[1], cornerPointArray[2]);
-    } 
+         hexCorners[opm2resinsight[l]]= cvf::Vec3d(X[l], Y[l], Z[l]);
+    }
 }
 
-// Modified version of ApplicationLibCode\ReservoirDataModel\RigMainGrid.cpp
 void RigEclipseWellLogExtractor::buildCellSearchTree()
 {
     if (m_cellSearchTree.isNull()) {
+        m_cellSearchTree = buildCellSearchTree(m_grid);
+    }
+}
+
+// Modified version of ApplicationLibCode\ReservoirDataModel\RigMainGrid.cpp
+cvf::ref<cvf::BoundingBoxTree> RigEclipseWellLogExtractor::buildCellSearchTree( const Opm::EclipseGrid& grid )
+{
+    // Inactive cells never host connections, so only active cells enter
+    // the tree.  Bounding boxes are formed concurrently, one slot per
+    // active cell, to keep the tree independent of the thread count.
+    const auto numActive = static_cast<std::int64_t>(grid.getNumActive());
+
+    std::vector<size_t>           cellIndicesForBoundingBoxes(numActive);
+    std::vector<cvf::BoundingBox> cellBoundingBoxes(numActive);
 
-        auto nx = m_grid.getNX();
-        auto ny = m_grid.getNY();
-        auto nz = m_grid.getNZ();
-
-        size_t cellCount = nx * ny * nz;
-        std::vector<size_t>           cellIndicesForBoundingBoxes;
-        std::vector<cvf::BoundingBox> cellBoundingBoxes;
-
-// #pragma omp parallel
-//         {
-            size_t threadCellCount = cellCount;
-
-            std::vector<size_t>           threadIndicesForBoundingBoxes;
-            std::vector<cvf::BoundingBox> threadBoundingBoxes;
-
-            threadIndicesForBoundingBoxes.reserve( threadCellCount );
-            threadBoundingBoxes.reserve( threadCellCount );
-
-            std::array<double, 3> cornerPointArray;
-            cvf::Vec3d cornerPoint;
-
-// #pragma omp for
-            for (int cIdx = 0; cIdx < (int)cellCount; ++cIdx) {
-                const auto[i,j,k] = m_grid.getIJK(cIdx);
-                cvf::BoundingBox cellBB;
-                for (std::size_t l = 0; l < 8; l++) {
-                     cornerPointArray = m_grid.getCornerPos(i,j,k,l);
-                     cornerPoint = cvf::Vec3d(cornerPointArray[0], cornerPointArray[1], cornerPointArray[2]);
-                     cellBB.add(cornerPoint);
-                }
-
-                if (cellBB.isValid()) {
-                    threadIndicesForBoundingBoxes.emplace_back(cIdx);
-                    threadBoundingBoxes.emplace_back(cellBB);
-                }
-            }
-
-            threadIndicesForBoundingBoxes.shrink_to_fit();
-            threadBoundingBoxes.shrink_to_fit();
-// #pragma omp critical
-//          {
-             cellIndicesForBoundingBoxes.insert( cellIndicesForBoundingBoxes.end(),
-                                                 threadIndicesForBoundingBoxes.begin(),
-                                                 threadIndicesForBoundingBoxes.end() );
-
-             cellBoundingBoxes.insert( cellBoundingBoxes.end(), threadBoundingBoxes.begin(), threadBoundingBoxes.end() );
-        //  }
-    // } #pragma omp parallel
-         m_cellSearchTree = new cvf::BoundingBoxTree;
-         m_cellSearchTree->buildTreeFromBoundingBoxes( cellBoundingBoxes, &cellIndicesForBoundingBoxes );
+#pragma omp parallel for schedule(static)
+    for (std::int64_t activeIdx = 0; activeIdx < numActive; ++activeIdx) {
+        const auto cIdx = grid.getGlobalIndex(activeIdx);
+
+        std::array<double, 8> X, Y, Z;
+        grid.getCellCorners(cIdx, X, Y, Z);
+
+        auto& cellBB = cellBoundingBoxes[activeIdx];
+        for (std::size_t l = 0; l < 8; l++) {
+            cellBB.add(cvf::Vec3d(X[l], Y[l], Z[l]));
+        }
+
+        cellIndicesForBoundingBoxes[activeIdx] = cIdx;
+    }
+
+    std::size_t numValid = 0;
+    for (std::size_t i = 0; i < cellBoundingBoxes.size(); ++i) {
+        if (cellBoundingBoxes[i].isValid()) {
+            cellIndicesForBoundingBoxes[numValid] = cellIndicesForBoundingBoxes[i];
+            cellBoundingBoxes[numValid] = cellBoundingBoxes[i];
+            ++numValid;
+        }
     }
+
+    cellIndicesForBoundingBoxes.resize(numValid);
+    cellBoundingBoxes.resize(numValid);
+
+    cvf::ref<cvf::BoundingBoxTree> cellSearchTree = new cvf::BoundingBoxTree;
+    cellSearchTree->buildTreeFromBoundingBoxes( cellBoundingBoxes, &cellIndicesForBoundingBoxes );
+
+    return cellSearchTree;
 }
 
 // From ApplicationLibCode\ReservoirDataModel\RigMainGrid.cpp
@@ -50,6 +50,9 @@ public:
     RigEclipseWellLogExtractor( const RigWellPath* wellpath, const Opm::EclipseGrid& grid, cvf::ref<cvf::BoundingBoxTree>& cellSearchTree);
 
     cvf::ref<cvf::BoundingBoxTree> getCellSearchTree();
+
+    // Bounding box search tree over the active cells of the grid.
+    static cvf::ref<cvf::BoundingBoxTree> buildCellSearchTree( const Opm::EclipseGrid& grid );
 private:
     void                calculateIntersection();
     std::vector<size_t> findCloseCellIndices( const cvf::BoundingBox& bb );
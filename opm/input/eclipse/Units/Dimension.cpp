@@ -19,9 +19,24 @@
 
 #include <opm/input/eclipse/Units/Dimension.hpp>
 
-#include <string>
-#include <stdexcept>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+// Arrays shorter than this are converted by a single thread.
+constexpr auto minParallelConversionSize = std::size_t{1} << 16;
+
+void throwContextDependent()
+{
+    throw std::logic_error("The DeckItem contains a field with a context dependent unit. "
+                           "Use getData< double >() and convert the returned value manually!");
+}
+
+} // Anonymous namespace
 
 namespace Opm {
 
@@ -71,6 +86,55 @@ namespace Opm {
         return (siValue - m_SIoffset)/m_SIfactor;
     }
 
+    void Dimension::convertRawToSi(const double* rawValues,
+                                   const std::size_t n,
+                                   double* siValues) const
+    {
+        if (n == 0) {
+            return;
+        }
+
+        if (this->isContextDependent()) {
+            throwContextDependent();
+        }
+
+        const auto factor = this->m_SIfactor;
+        const auto offset = this->m_SIoffset;
+        const auto size = static_cast<std::int64_t>(n);
+
+#pragma omp parallel for schedule(static) if (n >= minParallelConversionSize)
+        for (std::int64_t i = 0; i < size; ++i) {
+            siValues[i] = rawValues[i]*factor + offset;
+        }
+    }
+
+    void Dimension::convertSiToRaw(const double* siValues,
+                                   const std::size_t n,
+                                   double* rawValues) const
+    {
+        if (n == 0) {
+            return;
+        }
+
+        if (this->isContextDependent()) {
+            throwContextDependent();
+        }
+
+        const auto factor = this->m_SIfactor;
+        const auto offset = this->m_SIoffset;
+        const auto size = static_cast<std::int64_t>(n);
+
+#pragma omp parallel for schedule(static) if (n >= minParallelConversionSize)
+        for (std::int64_t i = 0; i < size; ++i) {
+            rawValues[i] = (siValues[i] - offset)/factor;
+        }
+    }
+
+    bool Dimension::isContextDependent() const
+    {
+        return !std::isfinite(this->m_SIfactor);
+    }
+
 
     // only dimensions with zero offset are compositable...
     bool Dimension::isCompositable() const
@@ -20,6 +20,7 @@
 #ifndef DIMENSION_H
 #define DIMENSION_H
 
+#include <cstddef>
 #include <string>
 
 namespace Opm {
@@ -38,6 +39,15 @@ namespace Opm {
         double convertRawToSi(double rawValue) const;
         double convertSiToRaw(double siValue) const;
 
+        // Convert n consecutive values.  Input and output may be the same
+        // array.  Same results as converting the values one at a time.
+        void convertRawToSi(const double* rawValues, std::size_t n, double* siValues) const;
+        void convertSiToRaw(const double* siValues, std::size_t n, double* rawValues) const;
+
+        // Whether the conversion depends on the context in which the value
+        // is used and therefore cannot be applied by this object.
+        bool isContextDependent() const;
+
         bool equal(const Dimension& other) const;
         bool isCompositable() const;
 
@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <stdexcept>
 #include <vector>
@@ -35,6 +36,21 @@ namespace {
     {
         return N;
     }
+
+    // Arrays shorter than this are converted by a single thread.
+    constexpr auto minParallelConversionSize = std::size_t{1} << 16;
+
+    template <typename T>
+    void fromSI(const double factor, const double offset,
+                const double* si, const std::size_t n, T* raw)
+    {
+        const auto size = static_cast<std::int64_t>(n);
+
+#pragma omp parallel for schedule(static) if (n >= minParallelConversionSize)
+        for (std::int64_t i = 0; i < size; ++i) {
+            raw[i] = static_cast<T>((si[i] - offset) * factor);
+        }
+    }
 }
 
 namespace Opm {
@@ -1456,6 +1472,7 @@ namespace {
         auto iter = this->m_dimensions.find(dimension);
         if (iter == this->m_dimensions.end())
             throw std::out_of_range("The dimension: '" + dimension + "' was not recognized");
+#pragma omp atomic
         this->m_use_count++;
         return iter->second;
     }
@@ -1614,18 +1631,35 @@ namespace {
     }
 
     void UnitSystem::from_si( measure m, std::vector<double>& data ) const {
-        double factor = this->measure_table_from_si[ static_cast< int >( m ) ];
-        double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
-        auto scale = [=](double x) { return (x - offset) * factor; };
-        std::transform( data.begin() , data.end() , data.begin() , scale);
+        this->from_si(m, data.data(), data.size(), data.data());
     }
 
 
     void UnitSystem::to_si( measure m, std::vector<double>& data) const {
-        double factor = this->measure_table_to_si[ static_cast< int >( m ) ];
-        double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
-        auto scale = [=](double x) { return x * factor + offset; };
-        std::transform( data.begin() , data.end() , data.begin() , scale);
+        this->to_si(m, data.data(), data.size(), data.data());
+    }
+
+    void UnitSystem::from_si( measure m, const double* si, const std::size_t n, double* raw ) const {
+        fromSI(this->measure_table_from_si[ static_cast< int >( m ) ],
+               this->measure_table_to_si_offset[ static_cast< int >( m ) ],
+               si, n, raw);
+    }
+
+    void UnitSystem::from_si( measure m, const double* si, const std::size_t n, float* raw ) const {
+        fromSI(this->measure_table_from_si[ static_cast< int >( m ) ],
+               this->measure_table_to_si_offset[ static_cast< int >( m ) ],
+               si, n, raw);
+    }
+
+    void UnitSystem::to_si( measure m, const double* raw, const std::size_t n, double* si ) const {
+        const double factor = this->measure_table_to_si[ static_cast< int >( m ) ];
+        const double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
+        const auto size = static_cast<std::int64_t>(n);
+
+#pragma omp parallel for schedule(static) if (n >= minParallelConversionSize)
+        for (std::int64_t i = 0; i < size; ++i) {
+            si[i] = raw[i]*factor + offset;
+        }
     }
 
     const char* UnitSystem::name( measure m ) const {
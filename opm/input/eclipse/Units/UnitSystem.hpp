@@ -24,6 +24,7 @@
 
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
@@ -123,6 +124,12 @@ namespace Opm {
         double to_si( measure, double ) const;
         void from_si( measure, std::vector<double>& ) const;
         void to_si( measure, std::vector<double>& ) const;
+
+        // Convert n consecutive values.  Input and output may be the same
+        // array.
+        void from_si( measure, const double* si, std::size_t n, double* raw ) const;
+        void from_si( measure, const double* si, std::size_t n, float* raw ) const;
+        void to_si( measure, const double* raw, std::size_t n, double* si ) const;
         const char* name( measure ) const;
         std::string deck_name() const;
         std::size_t use_count() const;
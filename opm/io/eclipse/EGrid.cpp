@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
@@ -320,56 +321,62 @@ std::array<int, 3> EGrid::ijk_from_global_index(int globInd) const
 }
 
 
-void EGrid::getCellCorners(const std::array<int, 3>& ijk,
-                           std::array<double,8>& X,
-                           std::array<double,8>& Y,
-                           std::array<double,8>& Z)
+std::array<int, 4> EGrid::cornerPillars(int globInd) const
 {
-    if (coord_array.empty())
-        load_grid_data();
+    const int k = globInd / (nijk[0] * nijk[1]);
+    const int rest = globInd % (nijk[0] * nijk[1]);
+    const int j = rest / nijk[0];
+    const int i = rest % nijk[0];
 
-    std::vector<int> zind;
-    std::vector<int> pind;
+    const int p0 = res.at(k)*(nijk[0]+1)*(nijk[1]+1) + j*(nijk[0]+1) + i;
 
-    int res_shift = res.at(ijk[2])*(nijk[0]+1)*(nijk[1]+1)*6;
-    
-   // calculate indices for grid pillars in COORD arrray
-    pind.push_back(res_shift + ijk[1]*(nijk[0]+1)*6 + ijk[0]*6);
-    pind.push_back(pind[0] + 6);
-    pind.push_back(pind[0] + (nijk[0]+1)*6);
-    pind.push_back(pind[2] + 6);
+    return { p0, p0 + 1, p0 + nijk[0] + 1, p0 + nijk[0] + 2 };
+}
+
+
+void EGrid::cellCorners(int globInd, double* X, double* Y, double* Z) const
+{
+    const auto pillars = this->cornerPillars(globInd);
+
+    const int k = globInd / (nijk[0] * nijk[1]);
+    const int rest = globInd % (nijk[0] * nijk[1]);
+    const int j = rest / nijk[0];
+    const int i = rest % nijk[0];
 
     // get depths from zcorn array in ZCORN array
-    zind.push_back(ijk[2]*nijk[0]*nijk[1]*8 + ijk[1]*nijk[0]*4 + ijk[0]*2);
-    zind.push_back(zind[0] + 1);
-    zind.push_back(zind[0] + nijk[0]*2);
-    zind.push_back(zind[2] + 1);
+    std::array<std::size_t, 8> zind;
+    zind[0] = static_cast<std::size_t>(k)*nijk[0]*nijk[1]*8 + static_cast<std::size_t>(j)*nijk[0]*4 + i*2;
+    zind[1] = zind[0] + 1;
+    zind[2] = zind[0] + nijk[0]*2;
+    zind[3] = zind[2] + 1;
 
     for (int n = 0; n < 4; n++)
-        zind.push_back(zind[n] + nijk[0]*nijk[1]*4);
+        zind[n + 4] = zind[n] + static_cast<std::size_t>(nijk[0])*nijk[1]*4;
 
     for (int n = 0; n< 8; n++)
         Z[n] = zcorn_array[zind[n]];
 
     for (int  n = 0; n < 4; n++) {
+        const std::size_t pind = static_cast<std::size_t>(pillars[n]) * 6;
+
         double xt;
         double yt;
         double xb;
         double yb;
 
-        double zt = coord_array[pind[n] + 2];
-        double zb = coord_array[pind[n] + 5];
+        double zt = coord_array[pind + 2];
+        double zb = coord_array[pind + 5];
 
         if (m_radial) {
-            xt = coord_array[pind[n]] * cos(coord_array[pind[n] + 1] / 180.0 * M_PI);
-            yt = coord_array[pind[n]] * sin(coord_array[pind[n] + 1] / 180.0 * M_PI);
-            xb = coord_array[pind[n]+3] * cos(coord_array[pind[n] + 4] / 180.0 * M_PI);
-            yb = coord_array[pind[n]+3] * sin(coord_array[pind[n] + 4] / 180.0 * M_PI);
+            xt = coord_array[pind] * cos(coord_array[pind + 1] / 180.0 * M_PI);
+            yt = coord_array[pind] * sin(coord_array[pind + 1] / 180.0 * M_PI);
+            xb = coord_array[pind+3] * cos(coord_array[pind + 4] / 180.0 * M_PI);
+            yb = coord_array[pind+3] * sin(coord_array[pind + 4] / 180.0 * M_PI);
         } else {
-            xt = coord_array[pind[n]];
-            yt = coord_array[pind[n] + 1];
-            xb = coord_array[pind[n] + 3];
-            yb = coord_array[pind[n] + 4];
+            xt = coord_array[pind];
+            yt = coord_array[pind + 1];
+            xb = coord_array[pind + 3];
+            yb = coord_array[pind + 4];
         }
 
         X[n] = xt + (xb-xt) / (zt-zb) * (zt - Z[n]);
@@ -381,6 +388,188 @@ void EGrid::getCellCorners(const std::array<int, 3>& ijk,
 }
 
 
+void EGrid::getCellCorners(const std::array<int, 3>& ijk,
+                           std::array<double,8>& X,
+                           std::array<double,8>& Y,
+                           std::array<double,8>& Z)
+{
+    if (coord_array.empty())
+        load_grid_data();
+
+    const int globInd = ijk[0] + ijk[1]*nijk[0] + ijk[2]*nijk[0]*nijk[1];
+
+    this->cellCorners(globInd, X.data(), Y.data(), Z.data());
+}
+
+
+EGrid::CellGeometry EGrid::activeCellGeometry(bool withFaces)
+{
+    return this->activeCellGeometry(0, nactive, withFaces);
+}
+
+
+EGrid::CellGeometry EGrid::activeCellGeometry(int firstActive, int numCells, bool withFaces)
+{
+    if ((firstActive < 0) || (numCells < 0) || (firstActive > nactive - numCells)) {
+        std::string message = "invalid range of active cells [" + std::to_string(firstActive) + ", ";
+        message = message + std::to_string(static_cast<long>(firstActive) + numCells) + "). Number of active cells: ";
+        OPM_THROW(std::invalid_argument, message + std::to_string(nactive));
+    }
+
+    if (coord_array.empty())
+        load_grid_data();
+
+    CellGeometry geometry;
+    geometry.firstActive = firstActive;
+    geometry.numCells = numCells;
+
+    const std::size_t numCorners = static_cast<std::size_t>(numCells) * 8;
+
+    geometry.X.resize(numCorners);
+    geometry.Y.resize(numCorners);
+    geometry.Z.resize(numCorners);
+
+    geometry.centerX.resize(numCells);
+    geometry.centerY.resize(numCells);
+    geometry.centerZ.resize(numCells);
+
+#pragma omp parallel for schedule(static)
+    for (int c = 0; c < numCells; ++c) {
+        const std::size_t offset = static_cast<std::size_t>(c) * 8;
+
+        double* X = geometry.X.data() + offset;
+        double* Y = geometry.Y.data() + offset;
+        double* Z = geometry.Z.data() + offset;
+
+        this->cellCorners(glob_index[firstActive + c], X, Y, Z);
+
+        geometry.centerX[c] = std::accumulate(X, X + 8, 0.0) / 8.0;
+        geometry.centerY[c] = std::accumulate(Y, Y + 8, 0.0) / 8.0;
+        geometry.centerZ[c] = std::accumulate(Z, Z + 8, 0.0) / 8.0;
+    }
+
+    if (withFaces)
+        this->buildFaces(geometry);
+
+    return geometry;
+}
+
+
+void EGrid::buildFaces(CellGeometry& geometry) const
+{
+    // A corner point is uniquely determined by its pillar and its depth
+    // along that pillar.  Corners are therefore bucketed by pillar, and
+    // the corners of each pillar are sorted on depth to find the unique
+    // vertices.  The pillars are processed independently of each other.
+
+    const int numCells = geometry.numCells;
+    const std::int64_t numCorners = static_cast<std::int64_t>(numCells) * 8;
+    const std::int64_t numPillars = static_cast<std::int64_t>(nijk[0]+1) * (nijk[1]+1) * numres;
+
+    std::vector<int> cornerPillar(numCorners);
+
+#pragma omp parallel for schedule(static)
+    for (int c = 0; c < numCells; ++c) {
+        const auto pillars = this->cornerPillars(glob_index[geometry.firstActive + c]);
+
+        for (int n = 0; n < 8; n++)
+            cornerPillar[static_cast<std::size_t>(c)*8 + n] = pillars[n % 4];
+    }
+
+    std::vector<std::int64_t> pillarStart(numPillars + 1, 0);
+
+    for (const auto& pillar : cornerPillar)
+        ++pillarStart[pillar + 1];
+
+    std::partial_sum(pillarStart.begin(), pillarStart.end(), pillarStart.begin());
+
+    std::vector<std::int64_t> pillarCorners(numCorners);
+    {
+        auto next = pillarStart;
+
+        for (std::int64_t corner = 0; corner < numCorners; ++corner)
+            pillarCorners[next[cornerPillar[corner]]++] = corner;
+    }
+
+    cornerPillar.clear();
+    cornerPillar.shrink_to_fit();
+
+    const auto& Z = geometry.Z;
+    std::vector<std::int64_t> vertexStart(numPillars + 1, 0);
+
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (std::int64_t p = 0; p < numPillars; ++p) {
+        const auto first = pillarCorners.begin() + pillarStart[p];
+        const auto last = pillarCorners.begin() + pillarStart[p + 1];
+
+        std::sort(first, last, [&Z](const std::int64_t c1, const std::int64_t c2)
+        {
+            return (Z[c1] < Z[c2]) || ((Z[c1] == Z[c2]) && (c1 < c2));
+        });
+
+        std::int64_t numUnique = 0;
+        for (auto corner = first; corner != last; ++corner) {
+            if ((corner == first) || (Z[*corner] != Z[*(corner - 1)]))
+                ++numUnique;
+        }
+
+        vertexStart[p + 1] = numUnique;
+    }
+
+    std::partial_sum(vertexStart.begin(), vertexStart.end(), vertexStart.begin());
+
+    const std::int64_t numVertices = vertexStart.back();
+
+    geometry.vertexX.resize(numVertices);
+    geometry.vertexY.resize(numVertices);
+    geometry.vertexZ.resize(numVertices);
+
+    std::vector<int> cornerVertex(numCorners);
+
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (std::int64_t p = 0; p < numPillars; ++p) {
+        std::int64_t vertex = vertexStart[p] - 1;
+
+        for (std::int64_t n = pillarStart[p]; n < pillarStart[p + 1]; ++n) {
+            const auto corner = pillarCorners[n];
+
+            if ((n == pillarStart[p]) || (Z[corner] != Z[pillarCorners[n - 1]])) {
+                ++vertex;
+                geometry.vertexX[vertex] = geometry.X[corner];
+                geometry.vertexY[vertex] = geometry.Y[corner];
+                geometry.vertexZ[vertex] = geometry.Z[corner];
+            }
+
+            cornerVertex[corner] = static_cast<int>(vertex);
+        }
+    }
+
+    // Corner numbering as in getCellCorners(): 0-3 top face (i,j), (i+1,j),
+    // (i,j+1), (i+1,j+1), and 4-7 likewise for the bottom face.
+    static constexpr std::array<std::array<int, 4>, 6> faceCorners {{
+        {0, 2, 6, 4},   // I-
+        {1, 5, 7, 3},   // I+
+        {0, 4, 5, 1},   // J-
+        {2, 3, 7, 6},   // J+
+        {0, 1, 3, 2},   // K-
+        {4, 6, 7, 5},   // K+
+    }};
+
+    geometry.faces.resize(static_cast<std::size_t>(numCells) * 24);
+
+#pragma omp parallel for schedule(static)
+    for (int c = 0; c < numCells; ++c) {
+        const std::size_t corner0 = static_cast<std::size_t>(c) * 8;
+        auto* faces = geometry.faces.data() + static_cast<std::size_t>(c) * 24;
+
+        for (const auto& face : faceCorners) {
+            for (const auto& corner : face)
+                *faces++ = cornerVertex[corner0 + corner];
+        }
+    }
+}
+
+
 
 void EGrid::getCellCorners(int globindex, std::array<double,8>& X,
                            std::array<double,8>& Y, std::array<double,8>& Z)
@@ -32,6 +32,32 @@ namespace Opm { namespace EclIO {
 class EGrid : public EclFile
 {
 public:
+    // Corner and center coordinates of a contiguous range of active
+    // cells, stored as flat arrays.  Corners of cell 'c' (relative to
+    // firstActive) are at [8*c, 8*c + 8) in X, Y and Z, in the same order
+    // as getCellCorners().  Vertex and face arrays are only populated when
+    // requested, in which case vertexX/Y/Z hold the unique corner points
+    // and 'faces' holds four vertex indices for each of the six faces
+    // (I-, I+, J-, J+, K-, K+) of each cell.
+    struct CellGeometry
+    {
+        int firstActive {0};
+        int numCells {0};
+
+        std::vector<double> X;
+        std::vector<double> Y;
+        std::vector<double> Z;
+
+        std::vector<double> centerX;
+        std::vector<double> centerY;
+        std::vector<double> centerZ;
+
+        std::vector<double> vertexX;
+        std::vector<double> vertexY;
+        std::vector<double> vertexZ;
+        std::vector<int> faces;
+    };
+
     explicit EGrid(const std::string& filename, std::string grid_name = "global");
 
     int global_index(int i, int j, int k) const;
@@ -45,6 +71,9 @@ public:
     void getCellCorners(int globindex, std::array<double,8>& X, std::array<double,8>& Y, std::array<double,8>& Z);
     void getCellCorners(const std::array<int, 3>& ijk, std::array<double,8>& X, std::array<double,8>& Y, std::array<double,8>& Z);
 
+    CellGeometry activeCellGeometry(bool withFaces = false);
+    CellGeometry activeCellGeometry(int firstActive, int numCells, bool withFaces = false);
+
     std::vector<std::array<float, 3>> getXYZ_layer(int layer, bool bottom=false);
     std::vector<std::array<float, 3>> getXYZ_layer(int layer, const std::array<int, 4>& box, bool bottom=false);
 
@@ -106,6 +135,10 @@ private:
 
     std::vector<float> get_zcorn_from_disk(int layer, bool bottom);
 
+    std::array<int, 4> cornerPillars(int globInd) const;
+    void cellCorners(int globInd, double* X, double* Y, double* Z) const;
+    void buildFaces(CellGeometry& geometry) const;
+
     void getCellCorners(const std::array<int, 3>& ijk, const std::vector<float>& zcorn_layer,
                            std::array<double,4>& X, std::array<double,4>& Y, std::array<double,4>& Z);
 
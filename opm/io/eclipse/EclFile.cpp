@@ -23,15 +23,43 @@
 #include <fmt/format.h>
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <cstring>
+#include <exception>
 #include <functional>
 #include <fstream>
 #include <iomanip>
 #include <iterator>
 #include <string>
+#include <utility>
 #include <numeric>
 #include <cmath>
 
+namespace {
+
+// Array lists shorter than this are loaded by a single thread.
+constexpr auto minParallelLoadSize = std::int64_t{4};
+
+// Assign array data to existing entry if present.  Uses find() rather than
+// operator[] to allow concurrent stores into distinct, pre-existing entries.
+template <typename T>
+void storeArray(std::unordered_map<int, std::vector<T>>& arrays,
+                const std::size_t                        arrIndex,
+                std::vector<T>&&                         values)
+{
+    const auto ind = static_cast<int>(arrIndex);
+
+    auto pos = arrays.find(ind);
+    if (pos == arrays.end()) {
+        arrays.emplace(ind, std::move(values));
+    }
+    else {
+        pos->second = std::move(values);
+    }
+}
+
+} // Anonymous namespace
+
 namespace Opm { namespace EclIO {
 
 void EclFile::load(bool preload) {
@@ -118,27 +146,41 @@ EclFile::EclFile(const std::string& filename, bool preload) :
 
 
 void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
+{
+    this->decodeBinaryArray(fileH, arrIndex);
+
+    arrayLoaded[arrIndex] = true;
+}
+
+void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos)
+{
+    this->decodeFormattedArray(fileStr, arrIndex, fromPos);
+
+    arrayLoaded[arrIndex] = true;
+}
+
+void EclFile::decodeBinaryArray(std::fstream& fileH, std::size_t arrIndex)
 {
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
 
     switch (array_type[arrIndex]) {
     case INTE:
-        inte_array[arrIndex] = readBinaryInteArray(fileH, array_size[arrIndex]);
+        storeArray(inte_array, arrIndex, readBinaryInteArray(fileH, array_size[arrIndex]));
         break;
     case REAL:
-        real_array[arrIndex] = readBinaryRealArray(fileH, array_size[arrIndex]);
+        storeArray(real_array, arrIndex, readBinaryRealArray(fileH, array_size[arrIndex]));
         break;
     case DOUB:
-        doub_array[arrIndex] = readBinaryDoubArray(fileH, array_size[arrIndex]);
+        storeArray(doub_array, arrIndex, readBinaryDoubArray(fileH, array_size[arrIndex]));
         break;
     case LOGI:
-        logi_array[arrIndex] = readBinaryLogiArray(fileH, array_size[arrIndex]);
+        storeArray(logi_array, arrIndex, readBinaryLogiArray(fileH, array_size[arrIndex]));
         break;
     case CHAR:
-        char_array[arrIndex] = readBinaryCharArray(fileH, array_size[arrIndex]);
+        storeArray(char_array, arrIndex, readBinaryCharArray(fileH, array_size[arrIndex]));
         break;
     case C0NN:
-        char_array[arrIndex] = readBinaryC0nnArray(fileH, array_size[arrIndex], array_element_size[arrIndex]);
+        storeArray(char_array, arrIndex, readBinaryC0nnArray(fileH, array_size[arrIndex], array_element_size[arrIndex]));
         break;
     case MESS:
         break;
@@ -146,31 +188,29 @@ void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
         OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
         break;
     }
-
-    arrayLoaded[arrIndex] = true;
 }
 
-void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos)
+void EclFile::decodeFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos)
 {
 
     switch (array_type[arrIndex]) {
     case INTE:
-        inte_array[arrIndex] = readFormattedInteArray(fileStr, array_size[arrIndex], fromPos);
+        storeArray(inte_array, arrIndex, readFormattedInteArray(fileStr, array_size[arrIndex], fromPos));
         break;
     case REAL:
-        real_array[arrIndex] = readFormattedRealArray(fileStr, array_size[arrIndex], fromPos);
+        storeArray(real_array, arrIndex, readFormattedRealArray(fileStr, array_size[arrIndex], fromPos));
         break;
     case DOUB:
-        doub_array[arrIndex] = readFormattedDoubArray(fileStr, array_size[arrIndex], fromPos);
+        storeArray(doub_array, arrIndex, readFormattedDoubArray(fileStr, array_size[arrIndex], fromPos));
         break;
     case LOGI:
-        logi_array[arrIndex] = readFormattedLogiArray(fileStr, array_size[arrIndex], fromPos);
+        storeArray(logi_array, arrIndex, readFormattedLogiArray(fileStr, array_size[arrIndex], fromPos));
         break;
     case CHAR:
-        char_array[arrIndex] = readFormattedCharArray(fileStr, array_size[arrIndex], fromPos, sizeOfChar);
+        storeArray(char_array, arrIndex, readFormattedCharArray(fileStr, array_size[arrIndex], fromPos, sizeOfChar));
         break;
     case C0NN:
-        char_array[arrIndex] = readFormattedCharArray(fileStr, array_size[arrIndex], fromPos, array_element_size[arrIndex]);
+        storeArray(char_array, arrIndex, readFormattedCharArray(fileStr, array_size[arrIndex], fromPos, array_element_size[arrIndex]));
         break;
     case MESS:
         break;
@@ -178,37 +218,41 @@ void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrInde
         OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
         break;
     }
-
-    arrayLoaded[arrIndex] = true;
 }
 
-
-void EclFile::loadData()
+void EclFile::reserveArrayStorage(std::size_t arrIndex)
 {
+    const auto ind = static_cast<int>(arrIndex);
 
-    if (formatted) {
-
-        std::vector<int> arrIndices(array_name.size());
-        std::iota(arrIndices.begin(), arrIndices.end(), 0);
-
-        this->loadData(arrIndices);
-
-    } else {
-
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+    switch (array_type[arrIndex]) {
+    case INTE:
+        inte_array.try_emplace(ind);
+        break;
+    case REAL:
+        real_array.try_emplace(ind);
+        break;
+    case DOUB:
+        doub_array.try_emplace(ind);
+        break;
+    case LOGI:
+        logi_array.try_emplace(ind);
+        break;
+    case CHAR:
+    case C0NN:
+        char_array.try_emplace(ind);
+        break;
+    default:
+        break;
+    }
+}
 
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
 
-        for (size_t i = 0; i < array_name.size(); i++) {
-            loadBinaryArray(fileH, i);
-        }
+void EclFile::loadData()
+{
+    std::vector<int> arrIndices(array_name.size());
+    std::iota(arrIndices.begin(), arrIndices.end(), 0);
 
-        fileH.close();
-    }
+    this->loadData(arrIndices);
 }
 
 
@@ -218,6 +262,7 @@ void EclFile::loadData(const std::string& name)
     if (formatted) {
 
         std::ifstream inFile(inputFilename);
+        std::string fileStr;
 
         for (unsigned int arrIndex = 0; arrIndex < array_name.size(); arrIndex++) {
 
@@ -226,10 +271,8 @@ void EclFile::loadData(const std::string& name)
                 inFile.seekg(ifStreamPos[arrIndex]);
 
                 size_t size = sizeOnDiskFormatted(array_size[arrIndex], array_type[arrIndex], array_element_size[arrIndex])+1;
-                std::vector<char> buffer(size);
-                inFile.read (buffer.data(), size);
-
-                std::string fileStr = std::string(buffer.data(), size);
+                fileStr.assign(size, '\0');
+                inFile.read (fileStr.data(), size);
 
                 loadFormattedArray(fileStr, arrIndex, 0);
             }
@@ -258,38 +301,87 @@ void EclFile::loadData(const std::string& name)
 
 void EclFile::loadData(const std::vector<int>& arrIndex)
 {
+    // Arrays are read and decoded concurrently, each thread through its own
+    // file stream.  Container entries are created up front so that threads
+    // only ever assign to distinct, existing entries.  Indices which are
+    // requested more than once are only loaded once, since two threads must
+    // not decode into the same entry.
+    std::vector<int> uniqueIndex(arrIndex);
+    std::sort(uniqueIndex.begin(), uniqueIndex.end());
+    uniqueIndex.erase(std::unique(uniqueIndex.begin(), uniqueIndex.end()), uniqueIndex.end());
+
+    for (int ind : uniqueIndex) {
+        this->reserveArrayStorage(ind);
+    }
 
-    if (formatted) {
+    const auto numArrays = static_cast<std::int64_t>(uniqueIndex.size());
+    std::vector<std::exception_ptr> failures(numArrays);
 
-        std::ifstream inFile(inputFilename);
+    if (formatted) {
 
-        for (int ind : arrIndex) {
+#pragma omp parallel if (numArrays >= minParallelLoadSize)
+        {
+            std::ifstream inFile(inputFilename);
+            std::string fileStr;
 
-            inFile.seekg(ifStreamPos[ind]);
+#pragma omp for schedule(dynamic)
+            for (std::int64_t i = 0; i < numArrays; ++i) {
+                try {
+                    const auto ind = uniqueIndex[i];
 
-            size_t size = sizeOnDiskFormatted(array_size[ind], array_type[ind], array_element_size[ind])+1;
-            std::vector<char> buffer(size);
-            inFile.read (buffer.data(), size);
+                    inFile.seekg(ifStreamPos[ind]);
 
-            std::string fileStr = std::string(buffer.data(), size);
+                    size_t size = sizeOnDiskFormatted(array_size[ind], array_type[ind], array_element_size[ind])+1;
+                    fileStr.assign(size, '\0');
+                    inFile.read (fileStr.data(), size);
+                    inFile.clear();
 
-            loadFormattedArray(fileStr, ind, 0);
+                    decodeFormattedArray(fileStr, ind, 0);
+                }
+                catch (...) {
+                    failures[i] = std::current_exception();
+                }
+            }
         }
 
     } else {
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
 
-        if (!fileH) {
+        // Report a missing file even if there is nothing to load
+        if (!std::ifstream(inputFilename, std::ios::binary)) {
             std::string message="Could not open file: '" + inputFilename +"'";
             OPM_THROW(std::runtime_error, message);
         }
 
-        for (int ind : arrIndex) {
-            loadBinaryArray(fileH, ind);
+#pragma omp parallel if (numArrays >= minParallelLoadSize)
+        {
+            std::fstream fileH;
+            fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+
+#pragma omp for schedule(dynamic)
+            for (std::int64_t i = 0; i < numArrays; ++i) {
+                try {
+                    if (!fileH) {
+                        std::string message="Could not open file: '" + inputFilename +"'";
+                        OPM_THROW(std::runtime_error, message);
+                    }
+
+                    decodeBinaryArray(fileH, uniqueIndex[i]);
+                }
+                catch (...) {
+                    failures[i] = std::current_exception();
+                }
+            }
+        }
+    }
+
+    for (const auto& failure : failures) {
+        if (failure) {
+            std::rethrow_exception(failure);
         }
+    }
 
-        fileH.close();
+    for (int ind : uniqueIndex) {
+        arrayLoaded[ind] = true;
     }
 }
 
@@ -303,10 +395,8 @@ void EclFile::loadData(int arrIndex)
             inFile.seekg(ifStreamPos[arrIndex]);
 
             size_t size = sizeOnDiskFormatted(array_size[arrIndex], array_type[arrIndex], array_element_size[arrIndex])+1;
-            std::vector<char> buffer(size);
-            inFile.read (buffer.data(), size);
-
-            std::string fileStr = std::string(buffer.data(), size);
+            std::string fileStr(size, '\0');
+            inFile.read (fileStr.data(), size);
 
             loadFormattedArray(fileStr, arrIndex, 0);
 
@@ -326,6 +416,17 @@ void EclFile::loadData(int arrIndex)
     }
 }
 
+void EclFile::clearData(int arrIndex)
+{
+    inte_array.erase(arrIndex);
+    real_array.erase(arrIndex);
+    doub_array.erase(arrIndex);
+    logi_array.erase(arrIndex);
+    char_array.erase(arrIndex);
+
+    arrayLoaded[arrIndex] = false;
+}
+
 bool EclFile::is_ix() const
 {
     // assuming that array data type C0nn only are used in IX. This may change in future.
@@ -638,6 +739,47 @@ const std::vector<T>& EclFile::getImpl(int arrIndex, eclArrType type,
     return array.at(arrIndex);
 }
 
+template<class T>
+std::vector<T> EclFile::releaseImpl(int arrIndex, std::unordered_map<int, std::vector<T>>& array)
+{
+    get<T>(arrIndex); // loads the array and checks its type
+
+    auto node = array.extract(arrIndex);
+    arrayLoaded[arrIndex] = false;
+
+    return std::move(node.mapped());
+}
+
+template<>
+std::vector<int> EclFile::release<int>(int arrIndex)
+{
+    return releaseImpl(arrIndex, inte_array);
+}
+
+template<>
+std::vector<float> EclFile::release<float>(int arrIndex)
+{
+    return releaseImpl(arrIndex, real_array);
+}
+
+template<>
+std::vector<double> EclFile::release<double>(int arrIndex)
+{
+    return releaseImpl(arrIndex, doub_array);
+}
+
+template<>
+std::vector<bool> EclFile::release<bool>(int arrIndex)
+{
+    return releaseImpl(arrIndex, logi_array);
+}
+
+template<>
+std::vector<std::string> EclFile::release<std::string>(int arrIndex)
+{
+    return releaseImpl(arrIndex, char_array);
+}
+
 
 std::size_t EclFile::size() const {
     return this->array_name.size();
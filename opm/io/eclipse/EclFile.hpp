@@ -57,6 +57,8 @@ public:
       char_array.clear();
     }
 
+    void clearData(int arrIndex);               // release data of single array, e.g., once it has been processed
+
     using EclEntry = std::tuple<std::string, eclArrType, std::int64_t>;
     std::vector<EclEntry> getList() const;
 
@@ -68,6 +70,9 @@ public:
     template <typename T>
     const std::vector<T>& get(const std::string& name);
 
+    template <typename T>
+    std::vector<T> release(int arrIndex);       // hand over data of single array and release it from this object
+
     bool hasKey(const std::string &name) const;
     std::size_t count(const std::string& name) const;
 
@@ -99,6 +104,9 @@ protected:
                                   const std::unordered_map<int, std::vector<T>>& array,
                                   const std::string& typeStr);
 
+    template<class T>
+    std::vector<T> releaseImpl(int arrIndex, std::unordered_map<int, std::vector<T>>& array);
+
     std::streampos
     seekPosition(const std::vector<std::string>::size_type arrIndex) const;
 
@@ -109,6 +117,13 @@ private:
     void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos);
     void load(bool preload);
 
+    // Decode array into its container without marking it as loaded.  Safe
+    // to call concurrently for distinct arrays, provided the container
+    // entries exist already (see reserveArrayStorage()).
+    void decodeBinaryArray(std::fstream& fileH, std::size_t arrIndex);
+    void decodeFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos);
+    void reserveArrayStorage(std::size_t arrIndex);
+
     std::vector<unsigned int> get_bin_logi_raw_values(int arrIndex) const;
     std::vector<std::string> get_fmt_real_raw_str_values(int arrIndex) const;
 
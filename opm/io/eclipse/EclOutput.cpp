@@ -22,7 +22,10 @@
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
+#include <array>
+#include <charconv>
 #include <cmath>
+#include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <iterator>
@@ -31,8 +34,137 @@
 #include <ios>
 #include <sstream>
 #include <stdexcept>
+#include <string_view>
 #include <typeinfo>
 
+#include <fmt/format.h>
+
+namespace {
+
+// Decompose 'value' into the printf("%.<precision>E") representation
+// d.ddd...E+XX.  Returns the digits, without the decimal point, and the
+// decimal exponent.
+int scientificDigits(const double value, const int precision,
+                     std::array<char, 32>& digits, std::size_t& numDigits)
+{
+    std::array<char, 40> buffer;
+    const auto res = fmt::format_to_n(buffer.data(), buffer.size(),
+                                      "{:.{}E}", std::abs(value), precision);
+
+    const auto* first = buffer.data();
+    const auto* last  = res.out;
+    const auto* expPos = std::find(first, last, 'E');
+
+    numDigits = 0;
+    for (const auto* p = first; p != expPos; ++p) {
+        if (*p != '.') {
+            digits[numDigits++] = *p;
+        }
+    }
+
+    const auto* expBegin = expPos + 1;
+    if ((expBegin != last) && (*expBegin == '+')) {
+        ++expBegin;
+    }
+
+    int exp = 0;
+    std::from_chars(expBegin, last, exp);
+
+    return exp;
+}
+
+bool appendSpecialValue(fmt::memory_buffer& out, const double value, const int width)
+{
+    if (std::isnan(value)) {
+        fmt::format_to(std::back_inserter(out), "{:>{}}", "NAN", width);
+        return true;
+    }
+
+    if (std::isinf(value)) {
+        fmt::format_to(std::back_inserter(out), "{:>{}}", (value > 0) ? "INF" : "-INF", width);
+        return true;
+    }
+
+    return false;
+}
+
+// ECLIPSE style representation 0.dddddddd<exp char>+XX with the mantissa
+// in the interval [0.1, 1).
+void appendEclipseScientific(fmt::memory_buffer& out,
+                             const double        value,
+                             const int           precision,
+                             const char          expChar,
+                             const bool          omitExpCharLargeExp,
+                             const int           width)
+{
+    std::array<char, 32> digits;
+    std::size_t numDigits = 0;
+
+    const auto exp = scientificDigits(value, precision, digits, numDigits);
+
+    std::array<char, 48> repr;
+    auto n = std::size_t{0};
+
+    if (value < 0.0) {
+        repr[n++] = '-';
+    }
+
+    repr[n++] = '0';
+    repr[n++] = '.';
+    for (auto i = 0*numDigits; i < numDigits; ++i) {
+        repr[n++] = digits[i];
+    }
+
+    if (!omitExpCharLargeExp || ((exp >= -100) && (exp < 99))) {
+        repr[n++] = expChar;
+    }
+
+    const auto res = fmt::format_to_n(repr.data() + n, repr.size() - n, "{:+03d}", exp + 1);
+    n += res.size;
+
+    fmt::format_to(std::back_inserter(out), "{:>{}}", std::string_view { repr.data(), n }, width);
+}
+
+void appendFormattedReal(fmt::memory_buffer& out, const float value, const int width, const bool ix_standard)
+{
+    if (value == 0.0) {
+        fmt::format_to(std::back_inserter(out), "{:>{}}",
+                       ix_standard ? " 0.0000000E+00" : "0.00000000E+00", width);
+        return;
+    }
+
+    if (appendSpecialValue(out, value, width)) {
+        return;
+    }
+
+    if (ix_standard) {
+        fmt::format_to(std::back_inserter(out), "{:>{}.7E}", static_cast<double>(value), width);
+    } else {
+        appendEclipseScientific(out, value, 7, 'E', false, width);
+    }
+}
+
+void appendFormattedDoub(fmt::memory_buffer& out, const double value, const int width, const bool ix_standard)
+{
+    if (value == 0.0) {
+        fmt::format_to(std::back_inserter(out), "{:>{}}",
+                       ix_standard ? " 0.0000000000000E+00" : "0.00000000000000D+00", width);
+        return;
+    }
+
+    if (appendSpecialValue(out, value, width)) {
+        return;
+    }
+
+    if (ix_standard) {
+        fmt::format_to(std::back_inserter(out), "{:>{}.13E}", value, width);
+    } else {
+        appendEclipseScientific(out, value, 13, 'D', true, width);
+    }
+}
+
+} // Anonymous namespace
+
 namespace Opm { namespace EclIO {
 
 EclOutput::EclOutput(const std::string&            filename,
@@ -454,141 +586,9 @@ void EclOutput::writeFormattedHeader(const std::string& arrName, int size, eclAr
 }
 
 
-std::string EclOutput::make_real_string_ecl(float value) const
-{
-    constexpr std::size_t buf_size = 15;
-    char buffer [buf_size];
-    std::snprintf (buffer, sizeof buffer, "%10.7E", value);
-
-    if (value == 0.0) {
-        return "0.00000000E+00";
-    } else {
-        if (std::isnan(value))
-            return "NAN";
-
-        if (std::isinf(value)) {
-            if (value > 0)
-                return "INF";
-            else
-                return "-INF";
-        }
-
-        std::string tmpstr(buffer);
-
-        int exp =  value < 0.0 ? std::stoi(tmpstr.substr(11, 3)) :  std::stoi(tmpstr.substr(10, 3));
-
-        if (value < 0.0) {
-            tmpstr = "-0." + tmpstr.substr(1, 1) + tmpstr.substr(3, 7) + "E";
-        } else {
-            tmpstr = "0." + tmpstr.substr(0, 1) + tmpstr.substr(2, 7) +"E";
-        }
-
-        std::snprintf (buffer, sizeof buffer, "%+03i", exp+1);
-        tmpstr = tmpstr+buffer;
-
-        return tmpstr;
-    }
-}
-
-std::string EclOutput::make_real_string_ix(float value) const
-{
-    constexpr std::size_t buf_size = 15;
-    char buffer [buf_size];
-    std::snprintf (buffer, sizeof buffer, "%10.7E", value);
-
-    if (value == 0.0) {
-        return " 0.0000000E+00";
-    } else {
-        if (std::isnan(value))
-            return "NAN";
-
-        if (std::isinf(value)) {
-            if (value > 0)
-                return "INF";
-            else
-                return "-INF";
-        }
-
-        std::string tmpstr(buffer);
-
-        return tmpstr;
-    }
-}
-
-
-std::string EclOutput::make_doub_string_ecl(double value) const
-{
-    char buffer [21 + 1];
-    std::snprintf (buffer, sizeof buffer, "%19.13E", value);
-
-    if (value == 0.0) {
-        return "0.00000000000000D+00";
-    } else {
-        if (std::isnan(value))
-            return "NAN";
-
-        if (std::isinf(value)) {
-            if (value > 0)
-                return "INF";
-            else
-                return "-INF";
-        }
-
-        std::string tmpstr(buffer);
-        int exp = value < 0.0 ? std::stoi(tmpstr.substr(17, 4)) : std::stoi(tmpstr.substr(16, 4));
-        const bool use_exp_char = (exp >= -100) && (exp < 99);
-
-        if (value < 0.0) {
-            if (use_exp_char) {
-                tmpstr = "-0." + tmpstr.substr(1, 1) + tmpstr.substr(3, 13) + "D";
-            } else {
-                tmpstr = "-0." + tmpstr.substr(1, 1) + tmpstr.substr(3, 13);
-            }
-        } else {
-            if (use_exp_char) {
-                tmpstr = "0." + tmpstr.substr(0, 1) + tmpstr.substr(2, 13) + "D";
-            } else {
-                tmpstr = "0." + tmpstr.substr(0, 1) + tmpstr.substr(2, 13);
-            }
-        }
-
-        std::snprintf(buffer, sizeof buffer, "%+03i", exp + 1);
-        tmpstr = tmpstr + buffer;
-        return tmpstr;
-    }
-}
-
-std::string EclOutput::make_doub_string_ix(double value) const
-{
-    char buffer [21];
-    std::snprintf (buffer, sizeof buffer, "%19.13E", value);
-
-    if (value == 0.0) {
-        return " 0.0000000000000E+00";
-    } else {
-        if (std::isnan(value))
-            return "NAN";
-
-        if (std::isinf(value)) {
-            if (value > 0)
-                return "INF";
-            else
-                return "-INF";
-        }
-
-        std::string tmpstr(buffer);
-
-        return tmpstr;
-    }
-}
-
-
 template <typename T>
 void EclOutput::writeFormattedArray(const std::vector<T>& data)
 {
-    int size = data.size();
-    int n = 0;
-
     eclArrType arrType = MESS;
     if (typeid(T) == typeid(int)) {
         arrType = INTE;
@@ -600,54 +600,79 @@ void EclOutput::writeFormattedArray(const std::vector<T>& data)
         arrType = LOGI;
     }
 
+    const auto sizeData = block_size_data_formatted(arrType);
 
-    auto sizeData = block_size_data_formatted(arrType);
+    const auto maxBlockSize = static_cast<std::size_t>(std::get<0>(sizeData));
+    const auto nColumns     = static_cast<std::size_t>(std::get<1>(sizeData));
+    const auto columnWidth  = std::get<2>(sizeData);
 
-    int maxBlockSize = std::get<0>(sizeData);
-    int nColumns = std::get<1>(sizeData);
-    int columnWidth = std::get<2>(sizeData);
-
-    for (int i = 0; i < size; i++) {
-        n++;
-
-        switch (arrType) {
-        case INTE:
-            ofileH << std::setw(columnWidth) << data[i];
-            break;
-        case REAL:
-            if (ix_standard)
-                ofileH << std::setw(columnWidth) << make_real_string_ix(data[i]);
-            else
-                ofileH << std::setw(columnWidth) << make_real_string_ecl(data[i]);
-            break;
-        case DOUB:
-            if (ix_standard)
-                ofileH << std::setw(columnWidth) << make_doub_string_ix(data[i]);
-            else
-                ofileH << std::setw(columnWidth) << make_doub_string_ecl(data[i]);
-            break;
-        case LOGI:
-            if (data[i]) {
-                ofileH << "  T";
-            } else {
-                ofileH << "  F";
+    // Format elements [begin, end) of a single block of at most
+    // maxBlockSize elements.  Every block ends with a newline.
+    auto formatBlock = [this, arrType, nColumns, columnWidth, &data]
+        (fmt::memory_buffer& out, const std::size_t begin, const std::size_t end)
+    {
+        for (auto i = begin; i < end; ++i) {
+            switch (arrType) {
+            case INTE:
+                fmt::format_to(std::back_inserter(out), "{:>{}}", data[i], columnWidth);
+                break;
+            case REAL:
+                appendFormattedReal(out, static_cast<float>(data[i]), columnWidth, this->ix_standard);
+                break;
+            case DOUB:
+                appendFormattedDoub(out, static_cast<double>(data[i]), columnWidth, this->ix_standard);
+                break;
+            case LOGI:
+                out.append(std::string_view { data[i] ? "  T" : "  F" });
+                break;
+            default:
+                break;
+            }
+
+            if (((i - begin + 1) % nColumns) == 0) {
+                out.push_back('\n');
             }
-            break;
-        default:
-            break;
         }
 
-        if ((n % nColumns) == 0 || (n % maxBlockSize) == 0) {
-            ofileH << std::endl;
+        if (((end - begin) % nColumns) != 0) {
+            out.push_back('\n');
         }
+    };
+
+    // Blocks are independent of each other, so large arrays are formatted
+    // into per-chunk buffers concurrently.  The buffers are written in
+    // order which makes the output identical to sequential formatting.
+    // Memory use is bounded by formatting at most 'numChunkBuffers'
+    // chunks before writing.
+    constexpr std::size_t blocksPerChunk  = 64;
+    constexpr std::size_t numChunkBuffers = 16;
+
+    const auto size      = data.size();
+    const auto numBlocks = (size + maxBlockSize - 1) / maxBlockSize;
+    const auto numChunks = (numBlocks + blocksPerChunk - 1) / blocksPerChunk;
 
-        if ((n % maxBlockSize) == 0) {
-            n=0;
+    std::vector<fmt::memory_buffer> chunks(std::min(numChunks, numChunkBuffers));
+
+    for (auto first = std::size_t{0}; first < numChunks; first += chunks.size()) {
+        const auto numInRound = static_cast<int>(std::min(chunks.size(), numChunks - first));
+
+#pragma omp parallel for schedule(static) if (numInRound > 1)
+        for (int c = 0; c < numInRound; ++c) {
+            auto& out = chunks[c];
+            out.clear();
+
+            const auto firstBlock = (first + c) * blocksPerChunk;
+            const auto lastBlock  = std::min(firstBlock + blocksPerChunk, numBlocks);
+
+            for (auto block = firstBlock; block < lastBlock; ++block) {
+                formatBlock(out, block * maxBlockSize,
+                            std::min((block + 1) * maxBlockSize, size));
+            }
         }
-    }
 
-    if ((n % nColumns) != 0 && (n % maxBlockSize) != 0) {
-        ofileH << std::endl;
+        for (int c = 0; c < numInRound; ++c) {
+            ofileH.write(chunks[c].data(), chunks[c].size());
+        }
     }
 }
 
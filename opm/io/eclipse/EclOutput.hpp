@@ -105,10 +105,6 @@ private:
     void writeFormattedCharArray(const std::vector<PaddedOutputString<8>>& data);
 
     void writeArrayType(const eclArrType arrType);
-    std::string make_real_string_ecl(float value) const;
-    std::string make_real_string_ix(float value) const;
-    std::string make_doub_string_ecl(double value) const;
-    std::string make_doub_string_ix(double value) const;
 
     bool isFormatted, ix_standard;
     std::ofstream ofileH;
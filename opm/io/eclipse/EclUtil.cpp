@@ -22,10 +22,15 @@
 
 #include <algorithm>
 #include <array>
+#include <charconv>
+#include <exception>
+#include <numeric>
 #include <stdexcept>
 #include <cmath>
 #include <fstream>
+#include <cstdlib>
 #include <cstring>
+#include <system_error>
 
 int Opm::EclIO::flipEndianInt(int num)
 {
@@ -554,6 +559,215 @@ std::vector<std::string> Opm::EclIO::readBinaryC0nnArray(std::fstream& fileH, co
 }
 
 
+namespace {
+
+bool isFormattedSeparator(const char c)
+{
+    return (c == ' ') || (c == '\n') || (c == '\r') || (c == '\t');
+}
+
+// Number of array elements below which decoding a formatted array is not
+// worth distributing across threads.
+constexpr std::int64_t minParallelFormattedArraySize = 1 << 16;
+
+// Number of characters processed by a single decoding task.
+constexpr std::int64_t formattedDecodeChunkSize = 1 << 20;
+
+const char* skipSeparators(const char* p, const char* end)
+{
+    while ((p != end) && isFormattedSeparator(*p)) {
+        ++p;
+    }
+
+    return p;
+}
+
+const char* skipToken(const char* p, const char* end)
+{
+    while ((p != end) && !isFormattedSeparator(*p)) {
+        ++p;
+    }
+
+    return p;
+}
+
+[[noreturn]] void throwConversionError(const char* begin, const char* end, const std::string& type)
+{
+    OPM_THROW(std::invalid_argument,
+              "Could not convert '" + std::string(begin, end) + "' to " + type + " value");
+}
+
+int parseFormattedInte(const char* begin, const char* end)
+{
+    if ((begin != end) && (*begin == '+')) {
+        ++begin;
+    }
+
+    int value = 0;
+    const auto [ptr, ec] = std::from_chars(begin, end, value);
+    if ((ec != std::errc{}) || (ptr == begin)) {
+        throwConversionError(begin, end, "an integer");
+    }
+
+    return value;
+}
+
+// Formatted output files use 'D' as the exponent character of double
+// precision values and omit the exponent character altogether for three
+// digit exponents, e.g., "0.12345678901234-100".  Normalise the token into
+// a local buffer before conversion to avoid per-value heap allocations.
+double parseFormattedFloatingPoint(const char* begin, const char* end)
+{
+    std::array<char, 64> buffer;
+
+    auto n = std::size_t{0};
+    auto hasExponent = false;
+
+    for (auto p = begin; p != end; ++p) {
+        if (n + 2 >= buffer.size()) {
+            throwConversionError(begin, end, "a floating-point");
+        }
+
+        auto c = *p;
+        if ((c == 'D') || (c == 'd')) {
+            c = 'E';
+        }
+
+        if ((c == 'E') || (c == 'e')) {
+            hasExponent = true;
+        }
+        else if (((c == '+') || (c == '-')) && (n > 0) && !hasExponent) {
+            buffer[n++] = 'E';
+            hasExponent = true;
+        }
+
+        buffer[n++] = c;
+    }
+
+    const char* first = buffer.data();
+    const char* last  = buffer.data() + n;
+
+    if ((first != last) && (*first == '+')) {
+        ++first;
+    }
+
+    double value = 0.0;
+
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+    const auto [ptr, ec] = std::from_chars(first, last, value);
+    if ((ec != std::errc{}) || (ptr == first)) {
+        throwConversionError(begin, end, "a floating-point");
+    }
+#else
+    buffer[n] = '\0';
+
+    char* ptr = nullptr;
+    value = std::strtod(first, &ptr);
+    if (ptr == first) {
+        throwConversionError(begin, end, "a floating-point");
+    }
+#endif
+
+    return value;
+}
+
+// Decode the first 'size' whitespace separated values starting at
+// position 'fromPos' of 'file_str'.  Large arrays are split into chunks
+// of characters, aligned on value boundaries, which are decoded
+// concurrently.  A first pass counts the number of values in each chunk
+// to determine the chunk's offset into the result array.
+template <typename T, typename Convert>
+std::vector<T> decodeFormattedArray(const std::string& file_str,
+                                    const std::int64_t size,
+                                    const std::int64_t fromPos,
+                                    Convert&&          convert)
+{
+    std::vector<T> arr(size);
+
+    const char* begin = file_str.data() + std::min(fromPos, static_cast<std::int64_t>(file_str.size()));
+    const char* end   = file_str.data() + file_str.size();
+
+    const auto numChunks = (size < minParallelFormattedArraySize)
+        ? std::int64_t{1}
+        : std::max(std::int64_t{1}, (end - begin) / formattedDecodeChunkSize);
+
+    if (numChunks == 1) {
+        auto p = begin;
+        for (std::int64_t i = 0; i < size; ++i) {
+            p = skipSeparators(p, end);
+            const auto q = skipToken(p, end);
+
+            arr[i] = convert(p, q);
+
+            p = q;
+        }
+
+        return arr;
+    }
+
+    // Chunk 'c' is [bounds[c], bounds[c + 1]).  Each boundary, except the
+    // first, is moved forward to the next value separator.
+    std::vector<const char*> bounds(numChunks + 1, end);
+    bounds[0] = begin;
+    for (std::int64_t c = 1; c < numChunks; ++c) {
+        bounds[c] = std::max(bounds[c - 1],
+                             skipToken(begin + c*((end - begin) / numChunks), end));
+    }
+
+    std::vector<std::int64_t> offset(numChunks + 1, 0);
+
+#pragma omp parallel for schedule(static)
+    for (std::int64_t c = 0; c < numChunks; ++c) {
+        auto count = std::int64_t{0};
+        for (auto p = skipSeparators(bounds[c], bounds[c + 1]);
+             p != bounds[c + 1];
+             p = skipSeparators(skipToken(p, bounds[c + 1]), bounds[c + 1]))
+        {
+            ++count;
+        }
+
+        offset[c + 1] = count;
+    }
+
+    std::partial_sum(offset.begin(), offset.end(), offset.begin());
+
+    if (offset.back() < size) {
+        OPM_THROW(std::runtime_error,
+                  "Formatted array holds " + std::to_string(offset.back()) +
+                  " values, expected " + std::to_string(size));
+    }
+
+    std::vector<std::exception_ptr> failures(numChunks);
+
+#pragma omp parallel for schedule(static)
+    for (std::int64_t c = 0; c < numChunks; ++c) {
+        try {
+            auto p = bounds[c];
+            for (auto i = offset[c]; i < std::min(offset[c + 1], size); ++i) {
+                p = skipSeparators(p, bounds[c + 1]);
+                const auto q = skipToken(p, bounds[c + 1]);
+
+                arr[i] = convert(p, q);
+
+                p = q;
+            }
+        }
+        catch (...) {
+            failures[c] = std::current_exception();
+        }
+    }
+
+    for (const auto& failure : failures) {
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
+
+    return arr;
+}
+
+} // Anonymous namespace
+
 template<typename T>
 std::vector<T> Opm::EclIO::readFormattedArray(const std::string& file_str, const int size, std::int64_t fromPos,
                                  std::function<T(const std::string&)>& process)
@@ -579,13 +793,7 @@ std::vector<T> Opm::EclIO::readFormattedArray(const std::string& file_str, const
 
 std::vector<int> Opm::EclIO::readFormattedInteArray(const std::string& file_str, const std::int64_t size, std::int64_t fromPos)
 {
-
-    std::function<int(const std::string&)> f = [](const std::string& val)
-                                               {
-                                                   return std::stoi(val);
-                                               };
-
-    return readFormattedArray(file_str, size, fromPos, f);
+    return decodeFormattedArray<int>(file_str, size, fromPos, &parseFormattedInte);
 }
 
 
@@ -616,16 +824,13 @@ std::vector<std::string> Opm::EclIO::readFormattedCharArray(const std::string& f
 
 std::vector<float> Opm::EclIO::readFormattedRealArray(const std::string& file_str, const std::int64_t size, std::int64_t fromPos)
 {
-
-    std::function<float(const std::string&)> f = [](const std::string& val)
-                                                 {
-                                                     // tskille: temporary fix, need to be discussed. OPM flow writes numbers
-                                                     // that are outside valid range for float, and function stof will fail
-                                                     double dtmpv = std::stod(val);
-                                                     return dtmpv;
-                                                 };
-
-    return readFormattedArray<float>(file_str, size, fromPos, f);
+    // tskille: temporary fix, need to be discussed. OPM flow writes numbers
+    // that are outside valid range for float, so parse as double.
+    return decodeFormattedArray<float>(file_str, size, fromPos,
+                                       [](const char* begin, const char* end)
+                                       {
+                                           return static_cast<float>(parseFormattedFloatingPoint(begin, end));
+                                       });
 }
 
 std::vector<std::string> Opm::EclIO::readFormattedRealRawStrings(const std::string& file_str, const std::int64_t size, std::int64_t fromPos)
@@ -661,26 +866,6 @@ std::vector<bool> Opm::EclIO::readFormattedLogiArray(const std::string& file_str
 
 std::vector<double> Opm::EclIO::readFormattedDoubArray(const std::string& file_str, const std::int64_t size, std::int64_t fromPos)
 {
-
-    std::function<double(const std::string&)> f = [](std::string val)
-                                                  {
-                                                      auto p1 = val.find_first_of("D");
-
-                                                      if (p1 != std::string::npos) {
-                                                          val.replace(p1,1,"E");
-                                                      }
-
-                                                      p1 = val.find_first_of("E");
-
-                                                      if (p1 == std::string::npos) {
-                                                          auto p2 = val.find_first_of("-+", 1);
-
-                                                          if (p2 != std::string::npos)
-                                                              val = val.insert(p2,"E");
-                                                      }
-                                                      return std::stod(val);
-                                                  };
-
-    return readFormattedArray<double>(file_str, size, fromPos, f);
+    return decodeFormattedArray<double>(file_str, size, fromPos, &parseFormattedFloatingPoint);
 }
 
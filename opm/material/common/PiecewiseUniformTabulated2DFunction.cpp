@@ -0,0 +1,179 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+#include <config.h>
+#include <opm/material/common/PiecewiseUniformTabulated2DFunction.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <ostream>
+
+namespace {
+
+constexpr char binaryMagic[8] = {'O', 'P', 'M', 'P', 'U', '2', 'D', '\0'};
+constexpr std::uint32_t binaryVersion = 1;
+
+// a sane upper bound which protects against allocating garbage sizes
+constexpr std::uint64_t maxSamples = std::uint64_t{1} << 28;
+
+template<class T>
+void writeValue(std::ostream& os, const T& value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<class T>
+void writeVector(std::ostream& os, const std::vector<T>& values)
+{
+    writeValue(os, static_cast<std::uint64_t>(values.size()));
+    os.write(reinterpret_cast<const char*>(values.data()), values.size()*sizeof(T));
+}
+
+template<class T>
+T readValue(std::istream& is)
+{
+    T value{};
+    if (!is.read(reinterpret_cast<char*>(&value), sizeof(T)))
+        throw std::runtime_error("Unexpected end of binary 2D table data");
+
+    return value;
+}
+
+template<class T>
+std::vector<T> readVector(std::istream& is, std::size_t maxSize)
+{
+    const auto size = readValue<std::uint64_t>(is);
+    if (size > maxSize)
+        throw std::runtime_error("Corrupt binary 2D table data: unexpected array size "
+                                 + std::to_string(size));
+
+    std::vector<T> values(size);
+    if (!is.read(reinterpret_cast<char*>(values.data()), values.size()*sizeof(T)))
+        throw std::runtime_error("Unexpected end of binary 2D table data");
+
+    return values;
+}
+
+template<class Scalar>
+void writeAxis(std::ostream& os, const Opm::PiecewiseUniformAxis<Scalar>& axis)
+{
+    writeVector(os, axis.breakPoints());
+    writeVector(os, axis.numCells());
+}
+
+template<class Scalar>
+Opm::PiecewiseUniformAxis<Scalar> readAxis(std::istream& is)
+{
+    // a sane upper bound which protects against allocating garbage sizes
+    constexpr std::size_t maxSegments = 1 << 20;
+
+    const auto breakPoints = readVector<Scalar>(is, maxSegments + 1);
+    const auto numCells = readVector<unsigned>(is, maxSegments);
+
+    try {
+        return Opm::PiecewiseUniformAxis<Scalar>(breakPoints, numCells);
+    }
+    catch (const std::invalid_argument& e) {
+        throw std::runtime_error(std::string("Corrupt binary 2D table data: ") + e.what());
+    }
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+template<class Scalar>
+void PiecewiseUniformTabulated2DFunction<Scalar>::writeBinary(std::ostream& os) const
+{
+    os.write(binaryMagic, sizeof(binaryMagic));
+    writeValue(os, binaryVersion);
+    writeValue(os, static_cast<std::uint32_t>(sizeof(Scalar)));
+
+    writeAxis(os, xAxis_);
+    writeAxis(os, yAxis_);
+    writeVector(os, samples_);
+
+    if (!os)
+        throw std::runtime_error("Could not write binary 2D table data");
+}
+
+template<class Scalar>
+PiecewiseUniformTabulated2DFunction<Scalar>
+PiecewiseUniformTabulated2DFunction<Scalar>::readBinary(std::istream& is)
+{
+    char magic[sizeof(binaryMagic)];
+    if (!is.read(magic, sizeof(magic)) ||
+        std::memcmp(magic, binaryMagic, sizeof(magic)) != 0)
+    {
+        throw std::runtime_error("Stream does not contain a binary 2D table");
+    }
+
+    const auto version = readValue<std::uint32_t>(is);
+    if (version != binaryVersion)
+        throw std::runtime_error("Unsupported binary 2D table version "
+                                 + std::to_string(version));
+
+    const auto scalarSize = readValue<std::uint32_t>(is);
+    if (scalarSize != sizeof(Scalar))
+        throw std::runtime_error("Binary 2D table uses " + std::to_string(scalarSize)
+                                 + " byte values, expected " + std::to_string(sizeof(Scalar)));
+
+    PiecewiseUniformTabulated2DFunction result;
+    result.xAxis_ = readAxis<Scalar>(is);
+    result.yAxis_ = readAxis<Scalar>(is);
+
+    // both factors are below 2^32, so the product does not overflow
+    const std::uint64_t numSamples =
+        static_cast<std::uint64_t>(result.xAxis_.numPoints())*result.yAxis_.numPoints();
+    if (numSamples > maxSamples)
+        throw std::runtime_error("Corrupt binary 2D table data: "
+                                 + std::to_string(result.xAxis_.numPoints()) + " times "
+                                 + std::to_string(result.yAxis_.numPoints())
+                                 + " sampling points exceed the supported table size");
+
+    result.samples_ = readVector<Scalar>(is, numSamples);
+    if (result.samples_.size() != numSamples)
+        throw std::runtime_error("Corrupt binary 2D table data: expected "
+                                 + std::to_string(numSamples) + " samples, got "
+                                 + std::to_string(result.samples_.size()));
+
+    return result;
+}
+
+template<class Scalar>
+PiecewiseUniformTabulated2DFunction<Scalar>
+PiecewiseUniformTabulated2DFunction<Scalar>::readBinaryFile(const std::string& fileName)
+{
+    std::ifstream is(fileName, std::ios::binary);
+    if (!is)
+        throw std::runtime_error("Could not open binary 2D table file '" + fileName + "'");
+
+    return readBinary(is);
+}
+
+template class PiecewiseUniformTabulated2DFunction<double>;
+template class PiecewiseUniformTabulated2DFunction<float>;
+
+} // namespace Opm
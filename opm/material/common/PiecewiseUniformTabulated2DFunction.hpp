@@ -0,0 +1,465 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \copydoc Opm::PiecewiseUniformTabulated2DFunction
+ */
+#ifndef OPM_PIECEWISE_UNIFORM_TABULATED_2D_FUNCTION_HPP
+#define OPM_PIECEWISE_UNIFORM_TABULATED_2D_FUNCTION_HPP
+
+#include <opm/common/Exceptions.hpp>
+
+#include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/UniformTabulated2DFunction.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief A sampling axis which is split into segments, each of which is sampled
+ *        uniformly.
+ *
+ * Segments may use different resolutions, which allows refining the sampling
+ * locally, e.g. around the critical point of a component. The segment which contains a
+ * given position is found using a uniform bucket index on top of the segments. Unless
+ * the axis has segments much shorter than 1/65536 of its range, each bucket overlaps at
+ * most two segments and locating a cell takes constant time. Otherwise the segments
+ * overlapping a bucket are bisected.
+ */
+template <class Scalar>
+class PiecewiseUniformAxis
+{
+public:
+    /*!
+     * \brief A range of the axis which is sampled with a finer resolution.
+     *
+     * The refinement factor divides the base cell size of the axis.
+     */
+    using Refinement = std::tuple</*min=*/Scalar, /*max=*/Scalar, /*factor=*/unsigned>;
+
+    PiecewiseUniformAxis() = default;
+
+    /*!
+     * \brief Create an axis from the boundaries of its segments and the number of
+     *        cells of each segment.
+     */
+    PiecewiseUniformAxis(const std::vector<Scalar>& breakPoints,
+                         const std::vector<unsigned>& numCells)
+        : breakPoints_(breakPoints)
+        , numCells_(numCells)
+    {
+        if (breakPoints_.size() < 2 || numCells_.size() + 1 != breakPoints_.size())
+            throw std::invalid_argument("A piecewise uniform axis needs one more break "
+                                        "point than it has segments");
+
+        std::uint64_t numPoints = 1;
+        for (std::size_t k = 0; k < numCells_.size(); ++k) {
+            if (!(breakPoints_[k] < breakPoints_[k + 1]))
+                throw std::invalid_argument("The break points of a piecewise uniform axis "
+                                            "must be strictly increasing");
+            if (numCells_[k] == 0)
+                throw std::invalid_argument("Each segment of a piecewise uniform axis "
+                                            "needs at least one cell");
+
+            numPoints += numCells_[k];
+            if (numPoints > std::numeric_limits<unsigned>::max())
+                throw std::invalid_argument("A piecewise uniform axis may have at most "
+                                            + std::to_string(std::numeric_limits<unsigned>::max())
+                                            + " sampling points");
+        }
+
+        buildIndex_();
+    }
+
+    /*!
+     * \brief Create an axis with uniform cells of a given base size, which are
+     *        subdivided within a number of refinement ranges.
+     *
+     * The refinement ranges are snapped to the base cells. Where refinement ranges
+     * overlap, the largest factor is used.
+     */
+    static PiecewiseUniformAxis refined(Scalar min, Scalar max, unsigned numBaseCells,
+                                        const std::vector<Refinement>& refinements = {})
+    {
+        if (!(min < max) || numBaseCells == 0)
+            throw std::invalid_argument("Invalid range or resolution for a piecewise uniform axis");
+
+        const Scalar h = (max - min)/numBaseCells;
+        const auto snap = [min, h, numBaseCells](Scalar x) {
+            const Scalar pos = std::round((x - min)/h);
+            return static_cast<unsigned>(std::clamp<Scalar>(pos, 0, numBaseCells));
+        };
+
+        std::vector<unsigned> cuts = {0, numBaseCells};
+        for (const auto& [rMin, rMax, factor] : refinements) {
+            cuts.push_back(snap(rMin));
+            cuts.push_back(snap(rMax));
+        }
+        std::sort(cuts.begin(), cuts.end());
+        cuts.erase(std::unique(cuts.begin(), cuts.end()), cuts.end());
+
+        std::vector<Scalar> breakPoints;
+        std::vector<unsigned> numCells;
+        for (std::size_t k = 0; k + 1 < cuts.size(); ++k) {
+            unsigned factor = 1;
+            for (const auto& [rMin, rMax, rFactor] : refinements) {
+                if (snap(rMin) <= cuts[k] && cuts[k + 1] <= snap(rMax))
+                    factor = std::max(factor, rFactor);
+            }
+
+            breakPoints.push_back(min + cuts[k]*h);
+            numCells.push_back((cuts[k + 1] - cuts[k])*factor);
+        }
+        breakPoints.push_back(max);
+
+        return PiecewiseUniformAxis(breakPoints, numCells);
+    }
+
+    /*!
+     * \brief Returns the position of the first sampling point.
+     */
+    Scalar min() const
+    { return breakPoints_.front(); }
+
+    /*!
+     * \brief Returns the position of the last sampling point.
+     */
+    Scalar max() const
+    { return breakPoints_.back(); }
+
+    /*!
+     * \brief Returns the number of sampling points.
+     */
+    unsigned numPoints() const
+    { return firstPoint_.back() + 1; }
+
+    /*!
+     * \brief Returns the position of the i-th sampling point.
+     */
+    Scalar pointAt(unsigned i) const
+    {
+        assert(i < numPoints());
+
+        if (i + 1 == numPoints())
+            return max();
+
+        const std::size_t k = std::upper_bound(firstPoint_.begin(), firstPoint_.end(), i)
+                            - firstPoint_.begin() - 1;
+        return breakPoints_[k] + (i - firstPoint_[k])*cellWidth_[k];
+    }
+
+    /*!
+     * \brief Return the index of the cell which contains a position and the relative
+     *        position within that cell.
+     *
+     * Positions outside of the axis are mapped to the first or last cell, with a
+     * relative position outside of [0, 1].
+     */
+    template <class Evaluation>
+    unsigned cellIndex(const Evaluation& x, Evaluation& alpha) const
+    {
+        const Scalar xv = scalarValue(x);
+        const std::size_t numSegments = numCells_.size();
+
+        std::size_t k = 0;
+        if (!(xv > min()))
+            k = 0;
+        else if (xv >= max())
+            k = numSegments - 1;
+        else {
+            const std::size_t bucket =
+                std::min(static_cast<std::size_t>((xv - min())*bucketScale_),
+                         bucketSegment_.size() - 2);
+
+            // bisect the segments overlapping the bucket, usually one or two
+            const auto first = breakPoints_.begin() + bucketSegment_[bucket] + 1;
+            const auto last = breakPoints_.begin() + bucketSegment_[bucket + 1] + 1;
+            k = std::upper_bound(first, last, xv) - breakPoints_.begin() - 1;
+
+            // the bucket index may be off by one due to rounding
+            if (xv < breakPoints_[k])
+                --k;
+            else if (k + 1 < numSegments && xv >= breakPoints_[k + 1])
+                ++k;
+        }
+
+        const Evaluation pos = (x - breakPoints_[k])/cellWidth_[k];
+        const Scalar cell = std::floor(static_cast<Scalar>(scalarValue(pos)));
+        const unsigned local =
+            (cell > 0) ? static_cast<unsigned>(std::min<Scalar>(cell, numCells_[k] - 1)) : 0;
+        alpha = pos - local;
+
+        return firstPoint_[k] + local;
+    }
+
+    const std::vector<Scalar>& breakPoints() const
+    { return breakPoints_; }
+
+    const std::vector<unsigned>& numCells() const
+    { return numCells_; }
+
+    bool operator==(const PiecewiseUniformAxis<Scalar>& data) const
+    {
+        return breakPoints_ == data.breakPoints_ &&
+               numCells_ == data.numCells_;
+    }
+
+private:
+    void buildIndex_()
+    {
+        const std::size_t numSegments = numCells_.size();
+
+        firstPoint_.resize(numSegments + 1);
+        cellWidth_.resize(numSegments);
+        firstPoint_[0] = 0;
+        Scalar minLength = max() - min();
+        for (std::size_t k = 0; k < numSegments; ++k) {
+            const Scalar length = breakPoints_[k + 1] - breakPoints_[k];
+            cellWidth_[k] = length/numCells_[k];
+            firstPoint_[k + 1] = firstPoint_[k] + numCells_[k];
+            minLength = std::min(minLength, length);
+        }
+
+        // Buckets no wider than the shortest segment overlap at most two segments.
+        // The number of buckets is capped, so for axes with very short segments a
+        // bucket may overlap more of them.
+        const Scalar range = max() - min();
+        const std::size_t numBuckets =
+            static_cast<std::size_t>(std::clamp<Scalar>(std::ceil(range/minLength),
+                                                        1, maxBuckets_));
+        bucketScale_ = numBuckets/range;
+
+        // the segments containing the start of each bucket and the end of the last one
+        bucketSegment_.resize(numBuckets + 1);
+        bucketSegment_[numBuckets] = numSegments - 1;
+        for (std::size_t b = 0; b < numBuckets; ++b) {
+            const Scalar start = min() + b/bucketScale_;
+            const std::size_t k = std::upper_bound(breakPoints_.begin(), breakPoints_.end(), start)
+                                - breakPoints_.begin() - 1;
+            bucketSegment_[b] = std::min(k, numSegments - 1);
+        }
+    }
+
+    static constexpr std::size_t maxBuckets_ = 1 << 16;
+
+    std::vector<Scalar> breakPoints_;
+    std::vector<unsigned> numCells_;
+
+    // the index of the first sampling point and the cell width of each segment
+    std::vector<unsigned> firstPoint_;
+    std::vector<Scalar> cellWidth_;
+
+    // the segment which contains the start of each uniform bucket, and the last
+    // segment
+    Scalar bucketScale_ = 0.0;
+    std::vector<std::size_t> bucketSegment_;
+};
+
+/*!
+ * \brief Implements a scalar function that depends on two variables and which is
+ *        sampled on a tensor product of two piecewise uniform axes.
+ *
+ * This allows a higher resolution in regions where the function varies rapidly,
+ * e.g. close to the critical point of a component, without increasing the resolution
+ * of the whole table. Tables can be sampled from a function at run time and stored
+ * to and loaded from a compact binary file.
+ */
+template <class Scalar>
+class PiecewiseUniformTabulated2DFunction
+{
+public:
+    using Axis = PiecewiseUniformAxis<Scalar>;
+
+    PiecewiseUniformTabulated2DFunction() = default;
+
+    PiecewiseUniformTabulated2DFunction(const Axis& xAxis, const Axis& yAxis)
+        : xAxis_(xAxis)
+        , yAxis_(yAxis)
+        , samples_(static_cast<std::size_t>(xAxis.numPoints())*yAxis.numPoints())
+    { }
+
+    /*!
+     * \brief Create a table by sampling a function f(x, y) at all sampling points.
+     */
+    template <class Fn>
+    PiecewiseUniformTabulated2DFunction(const Axis& xAxis, const Axis& yAxis, const Fn& f)
+        : PiecewiseUniformTabulated2DFunction(xAxis, yAxis)
+    {
+        for (unsigned j = 0; j < numY(); ++j) {
+            const Scalar y = jToY(j);
+            for (unsigned i = 0; i < numX(); ++i)
+                setSamplePoint(i, j, f(iToX(i), y));
+        }
+    }
+
+    /*!
+     * \brief Create a table with the sampling points of a uniform table.
+     */
+    explicit PiecewiseUniformTabulated2DFunction(const UniformTabulated2DFunction<Scalar>& table)
+        : PiecewiseUniformTabulated2DFunction(Axis({table.xMin(), table.xMax()}, {table.numX() - 1}),
+                                              Axis({table.yMin(), table.yMax()}, {table.numY() - 1}))
+    {
+        for (unsigned j = 0; j < numY(); ++j)
+            for (unsigned i = 0; i < numX(); ++i)
+                setSamplePoint(i, j, table.getSamplePoint(i, j));
+    }
+
+    const Axis& xAxis() const
+    { return xAxis_; }
+
+    const Axis& yAxis() const
+    { return yAxis_; }
+
+    Scalar xMin() const
+    { return xAxis_.min(); }
+
+    Scalar xMax() const
+    { return xAxis_.max(); }
+
+    Scalar yMin() const
+    { return yAxis_.min(); }
+
+    Scalar yMax() const
+    { return yAxis_.max(); }
+
+    unsigned numX() const
+    { return xAxis_.numPoints(); }
+
+    unsigned numY() const
+    { return yAxis_.numPoints(); }
+
+    Scalar iToX(unsigned i) const
+    { return xAxis_.pointAt(i); }
+
+    Scalar jToY(unsigned j) const
+    { return yAxis_.pointAt(j); }
+
+    /*!
+     * \brief Returns true if a coordinate lies in the tabulated range
+     */
+    template <class Evaluation>
+    bool applies(const Evaluation& x, const Evaluation& y) const
+    {
+        return
+            xMin() <= x && x <= xMax() &&
+            yMin() <= y && y <= yMax();
+    }
+
+    /*!
+     * \brief Evaluate the function at a given (x,y) position.
+     *
+     * If this method is called for a value outside of the tabulated
+     * range, a \c Opm::NumericalProblem exception is thrown unless extrapolation
+     * is requested.
+     */
+    template <class Evaluation>
+    Evaluation eval(const Evaluation& x,
+                    const Evaluation& y,
+                    [[maybe_unused]] bool extrapolate) const
+    {
+#ifndef NDEBUG
+        if (!extrapolate && !applies(x, y)) {
+            throw NumericalProblem("Attempt to get tabulated value for ("
+                                   + std::to_string(double(scalarValue(x))) + ", "
+                                   + std::to_string(double(scalarValue(y)))
+                                   + ") on a table of extent "
+                                   + std::to_string(xMin()) + " to " + std::to_string(xMax())
+                                   + " times "
+                                   + std::to_string(yMin()) + " to " + std::to_string(yMax()));
+        }
+#endif
+
+        Evaluation alpha, beta;
+        const unsigned i = xAxis_.cellIndex(x, alpha);
+        const unsigned j = yAxis_.cellIndex(y, beta);
+
+        // bi-linear interpolation
+        const Evaluation& s1 = getSamplePoint(i, j)*(1.0 - alpha) + getSamplePoint(i + 1, j)*alpha;
+        const Evaluation& s2 = getSamplePoint(i, j + 1)*(1.0 - alpha) + getSamplePoint(i + 1, j + 1)*alpha;
+        return s1*(1.0 - beta) + s2*beta;
+    }
+
+    Scalar getSamplePoint(unsigned i, unsigned j) const
+    {
+        assert(i < numX());
+        assert(j < numY());
+
+        return samples_[static_cast<std::size_t>(j)*numX() + i];
+    }
+
+    void setSamplePoint(unsigned i, unsigned j, Scalar value)
+    {
+        assert(i < numX());
+        assert(j < numY());
+
+        samples_[static_cast<std::size_t>(j)*numX() + i] = value;
+    }
+
+    /*!
+     * \brief Write the table to a binary stream.
+     *
+     * The data is written in the native byte order and floating point format, so
+     * files are meant to be read on the same kind of platform.
+     */
+    void writeBinary(std::ostream& os) const;
+
+    /*!
+     * \brief Read a table which was written by writeBinary().
+     */
+    static PiecewiseUniformTabulated2DFunction readBinary(std::istream& is);
+
+    /*!
+     * \brief Read a table from a file which was written by writeBinary().
+     */
+    static PiecewiseUniformTabulated2DFunction readBinaryFile(const std::string& fileName);
+
+    bool operator==(const PiecewiseUniformTabulated2DFunction<Scalar>& data) const
+    {
+        return xAxis_ == data.xAxis_ &&
+               yAxis_ == data.yAxis_ &&
+               samples_ == data.samples_;
+    }
+
+private:
+    Axis xAxis_;
+    Axis yAxis_;
+
+    // the values of the sample points f(x_i, y_j), stored with x varying fastest
+    std::vector<Scalar> samples_;
+};
+
+} // namespace Opm
+
+#endif
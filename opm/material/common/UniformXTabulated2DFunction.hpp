@@ -33,8 +33,10 @@
 #include <opm/material/common/Valgrind.hpp>
 #include <opm/material/common/MathToolbox.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <iosfwd>
 #include <tuple>
 #include <type_traits>
@@ -72,18 +74,32 @@ public:
     };
 
     explicit UniformXTabulated2DFunction(const InterpolationPolicy interpolationGuide = Vertical)
-        : interpolationGuide_(interpolationGuide)
+        : rowStart_(1, 0)
+        , interpolationGuide_(interpolationGuide)
     { }
 
     UniformXTabulated2DFunction(const std::vector<Scalar>& xPos,
                                 const std::vector<Scalar>& yPos,
                                 const std::vector<std::vector<SamplePoint>>& samples,
                                 InterpolationPolicy interpolationGuide)
-        : samples_(samples)
+        : rowStart_(1, 0)
         , xPos_(xPos)
         , yPos_(yPos)
         , interpolationGuide_(interpolationGuide)
-    { }
+    {
+        for (const auto& row : samples) {
+            for (const auto& point : row) {
+                ySamples_.push_back(std::get<1>(point));
+                valueSamples_.push_back(std::get<2>(point));
+            }
+            rowStart_.push_back(ySamples_.size());
+        }
+
+        rowInvDy_.resize(samples.size());
+        for (std::size_t i = 0; i < samples.size(); ++i) {
+            updateUniformSpacing_(i);
+        }
+    }
 
     /*!
      * \brief Returns the minimum of the X coordinate of the sampling points.
@@ -107,13 +123,13 @@ public:
      * \brief Returns the value of the Y coordinate of a sampling point.
      */
     Scalar yAt(size_t i, size_t j) const
-    { return std::get<1>(samples_[i][j]); }
+    { return ySamples_[rowStart_[i] + j]; }
 
     /*!
      * \brief Returns the value of a sampling point.
      */
     Scalar valueAt(size_t i, size_t j) const
-    { return std::get<2>(samples_[i][j]); }
+    { return valueSamples_[rowStart_[i] + j]; }
 
     /*!
      * \brief Returns the number of sampling points in X direction.
@@ -125,19 +141,19 @@ public:
      * \brief Returns the minimum of the Y coordinate of the sampling points for a given column.
      */
     Scalar yMin(unsigned i) const
-    { return std::get<1>(samples_.at(i).front()); }
+    { return ySamples_.at(rowStart_.at(i)); }
 
     /*!
      * \brief Returns the maximum of the Y coordinate of the sampling points for a given column.
      */
     Scalar yMax(unsigned i) const
-    { return std::get<1>(samples_.at(i).back()); }
+    { return ySamples_.at(rowStart_.at(i + 1) - 1); }
 
     /*!
      * \brief Returns the number of sampling points in Y direction a given column.
      */
     size_t numY(unsigned i) const
-    { return samples_.at(i).size(); }
+    { return rowStart_.at(i + 1) - rowStart_.at(i); }
 
     /*!
      * \brief Return the position on the x-axis of the i-th interval.
@@ -149,9 +165,23 @@ public:
         return xPos_.at(i);
     }
 
-    const std::vector<std::vector<SamplePoint>>& samples() const
+    /*!
+     * \brief Assembles the sampling points as one vector per vertical line.
+     *
+     * The samples are stored contiguously, so this allocates and fills a new
+     * nested copy on each call.  Use xAt(), yAt() and valueAt() for lookups.
+     */
+    std::vector<std::vector<SamplePoint>> toSamplePoints() const
     {
-        return samples_;
+        std::vector<std::vector<SamplePoint>> result(numX());
+        for (std::size_t i = 0; i < numX(); ++i) {
+            result[i].reserve(numY(i));
+            for (std::size_t j = 0; j < numY(i); ++j) {
+                result[i].emplace_back(xPos_[i], yAt(i, j), valueAt(i, j));
+            }
+        }
+
+        return result;
     }
 
     const std::vector<Scalar>& xPos() const
@@ -175,9 +205,9 @@ public:
     Scalar jToY(unsigned i, unsigned j) const
     {
         assert(i < numX());
-        assert(size_t(j) < samples_[i].size());
+        assert(size_t(j) < numY(i));
 
-        return std::get<1>(samples_.at(i).at(j));
+        return yAt(i, j);
     }
 
     /*!
@@ -236,24 +266,44 @@ public:
                            [[maybe_unused]] bool extrapolate = false) const
     {
         assert(xSampleIdx < numX());
-        const auto& colSamplePoints = samples_.at(xSampleIdx);
+        const Scalar* colY = ySamples_.data() + rowStart_[xSampleIdx];
+        const unsigned n = numY(xSampleIdx);
 
-        assert(colSamplePoints.size() >= 2);
+        assert(n >= 2);
         assert(extrapolate || (yMin(xSampleIdx) <= y && y <= yMax(xSampleIdx)));
 
-        if (y <= std::get<1>(colSamplePoints[1]))
+        if (y <= colY[1])
             return 0;
-        else if (y >= std::get<1>(colSamplePoints[colSamplePoints.size() - 2]))
-            return colSamplePoints.size() - 2;
+        else if (y >= colY[n - 2])
+            return n - 2;
         else {
-            assert(colSamplePoints.size() >= 3);
+            assert(n >= 3);
+
+            const Scalar invDy = rowInvDy_[xSampleIdx];
+            if (invDy > 0.0) {
+                // uniformly spaced line: guess the segment directly and correct for
+                // rounding so that the result is identical to the bisection below
+                const Scalar pos = (decay<Scalar>(y) - colY[0])*invDy;
+                unsigned idx = 1;
+                if (pos >= n - 3)
+                    idx = n - 3;
+                else if (pos > 1)
+                    idx = static_cast<unsigned>(pos);
+
+                while (idx > 1 && y < colY[idx])
+                    --idx;
+                while (idx < n - 3 && !(y < colY[idx + 1]))
+                    ++idx;
+
+                return idx;
+            }
 
             // bisection
             unsigned lowerIdx = 1;
-            unsigned upperIdx = colSamplePoints.size() - 2;
+            unsigned upperIdx = n - 2;
             while (lowerIdx + 1 < upperIdx) {
                 unsigned pivotIdx = (lowerIdx + upperIdx) / 2;
-                if (y < std::get<1>(colSamplePoints[pivotIdx]))
+                if (y < colY[pivotIdx])
                     upperIdx = pivotIdx;
                 else
                     lowerIdx = pivotIdx;
@@ -275,10 +325,8 @@ public:
         assert(xSampleIdx < numX());
         assert(ySegmentIdx < numY(xSampleIdx) - 1);
 
-        const auto& colSamplePoints = samples_.at(xSampleIdx);
-
-        Scalar y1 = std::get<1>(colSamplePoints[ySegmentIdx]);
-        Scalar y2 = std::get<1>(colSamplePoints[ySegmentIdx + 1]);
+        Scalar y1 = yAt(xSampleIdx, ySegmentIdx);
+        Scalar y2 = yAt(xSampleIdx, ySegmentIdx + 1);
 
         return (y - y1)/(y2 - y1);
     }
@@ -295,16 +343,13 @@ public:
         unsigned i = xSegmentIndex(x, /*extrapolate=*/false);
         Scalar alpha = xToAlpha(decay<Scalar>(x), i);
 
-        const auto& col1SamplePoints = samples_.at(i);
-        const auto& col2SamplePoints = samples_.at(i + 1);
-
         Scalar minY =
-                alpha*std::get<1>(col1SamplePoints.front()) +
-                (1 - alpha)*std::get<1>(col2SamplePoints.front());
+                alpha*yMin(i) +
+                (1 - alpha)*yMin(i + 1);
 
         Scalar maxY =
-                alpha*std::get<1>(col1SamplePoints.back()) +
-                (1 - alpha)*std::get<1>(col2SamplePoints.back());
+                alpha*yMax(i) +
+                (1 - alpha)*yMax(i + 1);
 
         return minY <= y && y <= maxY;
     }
@@ -323,6 +368,38 @@ public:
         return eval(i, j1, j2, alpha, beta1, beta2);
     }
 
+    /*!
+     * \brief Evaluate the function at a sequence of (x,y) positions.
+     *
+     * This gives the same values as calling eval(x[k], y[k], extrapolate) for
+     * each k.  The x interval of the previous point is tried first, so runs of
+     * equal or sorted x values skip the bisection in xSegmentIndex().
+     */
+    template <class Evaluation>
+    void eval(const std::vector<Evaluation>& x,
+              const std::vector<Evaluation>& y,
+              std::vector<Evaluation>& result,
+              bool extrapolate = false) const
+    {
+        assert(x.size() == y.size());
+
+        result.resize(x.size());
+
+        unsigned i = 0;
+        Evaluation alpha, beta1, beta2;
+        unsigned j1, j2;
+        for (std::size_t k = 0; k < x.size(); ++k) {
+            checkApplies_(x[k], y[k], extrapolate);
+
+            if ((k == 0) || !inXSegment_(x[k], i)) {
+                i = xSegmentIndex(x[k], extrapolate);
+            }
+
+            findYPoints_(i, j1, j2, alpha, beta1, beta2, x[k], y[k], extrapolate);
+            result[k] = eval(i, j1, j2, alpha, beta1, beta2);
+        }
+    }
+
     template <class Evaluation>
     void findPoints(unsigned& i,
                     unsigned& j1,
@@ -334,61 +411,12 @@ public:
                     const Evaluation& y,
                     bool extrapolate) const
     {
-#ifndef NDEBUG
-        if (!extrapolate && !applies(x, y)) {
-            if constexpr (std::is_floating_point_v<Evaluation>) {
-                throw NumericalProblem("Attempt to get undefined table value (" +
-                                       std::to_string(x) + ", " +
-                                       std::to_string(y) + ")");
-            } else {
-                throw NumericalProblem("Attempt to get undefined table value (" +
-                                       std::to_string(x.value()) + ", " +
-                                       std::to_string(y.value()) + ")");
-            }
-        };
-#endif
+        checkApplies_(x, y, extrapolate);
 
         // bi-linear interpolation: first, calculate the x and y indices in the lookup
         // table ...
         i = xSegmentIndex(x, extrapolate);
-        alpha = xToAlpha(x, i);
-        // The 'shift' is used to shift the points used to interpolate within
-        // the (i) and (i+1) sets of sample points, so that when approaching
-        // the boundary of the domain given by the samples, one gets the same
-        // value as one would get by interpolating along the boundary curve
-        // itself.
-        Evaluation shift = 0.0;
-        if (interpolationGuide_ == InterpolationPolicy::Vertical) {
-            // Shift is zero, no need to reset it.
-        } else {
-            // find upper and lower y value
-            if (interpolationGuide_ == InterpolationPolicy::LeftExtreme) {
-                // The domain is above the boundary curve, up to y = infinity.
-                // The shift is therefore the same for all values of y.
-                shift = yPos_[i+1] - yPos_[i];
-            } else {
-                assert(interpolationGuide_ == InterpolationPolicy::RightExtreme);
-                // The domain is below the boundary curve, down to y = 0.
-                // The shift is therefore no longer the the same for all
-                // values of y, since at y = 0 the shift must be zero.
-                // The shift is computed by linear interpolation between
-                // the maximal value at the domain boundary curve, and zero.
-                shift = yPos_[i+1] - yPos_[i];
-                auto yEnd = yPos_[i]*(1.0 - alpha) + yPos_[i+1]*alpha;
-                if (yEnd > 0.) {
-                    shift = shift * y / yEnd;
-                } else {
-                    shift = 0.;
-                }
-            }
-        }
-        auto yLower =  y - alpha*shift;
-        auto yUpper =  y + (1-alpha)*shift;
-
-        j1 = ySegmentIndex(yLower, i, extrapolate);
-        j2 = ySegmentIndex(yUpper, i + 1, extrapolate);
-        beta1 = yToBeta(yLower, i, j1);
-        beta2 = yToBeta(yUpper, i + 1, j2);
+        findYPoints_(i, j1, j2, alpha, beta1, beta2, x, y, extrapolate);
     }
 
     template <class Evaluation>
@@ -418,14 +446,16 @@ public:
         if (xPos_.empty() || xPos_.back() < nextX) {
             xPos_.push_back(nextX);
             yPos_.push_back(-1e100);
-            samples_.push_back({});
+            rowStart_.push_back(rowStart_.back());
+            rowInvDy_.push_back(0.0);
             return xPos_.size() - 1;
         }
         else if (xPos_.front() > nextX) {
             // this is slow, but so what?
             xPos_.insert(xPos_.begin(), nextX);
             yPos_.insert(yPos_.begin(), -1e100);
-            samples_.insert(samples_.begin(), std::vector<SamplePoint>());
+            rowStart_.insert(rowStart_.begin(), 0);
+            rowInvDy_.insert(rowInvDy_.begin(), 0.0);
             return 0;
         }
         throw std::invalid_argument("Sampling points should be specified either monotonically "
@@ -440,17 +470,16 @@ public:
     size_t appendSamplePoint(size_t i, Scalar y, Scalar value)
     {
         assert(i < numX());
-        Scalar x = iToX(i);
-        if (samples_[i].empty() || std::get<1>(samples_[i].back()) < y) {
-            samples_[i].push_back(SamplePoint(x, y, value));
+        if (numY(i) == 0 || yMax(i) < y) {
+            insertSample_(i, rowStart_[i + 1], y, value);
             if (interpolationGuide_ == InterpolationPolicy::RightExtreme) {
                 yPos_[i] = y;
             }
-            return samples_[i].size() - 1;
+            return numY(i) - 1;
         }
-        else if (std::get<1>(samples_[i].front()) > y) {
+        else if (yMin(i) > y) {
             // slow, but we still don't care...
-            samples_[i].insert(samples_[i].begin(), SamplePoint(x, y, value));
+            insertSample_(i, rowStart_[i], y, value);
             if (interpolationGuide_ == InterpolationPolicy::LeftExtreme) {
                 yPos_[i] = y;
             }
@@ -472,15 +501,143 @@ public:
     bool operator==(const UniformXTabulated2DFunction<Scalar>& data) const {
         return this->xPos() == data.xPos() &&
                this->yPos() == data.yPos() &&
-               this->samples() == data.samples() &&
+               this->rowStart_ == data.rowStart_ &&
+               this->ySamples_ == data.ySamples_ &&
+               this->valueSamples_ == data.valueSamples_ &&
                this->interpolationGuide() == data.interpolationGuide();
     }
 
 private:
-    // the vector which contains the values of the sample points
-    // f(x_i, y_j). don't use this directly, use getSamplePoint(i,j)
-    // instead!
-    std::vector<std::vector<SamplePoint> > samples_;
+    template <class Evaluation>
+    void checkApplies_([[maybe_unused]] const Evaluation& x,
+                       [[maybe_unused]] const Evaluation& y,
+                       [[maybe_unused]] bool extrapolate) const
+    {
+#ifndef NDEBUG
+        if (!extrapolate && !applies(x, y)) {
+            if constexpr (std::is_floating_point_v<Evaluation>) {
+                throw NumericalProblem("Attempt to get undefined table value (" +
+                                       std::to_string(x) + ", " +
+                                       std::to_string(y) + ")");
+            } else {
+                throw NumericalProblem("Attempt to get undefined table value (" +
+                                       std::to_string(x.value()) + ", " +
+                                       std::to_string(y.value()) + ")");
+            }
+        };
+#endif
+    }
+
+    // Whether xSegmentIndex(x) would return i.
+    template <class Evaluation>
+    bool inXSegment_(const Evaluation& x, unsigned i) const
+    {
+        const auto n = xPos_.size();
+        if (x <= xPos_[1])
+            return i == 0;
+        else if (x >= xPos_[n - 2])
+            return i == n - 2;
+        else
+            return xPos_[i] <= x && x < xPos_[i + 1];
+    }
+
+    // Find the y intervals and weights of (x,y) on lines i and i + 1, where i
+    // is the x interval of x.
+    template <class Evaluation>
+    void findYPoints_(unsigned i,
+                      unsigned& j1,
+                      unsigned& j2,
+                      Evaluation& alpha,
+                      Evaluation& beta1,
+                      Evaluation& beta2,
+                      const Evaluation& x,
+                      const Evaluation& y,
+                      bool extrapolate) const
+    {
+        alpha = xToAlpha(x, i);
+        // The 'shift' is used to shift the points used to interpolate within
+        // the (i) and (i+1) sets of sample points, so that when approaching
+        // the boundary of the domain given by the samples, one gets the same
+        // value as one would get by interpolating along the boundary curve
+        // itself.
+        Evaluation shift = 0.0;
+        if (interpolationGuide_ == InterpolationPolicy::Vertical) {
+            // Shift is zero, no need to reset it.
+        } else {
+            // find upper and lower y value
+            if (interpolationGuide_ == InterpolationPolicy::LeftExtreme) {
+                // The domain is above the boundary curve, up to y = infinity.
+                // The shift is therefore the same for all values of y.
+                shift = yPos_[i+1] - yPos_[i];
+            } else {
+                assert(interpolationGuide_ == InterpolationPolicy::RightExtreme);
+                // The domain is below the boundary curve, down to y = 0.
+                // The shift is therefore no longer the the same for all
+                // values of y, since at y = 0 the shift must be zero.
+                // The shift is computed by linear interpolation between
+                // the maximal value at the domain boundary curve, and zero.
+                shift = yPos_[i+1] - yPos_[i];
+                auto yEnd = yPos_[i]*(1.0 - alpha) + yPos_[i+1]*alpha;
+                if (yEnd > 0.) {
+                    shift = shift * y / yEnd;
+                } else {
+                    shift = 0.;
+                }
+            }
+        }
+        auto yLower =  y - alpha*shift;
+        auto yUpper =  y + (1-alpha)*shift;
+
+        j1 = ySegmentIndex(yLower, i, extrapolate);
+        j2 = ySegmentIndex(yUpper, i + 1, extrapolate);
+        beta1 = yToBeta(yLower, i, j1);
+        beta2 = yToBeta(yUpper, i + 1, j2);
+    }
+
+    void insertSample_(std::size_t i, std::size_t pos, Scalar y, Scalar value)
+    {
+        ySamples_.insert(ySamples_.begin() + pos, y);
+        valueSamples_.insert(valueSamples_.begin() + pos, value);
+        for (std::size_t k = i + 1; k < rowStart_.size(); ++k) {
+            ++rowStart_[k];
+        }
+
+        updateUniformSpacing_(i);
+    }
+
+    // Record the inverse spacing of line i if its y positions are equidistant,
+    // which allows ySegmentIndex() to skip the bisection.
+    void updateUniformSpacing_(std::size_t i)
+    {
+        rowInvDy_[i] = 0.0;
+
+        const std::size_t n = numY(i);
+        if (n < 4) {
+            return;
+        }
+
+        const Scalar* colY = ySamples_.data() + rowStart_[i];
+        const Scalar dy = (colY[n - 1] - colY[0]) / (n - 1);
+        if (!(dy > 0.0)) {
+            return;
+        }
+
+        for (std::size_t j = 1; j < n; ++j) {
+            if (std::abs(colY[j] - colY[j - 1] - dy) > 1e-3*dy) {
+                return;
+            }
+        }
+
+        rowInvDy_[i] = 1.0/dy;
+    }
+
+    // the y positions and values of the sample points f(x_i, y_j) of all vertical
+    // lines, where line i occupies the index range [rowStart_[i], rowStart_[i + 1])
+    std::vector<Scalar> ySamples_;
+    std::vector<Scalar> valueSamples_;
+    std::vector<std::size_t> rowStart_;
+    // the inverse y spacing of each vertical line, or zero if it is not uniform
+    std::vector<Scalar> rowInvDy_;
 
     // the position of each vertical line on the x-axis
     std::vector<Scalar> xPos_;
@@ -39,6 +39,12 @@ const UniformTabulated2DFunction<double>&
 CO2<double>::tabulatedDensity = CO2Tables::tabulatedDensity;
 template<>
 const double CO2<double>::brineSalinity = CO2Tables::brineSalinity;
+template<>
+std::unique_ptr<const PiecewiseUniformTabulated2DFunction<double>>
+CO2<double>::loadedEnthalpy_{};
+template<>
+std::unique_ptr<const PiecewiseUniformTabulated2DFunction<double>>
+CO2<double>::loadedDensity_{};
 
 template<>
 const UniformTabulated2DFunction<double>&
@@ -48,6 +54,12 @@ const UniformTabulated2DFunction<double>&
 CO2<float>::tabulatedDensity = CO2Tables::tabulatedDensity;
 template<>
 const float CO2<float>::brineSalinity = CO2Tables::brineSalinity;
+template<>
+std::unique_ptr<const PiecewiseUniformTabulated2DFunction<double>>
+CO2<float>::loadedEnthalpy_{};
+template<>
+std::unique_ptr<const PiecewiseUniformTabulated2DFunction<double>>
+CO2<float>::loadedDensity_{};
 
 #if HAVE_QUAD
 template<>
@@ -58,6 +70,12 @@ const UniformTabulated2DFunction<double>&
 CO2<quad>::tabulatedDensity = CO2Tables::tabulatedDensity;
 template<>
 const quad CO2<quad>::brineSalinity = CO2Tables::brineSalinity;
+template<>
+std::unique_ptr<const PiecewiseUniformTabulated2DFunction<double>>
+CO2<quad>::loadedEnthalpy_{};
+template<>
+std::unique_ptr<const PiecewiseUniformTabulated2DFunction<double>>
+CO2<quad>::loadedDensity_{};
 #endif
 
 } // namespace Opm
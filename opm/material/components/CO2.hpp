@@ -32,9 +32,12 @@
 #include <opm/material/IdealGas.hpp>
 #include <opm/material/components/Component.hpp>
 #include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/PiecewiseUniformTabulated2DFunction.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 
 #include <cmath>
+#include <memory>
+#include <string>
 #include <string_view>
 
 namespace Opm {
@@ -56,9 +59,42 @@ class CO2 : public Component<Scalar, CO2<Scalar>>
     static const UniformTabulated2DFunction<double>& tabulatedEnthalpy;
     static const UniformTabulated2DFunction<double>& tabulatedDensity;
 
+    // tables loaded from files, which replace the built-in tables if set
+    static std::unique_ptr<const PiecewiseUniformTabulated2DFunction<double>> loadedEnthalpy_;
+    static std::unique_ptr<const PiecewiseUniformTabulated2DFunction<double>> loadedDensity_;
+
 public:
     static const Scalar brineSalinity;
 
+    /*!
+     * \brief Replace the built-in enthalpy and density tables by tables read from
+     *        binary files.
+     *
+     * The files must have been written by PiecewiseUniformTabulated2DFunction::writeBinary()
+     * and are sampled over temperature [K] and pressure [Pa]. This is not thread safe
+     * and must be called before any property of CO2 is evaluated.
+     */
+    static void loadTables(const std::string& enthalpyFileName,
+                           const std::string& densityFileName)
+    {
+        auto enthalpy = std::make_unique<const PiecewiseUniformTabulated2DFunction<double>>(
+            PiecewiseUniformTabulated2DFunction<double>::readBinaryFile(enthalpyFileName));
+        auto density = std::make_unique<const PiecewiseUniformTabulated2DFunction<double>>(
+            PiecewiseUniformTabulated2DFunction<double>::readBinaryFile(densityFileName));
+
+        loadedEnthalpy_ = std::move(enthalpy);
+        loadedDensity_ = std::move(density);
+    }
+
+    /*!
+     * \brief Go back to the built-in enthalpy and density tables.
+     */
+    static void resetTables()
+    {
+        loadedEnthalpy_.reset();
+        loadedDensity_.reset();
+    }
+
     /*!
      * \brief A human readable name for the CO2.
      */
@@ -170,6 +206,9 @@ public:
                                   const Evaluation& pressure,
                                   bool extrapolate = false)
     {
+        if (loadedEnthalpy_)
+            return loadedEnthalpy_->eval(temperature, pressure, extrapolate);
+
         return tabulatedEnthalpy.eval(temperature, pressure, extrapolate);
     }
 
@@ -195,6 +234,9 @@ public:
                                  const Evaluation& pressure,
                                  bool extrapolate = false)
     {
+        if (loadedDensity_)
+            return loadedDensity_->eval(temperature, pressure, extrapolate);
+
         return tabulatedDensity.eval(temperature, pressure, extrapolate);
     }
 
@@ -38,6 +38,12 @@ const UniformTabulated2DFunction<double>&
 H2<double>::tabulatedDensity = H2Tables::tabulatedDensity;
 template<>
 const double H2<double>::brineSalinity = H2Tables::brineSalinity;
+template<>
+std::unique_ptr<const PiecewiseUniformTabulated2DFunction<double>>
+H2<double>::loadedEnthalpy_{};
+template<>
+std::unique_ptr<const PiecewiseUniformTabulated2DFunction<double>>
+H2<double>::loadedDensity_{};
 
 template<>
 const UniformTabulated2DFunction<double>&
@@ -47,6 +53,12 @@ const UniformTabulated2DFunction<double>&
 H2<float>::tabulatedDensity = H2Tables::tabulatedDensity;
 template<>
 const float H2<float>::brineSalinity = H2Tables::brineSalinity;
+template<>
+std::unique_ptr<const PiecewiseUniformTabulated2DFunction<double>>
+H2<float>::loadedEnthalpy_{};
+template<>
+std::unique_ptr<const PiecewiseUniformTabulated2DFunction<double>>
+H2<float>::loadedDensity_{};
 
 #if HAVE_QUAD
 template<>
@@ -57,6 +69,12 @@ const UniformTabulated2DFunction<double>&
 H2<quad>::tabulatedDensity = H2Tables::tabulatedDensity;
 template<>
 const quad H2<quad>::brineSalinity = H2Tables::brineSalinity;
+template<>
+std::unique_ptr<const PiecewiseUniformTabulated2DFunction<double>>
+H2<quad>::loadedEnthalpy_{};
+template<>
+std::unique_ptr<const PiecewiseUniformTabulated2DFunction<double>>
+H2<quad>::loadedDensity_{};
 #endif
 
 } // namespace Opm
@@ -580,6 +580,8 @@ public:
     bool update(Scalar pcSw, Scalar krwSw, Scalar krnSw)
     {
         bool updateParams = false;
+        bool krnSwMdcChanged = false;
+        bool krwSwMdcChanged = false;
 
         if (config().pcHysteresisModel() == 0 && pcSw < pcSwMdc_) {
             if (pcSwMdc_ == 2.0 && pcSw+1.0e-6 < Swcrd_ && oilWaterSystem_) {
@@ -597,12 +599,14 @@ public:
         if (krnSw < krnSwMdc_) {
             krnSwMdc_ = krnSw;
             KrndHy_ = EffLawT::twoPhaseSatKrn(drainageParams(), krnSwMdc_);
+            krnSwMdcChanged = true;
             updateParams = true;
         }
 
         if (krwSw > krwSwMdc_) {
             krwSwMdc_ = krwSw;
             KrwdHy_ = EffLawT::twoPhaseSatKrw(drainageParams(), krwSwMdc_);
+            krwSwMdcChanged = true;
             updateParams = true;
         }
 
@@ -656,8 +660,17 @@ public:
 
         }
 
+        // Only recompute the dynamic parameters which depend on a moved
+        // reversal point.  The capillary pressure reversal points alone
+        // enter none of them.
+        if (krnSwMdcChanged)
+            updateKrnDynamicParams_();
+
+        if (krwSwMdcChanged)
+            updateKrwDynamicParams_();
+
         if (updateParams)
-            updateDynamicParams_();
+            updateWagDynamicParams_();
 
         return updateParams;
     }
@@ -694,6 +707,14 @@ public:
 
 private:
     void updateDynamicParams_()
+    {
+        updateKrnDynamicParams_();
+        updateKrwDynamicParams_();
+        updateWagDynamicParams_();
+    }
+
+    // Parameters which depend on krnSwMdc_
+    void updateKrnDynamicParams_()
     {
         // calculate the saturation deltas for the relative permeabilities
         //if (false) { // we dont support Carlson for wetting phase hysteresis
@@ -722,7 +743,11 @@ private:
                 Sncrt_ = Sncrd_;
             }
         }
+    }
 
+    // Parameters which depend on krwSwMdc_
+    void updateKrwDynamicParams_()
+    {
         if (config().krHysteresisModel() == 4) {
             Scalar Swhy = krwSwMdc_;
             if (Swhy >= Swcrd_) {
@@ -732,8 +757,11 @@ private:
                 Swcrt_ = Swcrd_;
             }
         }
+    }
 
-
+    // Parameters of the WAG hysteresis process
+    void updateWagDynamicParams_()
+    {
         if (gasOilHysteresisWAG()) {
             if (isDrain_ && krnSwMdc_ == krnSwWAG_) {
                 Scalar Snhy = 1.0 - krnSwMdc_;
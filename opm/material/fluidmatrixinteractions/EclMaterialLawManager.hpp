@@ -42,6 +42,8 @@
 #include <opm/material/fluidmatrixinteractions/DirectionalMaterialLawParams.hpp>
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <tuple>
@@ -380,17 +382,61 @@ public:
         OPM_TIMEFUNCTION_LOCAL();
         if (!enableHysteresis())
             return false;
-        bool changed = MaterialLaw::updateHysteresis(materialLawParams(elemIdx), fluidState);
-        if (hasDirectionalRelperms() || hasDirectionalImbnum()) {
-            using Dir = FaceDir::DirEnum;
-            constexpr int ndim = 3;
-            Dir facedirs[ndim] = {Dir::XPlus, Dir::YPlus, Dir::ZPlus};
-            for (int i = 0; i<ndim; i++) {
-                bool ischanged =  MaterialLaw::updateHysteresis(materialLawParams(elemIdx, facedirs[i]), fluidState);
-                changed = changed || ischanged;
-            }
+        return updateHysteresis_(fluidState, elemIdx, hasDirectionalRelperms() || hasDirectionalImbnum());
+    }
+
+    /*!
+     * \brief Update the hysteresis state of all elements in the range
+     *        [beginElemIdx, endElemIdx).
+     *
+     * \param fluidState Callable such that fluidState(elemIdx) returns the
+     *        fluid state of element elemIdx.  Must be safe to call
+     *        concurrently for distinct elements.
+     *
+     * \param changed If not null, (*changed)[elemIdx] is set to whether or
+     *        not the hysteresis state of element elemIdx changed.  The vector
+     *        is grown to at least endElemIdx entries first; entries outside
+     *        of the range are left unchanged.  The vector is not touched if
+     *        hysteresis is disabled.
+     *
+     * The elements' states are independent, so large ranges are updated in
+     * parallel.
+     *
+     * \return Number of elements whose hysteresis state changed.
+     */
+    template <class FluidStateFunction>
+    std::size_t updateHysteresis(unsigned beginElemIdx,
+                                 unsigned endElemIdx,
+                                 const FluidStateFunction& fluidState,
+                                 std::vector<unsigned char>* changed = nullptr)
+    {
+        OPM_TIMEFUNCTION_LOCAL();
+        if (!enableHysteresis() || (beginElemIdx >= endElemIdx))
+            return 0;
+
+        // Resize outside of the parallel region.
+        if ((changed != nullptr) && (changed->size() < endElemIdx))
+            changed->resize(endElemIdx);
+
+        const bool directional = hasDirectionalRelperms() || hasDirectionalImbnum();
+        const auto begin = static_cast<std::int64_t>(beginElemIdx);
+        const auto end = static_cast<std::int64_t>(endElemIdx);
+
+        std::size_t numChanged = 0;
+
+#pragma omp parallel for schedule(static) reduction(+:numChanged) if (end - begin >= minParallelHysteresisUpdate_)
+        for (std::int64_t elemIdx = begin; elemIdx < end; ++elemIdx) {
+            const bool elemChanged =
+                updateHysteresis_(fluidState(static_cast<unsigned>(elemIdx)),
+                                  static_cast<unsigned>(elemIdx), directional);
+
+            if (changed != nullptr)
+                (*changed)[elemIdx] = elemChanged;
+
+            numChanged += elemChanged;
         }
-        return changed;
+
+        return numChanged;
     }
 
     void oilWaterHysteresisParams(Scalar& soMax,
@@ -433,6 +479,25 @@ public:
 private:
     const MaterialLawParams& materialLawParamsFunc_(unsigned elemIdx, FaceDir::DirEnum facedir) const;
 
+    // Element ranges smaller than this are updated by a single thread.
+    static constexpr std::int64_t minParallelHysteresisUpdate_ = 4096;
+
+    template <class FluidState>
+    bool updateHysteresis_(const FluidState& fluidState, unsigned elemIdx, bool directional)
+    {
+        bool changed = MaterialLaw::updateHysteresis(materialLawParams(elemIdx), fluidState);
+        if (directional) {
+            using Dir = FaceDir::DirEnum;
+            constexpr int ndim = 3;
+            Dir facedirs[ndim] = {Dir::XPlus, Dir::YPlus, Dir::ZPlus};
+            for (int i = 0; i<ndim; i++) {
+                bool ischanged =  MaterialLaw::updateHysteresis(materialLawParams(elemIdx, facedirs[i]), fluidState);
+                changed = changed || ischanged;
+            }
+        }
+        return changed;
+    }
+
     void readGlobalEpsOptions_(const EclipseState& eclState);
 
     void readGlobalHysteresisOptions_(const EclipseState& state);
@@ -30,15 +30,65 @@
 #include <opm/common/utility/CSRGraphFromCoordinates.hpp>
 
 #include <algorithm>
-#include <cassert>
+#include <cstdint>
 #include <exception>
 #include <iterator>
+#include <numeric>
 #include <optional>
 #include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
+namespace {
+
+    std::size_t maxNumThreads()
+    {
+#ifdef _OPENMP
+        return std::max(omp_get_max_threads(), 1);
+#else
+        return 1;
+#endif // _OPENMP
+    }
+
+    std::size_t threadIndex()
+    {
+#ifdef _OPENMP
+        return omp_get_thread_num();
+#else
+        return 0;
+#endif // _OPENMP
+    }
+
+} // Anonymous namespace
+
+// ---------------------------------------------------------------------
+// Class Opm::data::InterRegFlowMap::LocalConnections
+// ---------------------------------------------------------------------
+
+void Opm::data::InterRegFlowMap::LocalConnections::clear()
+{
+    this->rows.clear();
+    this->cols.clear();
+    this->rates.clear();
+    this->edgeRates.clear();
+}
+
+// =====================================================================
+
+// ---------------------------------------------------------------------
+// Class Opm::data::InterRegFlowMap
+// ---------------------------------------------------------------------
+
+Opm::data::InterRegFlowMap::InterRegFlowMap()
+{
+    this->allocateThreadBuffers();
+}
+
 void
 Opm::data::InterRegFlowMap::
 addConnection(const int        r1,
@@ -60,53 +110,78 @@ addConnection(const int        r1,
 
     const auto one   = Window::ElmT{1};
     const auto sign  = (r1 < r2) ? one : -one;
-    const auto start = this->rates_.size();
+    const auto sz    = Window::bufferSize();
 
     auto low = r1, high = r2;
     if (std::signbit(sign)) {
         std::swap(low, high);
     }
 
-    this->connections_.addConnection(low, high);
+    auto& local = this->localConnections();
+
+    if (this->incremental_) {
+        if (const auto edge = this->edgeIndex(low, high); edge.has_value()) {
+            // Known region pair.  Update flow rates only.
+            auto begin = local.edgeRates.begin() + (*edge)*sz;
+            Window { begin, begin + sz }.addFlow(sign, rates);
+            return;
+        }
+    }
+
+    const auto start = local.rates.size();
+
+    local.rows.push_back(low);
+    local.cols.push_back(high);
 
-    this->rates_.insert(this->rates_.end(), Window::bufferSize(), Window::ElmT{0});
-    Window { this->rates_.begin() + start, this->rates_.end() }.addFlow(sign, rates);
+    local.rates.insert(local.rates.end(), sz, Window::ElmT{0});
+    Window { local.rates.begin() + start, local.rates.end() }.addFlow(sign, rates);
 }
 
 void Opm::data::InterRegFlowMap::compress(const std::size_t numRegions)
 {
-    this->connections_.compress(numRegions);
+    if (this->incremental_) {
+        this->incremental_ = false;
+        this->accumulateEdgeRates();
+
+        const auto newConnections =
+            std::any_of(this->localConns_.begin(), this->localConns_.end(),
+                        [](const LocalConnections& local)
+                        { return ! local.rows.empty(); });
+
+        const auto sameStructure = ! newConnections
+            && (numRegions == this->numRegions())
+            && (this->rates_.size() ==
+                this->connections_.columnIndices().size() * Window::bufferSize());
+
+        if (sameStructure) {
+            return;
+        }
+    }
 
-    const auto v = this->rates_;
-    constexpr auto sz = Window::bufferSize();
-    const auto& dstIx = this->connections_.compressedIndexMap();
+    this->flushLocalConnections();
 
-    if (v.size() != dstIx.size()*sz) {
-        throw std::logic_error {
-            "Flow rates must be provided for each connection"
-        };
-    }
+    this->connections_.compress(numRegions);
 
-    auto dst = [this](const Offset start) -> Window
-    {
-        auto begin = this->rates_.begin() + start*sz;
+    this->accumulateCompressedRates();
 
-        return Window { begin, begin + sz };
-    };
+    this->allocateThreadBuffers();
+}
 
-    auto src = [&v](const Offset start) -> ReadOnlyWindow
-    {
-        auto begin = v.begin() + start*sz;
+void Opm::data::InterRegFlowMap::resetRates()
+{
+    this->allocateThreadBuffers();
 
-        return ReadOnlyWindow { begin, begin + sz };
-    };
+    const auto numRates =
+        this->connections_.columnIndices().size() * Window::bufferSize();
 
-    this->rates_.assign(this->connections_.columnIndices().size() * sz, Window::ElmT{0});
+    this->rates_.assign(numRates, Window::ElmT{0});
 
-    const auto numRates = dstIx.size();
-    for (auto rateID = 0*numRates; rateID < numRates; ++rateID) {
-        dst(dstIx[rateID]) += src(rateID);
+    for (auto& local : this->localConns_) {
+        local.clear();
+        local.edgeRates.assign(numRates, Window::ElmT{0});
     }
+
+    this->incremental_ = true;
 }
 
 Opm::data::InterRegFlowMap::Offset
@@ -148,27 +223,161 @@ Opm::data::InterRegFlowMap::getInterRegFlows(const int r1, const int r2) const
         std::swap(low, high);
     }
 
+    const auto windowID = this->edgeIndex(low, high);
+    if (! windowID.has_value()) {
+        // High is not connected to low.
+        return std::nullopt;
+    }
+
+    const auto sz = ReadOnlyWindow::bufferSize();
+
+    auto rateStart = this->rates_.begin() + (*windowID)*sz;
+
+    return { std::pair { ReadOnlyWindow { rateStart, rateStart + sz }, sign } };
+}
+
+void Opm::data::InterRegFlowMap::clear()
+{
+    this->connections_.clear();
+    this->rates_.clear();
+
+    for (auto& local : this->localConns_) {
+        local.clear();
+    }
+
+    this->allocateThreadBuffers();
+
+    this->incremental_ = false;
+}
+
+Opm::data::InterRegFlowMap::LocalConnections&
+Opm::data::InterRegFlowMap::localConnections()
+{
+    // Buffers for all threads are allocated outside of parallel regions,
+    // see allocateThreadBuffers(), since they cannot be added safely
+    // while other threads use them.
+    const auto thread = threadIndex();
+    if (thread >= this->localConns_.size()) {
+        throw std::logic_error {
+            "Number of threads exceeds number of connection buffers"
+        };
+    }
+
+    return this->localConns_[thread];
+}
+
+void Opm::data::InterRegFlowMap::allocateThreadBuffers()
+{
+    if (this->localConns_.size() < maxNumThreads()) {
+        this->localConns_.resize(maxNumThreads());
+    }
+}
+
+std::optional<Opm::data::InterRegFlowMap::Offset>
+Opm::data::InterRegFlowMap::edgeIndex(const int low, const int high) const
+{
     const auto& ia = this->connections_.startPointers();
     const auto& ja = this->connections_.columnIndices();
 
+    if (static_cast<Offset>(low) + 1 >= ia.size()) {
+        return std::nullopt;
+    }
+
     auto begin = ja.begin() + ia[low + 0];
     auto end   = ja.begin() + ia[low + 1];
     auto pos   = std::lower_bound(begin, end, high);
     if ((pos == end) || (*pos > high)) {
-        // High is not connected to low.
         return std::nullopt;
     }
 
-    const auto sz = ReadOnlyWindow::bufferSize();
-    const auto windowID = pos - ja.begin();
+    return static_cast<Offset>(std::distance(ja.begin(), pos));
+}
+
+void Opm::data::InterRegFlowMap::accumulateEdgeRates()
+{
+    const auto numRates = static_cast<std::int64_t>
+        (this->connections_.columnIndices().size() * Window::bufferSize());
+
+#pragma omp parallel for schedule(static)
+    for (std::int64_t i = 0; i < numRates; ++i) {
+        for (const auto& local : this->localConns_) {
+            if (! local.edgeRates.empty()) {
+                this->rates_[i] += local.edgeRates[i];
+            }
+        }
+    }
+}
 
-    auto rateStart = this->rates_.begin() + windowID*sz;
+void Opm::data::InterRegFlowMap::flushLocalConnections()
+{
+    auto start = Start { this->rates_.size() };
+    for (const auto& local : this->localConns_) {
+        start.push_back(start.back() + local.rates.size());
+    }
 
-    return { std::pair { ReadOnlyWindow { rateStart, rateStart + sz }, sign } };
+    this->rates_.resize(start.back(), Window::ElmT{0});
+
+    const auto numBuffers = static_cast<std::int64_t>(this->localConns_.size());
+
+#pragma omp parallel for schedule(dynamic)
+    for (std::int64_t buffer = 0; buffer < numBuffers; ++buffer) {
+        const auto& rates = this->localConns_[buffer].rates;
+
+        std::copy(rates.begin(), rates.end(), this->rates_.begin() + start[buffer]);
+    }
+
+    // Connections must enter the graph in the same order as their rates
+    // enter the rate buffer.
+    for (auto& local : this->localConns_) {
+        this->connections_.addConnections(local.rows, local.cols);
+
+        local.clear();
+    }
 }
 
-void Opm::data::InterRegFlowMap::clear()
+void Opm::data::InterRegFlowMap::accumulateCompressedRates()
 {
-    this->connections_.clear();
-    this->rates_.clear();
+    const auto v = this->rates_;
+    constexpr auto sz = Window::bufferSize();
+    const auto& dstIx = this->connections_.compressedIndexMap();
+
+    if (v.size() != dstIx.size()*sz) {
+        throw std::logic_error {
+            "Flow rates must be provided for each connection"
+        };
+    }
+
+    const auto numEdges = this->connections_.columnIndices().size();
+
+    // Group contributions by destination edge, in input order, so that
+    // each edge may be accumulated independently.
+    auto srcStart = Start(numEdges + 1, 0);
+    for (const auto& edge : dstIx) {
+        srcStart[edge + 1] += 1;
+    }
+
+    std::partial_sum(srcStart.begin(), srcStart.end(), srcStart.begin());
+
+    auto srcIx = Start(dstIx.size());
+    {
+        auto insertPos = srcStart;
+
+        const auto numRates = dstIx.size();
+        for (auto rateID = 0*numRates; rateID < numRates; ++rateID) {
+            srcIx[insertPos[dstIx[rateID]]++] = rateID;
+        }
+    }
+
+    this->rates_.assign(numEdges * sz, Window::ElmT{0});
+
+#pragma omp parallel for schedule(static)
+    for (std::int64_t edge = 0; edge < static_cast<std::int64_t>(numEdges); ++edge) {
+        auto dst = this->rates_.begin() + edge*sz;
+        auto window = Window { dst, dst + sz };
+
+        for (auto i = srcStart[edge]; i < srcStart[edge + 1]; ++i) {
+            auto src = v.begin() + srcIx[i]*sz;
+            window += ReadOnlyWindow { src, src + sz };
+        }
+    }
 }
@@ -72,6 +72,12 @@ namespace Opm { namespace data {
         /// single inter-region connection.
         using Component = Window::Component;
 
+        /// Default constructor.
+        ///
+        /// Prepares one connection accumulation buffer for each thread
+        /// available to parallel regions.
+        InterRegFlowMap();
+
         /// Add flow rate connection between regions.
         ///
         /// \param[in] r1 Primary (source) zero-based region index.  Used as
@@ -83,6 +89,21 @@ namespace Opm { namespace data {
         /// \param[in] rates Flow rates associated to single connection.
         ///
         /// If both region IDs are the same then this function does nothing.
+        ///
+        /// May be called concurrently from within an OpenMP parallel
+        /// region.  Each thread accumulates connections into its own local
+        /// buffer and these buffers are merged in compress().  Buffers are
+        /// allocated for omp_get_max_threads() threads at construction and
+        /// in clear(), compress() and resetRates(), so the parallel region
+        /// must not use more threads than that.  In particular, the number
+        /// of OpenMP threads must not grow between a call to resetRates()
+        /// or clear() and the next call to compress().  A thread without a
+        /// buffer makes this function throw \code std::logic_error
+        /// \endcode.
+        ///
+        /// Following a call to resetRates(), connections between region
+        /// pairs which are already known to the compressed structure only
+        /// update the flow rate values.
         void addConnection(const int r1, const int r2, const FlowRates& rates);
 
         /// Form CSR adjacency matrix representation of input graph from
@@ -93,8 +114,21 @@ namespace Opm { namespace data {
         ///     (row indices) greater than or equal to \p numRows, then
         ///     method compress() will throw \code std::invalid_argument
         ///     \endcode.
+        ///
+        /// In incremental mode, i.e., following a call to resetRates(),
+        /// this function only sums the thread local flow rates into the
+        /// existing structure unless new region pairs or a different
+        /// number of regions have been supplied.
         void compress(const std::size_t numRegions);
 
+        /// Enter incremental mode.
+        ///
+        /// Zeros all accumulated flow rates, but preserves the compressed
+        /// region connectivity from the previous call to compress().  Use
+        /// this in place of clear() when the region topology does not
+        /// change between report steps.
+        void resetRates();
+
         /// Retrieve number of rows (source entities) in input graph.
         /// Corresponds to value of argument passed to compress().  Valid
         /// only after calling compress().
@@ -141,9 +175,60 @@ namespace Opm { namespace data {
         // VertexID = int, TrackCompressedIdx = true.
         using Graph = utility::CSRGraphFromCoordinates<int, true>;
 
+        /// Connections accumulated by a single thread.
+        struct LocalConnections
+        {
+            /// Row (low) region indices of new connections.
+            Neighbours rows{};
+
+            /// Column (high) region indices of new connections.
+            Neighbours cols{};
+
+            /// Flow rates of new connections.  Window::bufferSize()
+            /// elements per connection.
+            RateBuffer rates{};
+
+            /// Flow rates of known region pairs in incremental mode.
+            /// Indexed as the compressed rate buffer.
+            RateBuffer edgeRates{};
+
+            /// Clear all buffers.  Preserve allocated capacity.
+            void clear();
+        };
+
         Graph connections_{};
         RateBuffer rates_{};
 
+        /// Per-thread connection buffers.
+        std::vector<LocalConnections> localConns_{};
+
+        /// Whether or not resetRates() has been called since the last
+        /// structural change.
+        bool incremental_{false};
+
+        /// Thread local connection buffer for calling thread.
+        LocalConnections& localConnections();
+
+        /// Ensure that there is a connection buffer for each of
+        /// omp_get_max_threads() threads.  Must not be called from within a
+        /// parallel region.
+        void allocateThreadBuffers();
+
+        /// Compressed edge index of region pair.
+        ///
+        /// \return Edge index of (low,high) pair.  \code std::nullopt
+        ///    \endcode if no such pair exists in the compressed structure.
+        std::optional<Offset> edgeIndex(const int low, const int high) const;
+
+        /// Sum thread local incremental mode flow rates into rates_.
+        void accumulateEdgeRates();
+
+        /// Move thread local connections into connections_ and rates_.
+        void flushLocalConnections();
+
+        /// Sum uncompressed flow rates into compressed structure.
+        void accumulateCompressedRates();
+
         template <typename T, class A, class MessageBufferType>
         void writeVector(const std::vector<T,A>& vec,
                          MessageBufferType&      buffer) const
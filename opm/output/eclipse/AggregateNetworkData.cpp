@@ -331,9 +331,11 @@ nodeProps nodeRateDensity(const Opm::EclipseState&                  es,
     std::string node_nm = nodeName;
     bool is_wel_grp = false;
     // loop over downtree branches
-    if ((network.has_node(node_nm)) && (network.downtree_branches(node_nm).size() > 0)) {
-        for (const auto& br : network.downtree_branches(nodeName)) {
-            node_nm = br.downtree_node();
+    const auto topology = network.topology();
+    const auto node = topology->nodeId(node_nm);
+    if (node.has_value() && !topology->downtreeBranches(*node).empty()) {
+        for (const auto& br : topology->downtreeBranches(*node)) {
+            node_nm = topology->nodeName(topology->downtreeNode(br));
             // check if node is group
             if (sched.hasGroup(node_nm, lookup_step)) {
                 // check if group is a well group
@@ -409,9 +411,10 @@ allocate(const std::vector<int>& inteHead)
 int numberOfBranchesConnToNode(const Opm::Schedule& sched, const std::string& nodeName, const size_t lookup_step)
 {
     auto& network = sched[lookup_step].network();
-    if (network.has_node(nodeName)) {
-        int noBranches = network.downtree_branches(nodeName).size();
-        noBranches = (network.uptree_branch(nodeName).has_value()) ? noBranches+1 : noBranches;
+    const auto topology = network.topology();
+    if (const auto node = topology->nodeId(nodeName); node.has_value()) {
+        int noBranches = topology->downtreeBranches(*node).size();
+        noBranches = (! topology->uptreeBranches(*node).empty()) ? noBranches+1 : noBranches;
         return noBranches;
     } else {
         auto msg = fmt::format("Trying to find number of branches connected to undefined node: {} at report time: {} ", nodeName, lookup_step+1);
@@ -612,10 +612,20 @@ namespace {
             for (std::size_t ind = 0; ind < nwmaxz; ind++) {
                 dUdw[ind] = Opm::UDQ::restart_default;
             }
+
+            const auto var = udq_state.well_var_handle(udq);
+            if (! var.has_value()) {
+                return;
+            }
+
             for (std::size_t ind = 0; ind < wells.size(); ind++) {
-                const auto& wname = wells[ind].name();
-                if (udq_state.has_well_var(wname, udq)) {
-                    dUdw[ind] = udq_state.get_well_var(wname, udq);
+                const auto well = udq_state.well_handle(wells[ind].name());
+                if (! well.has_value()) {
+                    continue;
+                }
+
+                if (const auto value = udq_state.well_value(*var, *well); value.has_value()) {
+                    dUdw[ind] = *value;
                 }
             }
         }
@@ -641,18 +651,22 @@ namespace {
                            const std::size_t ngmaxz,
                            DUDGArray&   dUdg)
         {
+            const auto var = udq_state.group_var_handle(udq);
+
             //initialize array to the default value for the array
             for (std::size_t ind = 0; ind < groups.size(); ind++) {
-                if ((groups[ind] == nullptr) || (ind == ngmaxz-1)) {
-                    dUdg[ind] = Opm::UDQ::restart_default;
+                dUdg[ind] = Opm::UDQ::restart_default;
+                if ((groups[ind] == nullptr) || (ind == ngmaxz-1) || ! var.has_value()) {
+                    continue;
                 }
-                else {
-                    if (udq_state.has_group_var((*groups[ind]).name(), udq)) {
-                        dUdg[ind] = udq_state.get_group_var((*groups[ind]).name(), udq);
-                    }
-                    else {
-                        dUdg[ind] = Opm::UDQ::restart_default;
-                    }
+
+                const auto group = udq_state.group_handle(groups[ind]->name());
+                if (! group.has_value()) {
+                    continue;
+                }
+
+                if (const auto value = udq_state.group_value(*var, *group); value.has_value()) {
+                    dUdg[ind] = *value;
                 }
             }
         }
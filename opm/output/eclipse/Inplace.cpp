@@ -20,11 +20,12 @@
 #include <opm/output/eclipse/Inplace.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <iterator>
 #include <numeric>
 #include <stdexcept>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include <fmt/format.h>
@@ -34,25 +35,97 @@ namespace {
 static const std::string FIELD_NAME = std::string{"FIELD"};
 static const std::size_t FIELD_ID   = 0;
 
-std::size_t region_max(const std::unordered_map<std::size_t, double>& region_map)
+// Quantities which are not "pure" phases, in the order of mixingPhases().
+constexpr std::array mixingPhaseList {
+    Opm::Inplace::Phase::OilInLiquidPhase,
+    Opm::Inplace::Phase::OilInGasPhase,
+    Opm::Inplace::Phase::GasInLiquidPhase,
+    Opm::Inplace::Phase::GasInGasPhase,
+    Opm::Inplace::Phase::PoreVolume,
+    Opm::Inplace::Phase::WaterResVolume,
+    Opm::Inplace::Phase::OilResVolume,
+    Opm::Inplace::Phase::GasResVolume,
+    Opm::Inplace::Phase::SALT,
+    Opm::Inplace::Phase::CO2InWaterPhase,
+    Opm::Inplace::Phase::CO2InGasPhaseInMob,
+    Opm::Inplace::Phase::CO2InGasPhaseMob,
+    Opm::Inplace::Phase::CO2InGasPhaseInMobKrg,
+    Opm::Inplace::Phase::CO2InGasPhaseMobKrg,
+    Opm::Inplace::Phase::WaterInGasPhase,
+    Opm::Inplace::Phase::WaterInWaterPhase,
+    Opm::Inplace::Phase::CO2Mass,
+    Opm::Inplace::Phase::CO2MassInWaterPhase,
+    Opm::Inplace::Phase::CO2MassInGasPhase,
+    Opm::Inplace::Phase::CO2MassInGasPhaseInMob,
+    Opm::Inplace::Phase::CO2MassInGasPhaseMob,
+    Opm::Inplace::Phase::CO2MassInGasPhaseInMobKrg,
+    Opm::Inplace::Phase::CO2MassInGasPhaseMobKrg,
+    Opm::Inplace::Phase::CO2MassInGasPhaseEffectiveTrapped,
+    Opm::Inplace::Phase::CO2MassInGasPhaseEffectiveUnTrapped,
+    Opm::Inplace::Phase::CO2MassInGasPhaseMaximumTrapped,
+    Opm::Inplace::Phase::CO2MassInGasPhaseMaximumUnTrapped,
+};
+
+// Quantities which are omitted from both phases() and mixingPhases().
+constexpr std::array porevolumePhaseList {
+    Opm::Inplace::Phase::PressurePV,
+    Opm::Inplace::Phase::HydroCarbonPV,
+    Opm::Inplace::Phase::PressureHydroCarbonPV,
+    Opm::Inplace::Phase::DynamicPoreVolume,
+};
+
+template <typename PhaseValues>
+bool is_present(const PhaseValues& pv, const std::size_t region_id)
 {
-    return std::accumulate(region_map.begin(), region_map.end(), std::size_t{0},
-                           [](const std::size_t max, const auto& elm)
+    return (region_id < pv.present.size()) && (pv.present[region_id] != 0);
+}
+
+template <typename PhaseValues>
+bool is_empty(const PhaseValues& pv)
+{
+    return std::none_of(pv.present.begin(), pv.present.end(),
+                        [](const unsigned char p) { return p != 0; });
+}
+
+template <typename PhaseValues>
+std::size_t region_max(const PhaseValues& pv)
+{
+    // Region IDs are stored densely, so the largest registered ID is the
+    // last present entry.
+    const auto last = std::find_if(pv.present.rbegin(), pv.present.rend(),
+                                   [](const unsigned char p) { return p != 0; });
+
+    return (last == pv.present.rend())
+        ? std::size_t{0}
+        : static_cast<std::size_t>(std::distance(last, pv.present.rend())) - 1;
+}
+
+template <typename Phases>
+std::size_t phase_region_max(const Phases& phases)
+{
+    return std::accumulate(phases.begin(), phases.end(), std::size_t{0},
+                           [](const std::size_t max, const auto& pv)
                            {
-                               return std::max(max, elm.first);
+                               return std::max(max, region_max(pv));
                            });
 }
 
-std::size_t
-phase_region_max(const std::unordered_map<Opm::Inplace::Phase, std::unordered_map<std::size_t, double>>& phase_map)
+template <typename PhaseValues>
+bool equal_values(const PhaseValues& lhs, const PhaseValues& rhs)
 {
-    return std::accumulate(phase_map.begin(),
-                           phase_map.end(),
-                           std::size_t{0},
-        [](const std::size_t max, const auto& region_map)
-    {
-        return std::max(max, region_max(region_map.second));
-    });
+    const auto n = std::max(lhs.present.size(), rhs.present.size());
+    for (auto region_id = std::size_t{0}; region_id < n; ++region_id) {
+        const auto in_lhs = is_present(lhs, region_id);
+        if (in_lhs != is_present(rhs, region_id)) {
+            return false;
+        }
+
+        if (in_lhs && (lhs.values[region_id] != rhs.values[region_id])) {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 template <typename Vector>
@@ -79,7 +152,31 @@ void Inplace::add(const std::string&   region,
                   const std::size_t    region_id,
                   const double         value)
 {
-    this->phase_values[region][phase][region_id] = value;
+    auto& pv = this->region_set(region).phases[static_cast<std::size_t>(phase)];
+
+    if (region_id >= pv.values.size()) {
+        pv.values.resize(region_id + 1, 0.0);
+        pv.present.resize(region_id + 1, 0);
+    }
+
+    pv.values[region_id] = value;
+    pv.present[region_id] = 1;
+}
+
+void Inplace::add(const std::string&         region,
+                  const Inplace::Phase       phase,
+                  const std::vector<double>& values)
+{
+    auto& pv = this->region_set(region).phases[static_cast<std::size_t>(phase)];
+
+    // Region IDs are one-based.  Slot zero is reserved for the FIELD
+    // value and left untouched here.
+    const auto size = std::max(pv.values.size(), values.size() + 1);
+    pv.values.resize(size, 0.0);
+    pv.present.resize(size, 0);
+
+    std::copy(values.begin(), values.end(), pv.values.begin() + 1);
+    std::fill_n(pv.present.begin() + 1, values.size(), static_cast<unsigned char>(1));
 }
 
 void Inplace::add(Inplace::Phase phase, double value)
@@ -91,30 +188,29 @@ double Inplace::get(const std::string&   region,
                     const Inplace::Phase phase,
                     const std::size_t    region_id) const
 {
-    auto region_iter = this->phase_values.find(region);
-    if (region_iter == this->phase_values.end()) {
+    const auto* rset = this->find_region_set(region);
+    if (rset == nullptr) {
         throw std::logic_error {
             fmt::format("No such region: {}", region)
         };
     }
 
-    auto phase_iter = region_iter->second.find(phase);
-    if (phase_iter == region_iter->second.end()) {
+    const auto& pv = rset->phases[static_cast<std::size_t>(phase)];
+    if (is_empty(pv)) {
         throw std::logic_error {
             fmt::format("No such phase: {}:{}",
                         region, static_cast<int>(phase))
         };
     }
 
-    auto value_iter = phase_iter->second.find(region_id);
-    if (value_iter == phase_iter->second.end()) {
+    if (! is_present(pv, region_id)) {
         throw std::logic_error {
             fmt::format("No such region id: {}:{}:{}",
                         region, static_cast<int>(phase), region_id)
         };
     }
 
-    return value_iter->second;
+    return pv.values[region_id];
 }
 
 double Inplace::get(Inplace::Phase phase) const
@@ -126,18 +222,10 @@ bool Inplace::has(const std::string& region,
                   const Phase        phase,
                   const std::size_t  region_id) const
 {
-    auto region_iter = this->phase_values.find(region);
-    if (region_iter == this->phase_values.end()) {
-        return false;
-    }
+    const auto* rset = this->find_region_set(region);
 
-    auto phase_iter = region_iter->second.find(phase);
-    if (phase_iter == region_iter->second.end()) {
-        return false;
-    }
-
-    return phase_iter->second.find(region_id)
-        != phase_iter->second.end();
+    return (rset != nullptr)
+        && is_present(rset->phases[static_cast<std::size_t>(phase)], region_id);
 }
 
 bool Inplace::has(Phase phase) const
@@ -147,57 +235,82 @@ bool Inplace::has(Phase phase) const
 
 std::size_t Inplace::max_region() const
 {
-    return std::accumulate(this->phase_values.begin(),
-                           this->phase_values.end(),
+    return std::accumulate(this->region_sets_.begin(),
+                           this->region_sets_.end(),
                            std::size_t{0},
-        [](const std::size_t max, const auto& phase_map)
+        [](const std::size_t max, const RegionSet& rset)
     {
-        return std::max(max, phase_region_max(phase_map.second));
+        return std::max(max, phase_region_max(rset.phases));
     });
 }
 
 std::size_t Inplace::max_region(const std::string& region_name) const
 {
-    auto region_iter = this->phase_values.find(region_name);
-    if (region_iter == this->phase_values.end()) {
+    const auto* rset = this->find_region_set(region_name);
+    if (rset == nullptr) {
         throw std::logic_error {
             fmt::format("No such region: {}", region_name)
         };
     }
 
-    return phase_region_max(region_iter->second);
+    return phase_region_max(rset->phases);
 }
 
 std::vector<double>
 Inplace::get_vector(const std::string& region,
                     const Phase        phase) const
 {
-    std::vector<double> v(this->max_region(region), 0.0);
+    std::vector<double> v;
+    this->get_vector(region, phase, v);
+
+    return v;
+}
 
-    auto region_iter = this->phase_values.find(region);
-    if (region_iter == this->phase_values.end()) {
+void Inplace::get_vector(const std::string&   region,
+                         const Phase          phase,
+                         std::vector<double>& values) const
+{
+    const auto* rset = this->find_region_set(region);
+    if (rset == nullptr) {
         throw std::logic_error {
             fmt::format("No such region: {}", region)
         };
     }
 
-    auto phase_iter = region_iter->second.find(phase);
-    if (phase_iter == region_iter->second.end()) {
+    const auto& pv = rset->phases[static_cast<std::size_t>(phase)];
+    if (is_empty(pv)) {
         throw std::logic_error {
             fmt::format("Phase {} does not exist in region {}",
                         static_cast<int>(phase), region)
         };
     }
 
-    for (const auto& [region_id, value] : phase_iter->second) {
-        v[region_id - 1] = value;
+    values.assign(phase_region_max(rset->phases), 0.0);
+
+    const auto n = std::min(values.size() + 1, pv.values.size());
+    for (auto region_id = std::size_t{1}; region_id < n; ++region_id) {
+        if (pv.present[region_id] != 0) {
+            values[region_id - 1] = pv.values[region_id];
+        }
     }
+}
 
-    return v;
+void Inplace::reset()
+{
+    for (auto& rset : this->region_sets_) {
+        for (auto& pv : rset.phases) {
+            std::fill(pv.present.begin(), pv.present.end(), static_cast<unsigned char>(0));
+        }
+    }
 }
 
 const std::vector<Inplace::Phase>& Inplace::phases()
 {
+    // Every quantity is either reported by phases() or one of the pore
+    // volumes, so the per-region arrays have room for all of them.
+    static_assert(3 + mixingPhaseList.size() + porevolumePhaseList.size() == NumPhases,
+                  "Inplace::NumPhases must match the number of Phase enumerators");
+
     static const auto phases_ = append(std::vector {
         Inplace::Phase::WATER,
         Inplace::Phase::OIL,
@@ -209,42 +322,64 @@ const std::vector<Inplace::Phase>& Inplace::phases()
 
 const std::vector<Inplace::Phase>& Inplace::mixingPhases()
 {
-    static const auto mixingPhases_ = std::vector {
-        Inplace::Phase::OilInLiquidPhase,
-        Inplace::Phase::OilInGasPhase,
-        Inplace::Phase::GasInLiquidPhase,
-        Inplace::Phase::GasInGasPhase,
-        Inplace::Phase::PoreVolume,
-        Inplace::Phase::WaterResVolume,
-        Inplace::Phase::OilResVolume,
-        Inplace::Phase::GasResVolume,
-        Inplace::Phase::SALT,
-        Inplace::Phase::CO2InWaterPhase,
-        Inplace::Phase::CO2InGasPhaseInMob,
-        Inplace::Phase::CO2InGasPhaseMob,
-        Inplace::Phase::CO2InGasPhaseInMobKrg,
-        Inplace::Phase::CO2InGasPhaseMobKrg,
-        Inplace::Phase::WaterInGasPhase,
-        Inplace::Phase::WaterInWaterPhase,
-        Inplace::Phase::CO2Mass,
-        Inplace::Phase::CO2MassInWaterPhase,
-        Inplace::Phase::CO2MassInGasPhase,
-        Inplace::Phase::CO2MassInGasPhaseInMob,
-        Inplace::Phase::CO2MassInGasPhaseMob,
-        Inplace::Phase::CO2MassInGasPhaseInMobKrg,
-        Inplace::Phase::CO2MassInGasPhaseMobKrg,
-        Inplace::Phase::CO2MassInGasPhaseEffectiveTrapped,
-        Inplace::Phase::CO2MassInGasPhaseEffectiveUnTrapped,
-        Inplace::Phase::CO2MassInGasPhaseMaximumTrapped,
-        Inplace::Phase::CO2MassInGasPhaseMaximumUnTrapped,
-    };
+    static const auto mixingPhases_ =
+        std::vector<Phase>(mixingPhaseList.begin(), mixingPhaseList.end());
 
     return mixingPhases_;
 }
 
 bool Inplace::operator==(const Inplace& rhs) const
 {
-    return this->phase_values == rhs.phase_values;
+    // Region sets without any values compare equal to missing region sets
+    // and unused capacity is ignored, so objects which have been reset()
+    // and refilled compare equal to freshly constructed ones.
+    const auto contained_in = [](const Inplace& lhs, const Inplace& other)
+    {
+        return std::all_of(lhs.region_sets_.begin(), lhs.region_sets_.end(),
+                           [&other](const RegionSet& rset)
+                           {
+                               const auto* orset = other.find_region_set(rset.name);
+                               if (orset == nullptr) {
+                                   return std::all_of(rset.phases.begin(), rset.phases.end(),
+                                                      [](const auto& pv) { return is_empty(pv); });
+                               }
+
+                               return std::equal(rset.phases.begin(), rset.phases.end(),
+                                                 orset->phases.begin(),
+                                                 [](const auto& pv1, const auto& pv2)
+                                                 { return equal_values(pv1, pv2); });
+                           });
+    };
+
+    return contained_in(*this, rhs) && contained_in(rhs, *this);
+}
+
+const Inplace::RegionSet*
+Inplace::find_region_set(const std::string& region) const
+{
+    // Number of region sets is small (FIELD, FIPNUM, and a few FIPxxx), so
+    // a linear search is cheaper than hashing the name.
+    auto pos = std::find_if(this->region_sets_.begin(), this->region_sets_.end(),
+                            [&region](const RegionSet& rset)
+                            { return rset.name == region; });
+
+    return (pos == this->region_sets_.end()) ? nullptr : &*pos;
+}
+
+Inplace::RegionSet& Inplace::region_set(const std::string& region)
+{
+    auto pos = std::find_if(this->region_sets_.begin(), this->region_sets_.end(),
+                            [&region](const RegionSet& rset)
+                            { return rset.name == region; });
+
+    if (pos != this->region_sets_.end()) {
+        return *pos;
+    }
+
+    auto& rset = this->region_sets_.emplace_back();
+    rset.name = region;
+
+    return rset;
 }
 
 } // namespace Opm
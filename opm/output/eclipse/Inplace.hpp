@@ -20,9 +20,9 @@
 #ifndef ORIGINAL_OIP
 #define ORIGINAL_OIP
 
+#include <array>
 #include <cstddef>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace Opm {
@@ -98,6 +98,19 @@ public:
              std::size_t        region_number,
              double             value);
 
+    /// Assign values of particular quantity in all regions of named
+    /// region set.
+    ///
+    /// \param[in] region Region set name such as FIPNUM or FIPABC.
+    ///
+    /// \param[in] phase In-place quantity.
+    ///
+    /// \param[in] values Numerical values of \p phase quantity, indexed
+    ///   by (region_number - 1) as for get_vector().
+    void add(const std::string&         region,
+             Phase                      phase,
+             const std::vector<double>& values);
+
     /// Assign field-level value of particular quantity.
     ///
     /// \param[in] phase In-place quantity.
@@ -186,6 +199,23 @@ public:
     std::vector<double>
     get_vector(const std::string& region, Phase phase) const;
 
+    /// Linearised per-region values for a given phase in a specific region
+    /// set, written into existing storage.
+    ///
+    /// \param[in] region Region set name, e.g., "FIPNUM" or "FIPABC".
+    ///
+    /// \param[in] Phase In-place quantity.
+    ///
+    /// \param[out] values Per-region values of requested quantity as for
+    ///   the value-returning overload.  Resized to max_region(region).
+    void get_vector(const std::string&   region,
+                    Phase                phase,
+                    std::vector<double>& values) const;
+
+    /// Remove all values, while keeping region sets and allocated storage
+    /// for reuse by subsequent calls to add().
+    void reset();
+
     /// Get iterable list of all quantities which can be handled/updated in
     /// a generic way.
     static const std::vector<Phase>& phases();
@@ -202,7 +232,7 @@ public:
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
-        serializer(phase_values);
+        serializer(region_sets_);
     }
 
     /// Equality predicate.
@@ -214,13 +244,47 @@ public:
     bool operator==(const Inplace& rhs) const;
 
 private:
-    using ValueMap = std::unordered_map<std::size_t, double>;
-    using PhaseMap = std::unordered_map<Phase, ValueMap>;
-    using RegionMap = std::unordered_map<std::string, PhaseMap>;
+    /// Number of Phase enumerators.  Must be updated when a new quantity is
+    /// added.  Checked against the lists behind phases() at compile time.
+    static constexpr auto NumPhases =
+        static_cast<std::size_t>(Phase::CO2MassInGasPhaseMaximumUnTrapped) + 1;
+
+    /// Numerical values of a single quantity in a region set, indexed by
+    /// region ID.
+    struct PhaseValues
+    {
+        std::vector<double> values{};
+        std::vector<unsigned char> present{};
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(values);
+            serializer(present);
+        }
+    };
+
+    /// Numerical values of all registered quantities in a single region
+    /// set, indexed by Phase.
+    struct RegionSet
+    {
+        std::string name{};
+        std::array<PhaseValues, NumPhases> phases{};
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(name);
+            serializer(phases);
+        }
+    };
 
     /// Numerical values of all registered quantities in all registered
     /// region sets.
-    RegionMap phase_values{};
+    std::vector<RegionSet> region_sets_{};
+
+    const RegionSet* find_region_set(const std::string& region) const;
+    RegionSet& region_set(const std::string& region);
 };
 
 } // namespace Opm
@@ -59,6 +59,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <initializer_list>
@@ -540,6 +541,9 @@ AquiferVectors::raqn(const std::size_t recordID) const
 // ---------------------------------------------------------------------
 
 namespace {
+    // Arrays smaller than this are converted to double by a single thread.
+    constexpr auto minParallelConversionSize = std::int64_t{1} << 16;
+
     void throwIfMissingRequired(const Opm::RestartKey& rst_key)
     {
         if (rst_key.required) {
@@ -572,15 +576,23 @@ namespace {
         else if (rst_view.hasKeyword<float>(key)) {
             // Data exists as type REAL.  Convert to double.
             const auto& data = rst_view.getKeyword<float>(key);
+            const auto  size = static_cast<std::int64_t>(data.size());
+
+            auto values = std::vector<double>(data.size());
+
+#pragma omp parallel for schedule(static) if (size >= minParallelConversionSize)
+            for (std::int64_t i = 0; i < size; ++i) {
+                values[i] = data[i];
+            }
 
-            return { data.begin(), data.end() };
+            return values;
         }
 
         // Data unavailable.  Return empty.
         return {};
     }
 
-    void insertSolutionVector(const std::vector<double>&           vector,
+    void insertSolutionVector(std::vector<double>&&                vector,
                               const Opm::RestartKey&               value,
                               const std::vector<double>::size_type numcells,
                               Opm::data::Solution&                 sol)
@@ -593,7 +605,7 @@ namespace {
             };
         }
 
-        sol.insert(value.key, value.dim, vector,
+        sol.insert(value.key, value.dim, std::move(vector),
                    Opm::data::TargetType::RESTART_SOLUTION);
     }
 
@@ -602,7 +614,7 @@ namespace {
                          const Opm::EclIO::RestartFileView&   rst_view,
                          Opm::data::Solution&                 sol)
     {
-        const auto& kwdata = double_vector(value.key, rst_view);
+        auto kwdata = double_vector(value.key, rst_view);
 
         if (kwdata.empty()) {
             throwIfMissingRequired(value);
@@ -613,7 +625,7 @@ namespace {
             return;
         }
 
-        insertSolutionVector(kwdata, value, numcells, sol);
+        insertSolutionVector(std::move(kwdata), value, numcells, sol);
     }
 
     std::vector<double>
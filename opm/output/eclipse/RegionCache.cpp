@@ -28,14 +28,65 @@
 #include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellMatcher.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <map>
-#include <memory>
+#include <iterator>
+#include <numeric>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
+namespace {
+
+    // Merge new (region ID, entry) pairs into a compressed sparse row
+    // structure.  Existing entries of a region precede the new ones.  The
+    // region ID range of the result is [newFirst, newFirst + numRegions),
+    // and must include the range of the existing structure.
+    template <typename T>
+    void mergeEntries(std::vector<std::size_t>&        start,
+                      std::vector<T>&                  entries,
+                      const int                        oldFirst,
+                      const int                        newFirst,
+                      const std::size_t                numRegions,
+                      std::vector<std::pair<int, T>>&& added)
+    {
+        const auto oldNumRegions = start.size() - 1;
+        const auto shift = static_cast<std::size_t>(oldFirst - newFirst);
+
+        auto newStart = std::vector<std::size_t>(numRegions + 1, 0);
+
+        for (auto r = 0*oldNumRegions; r < oldNumRegions; ++r) {
+            newStart[r + shift + 1] = start[r + 1] - start[r];
+        }
+
+        for (const auto& entry : added) {
+            ++newStart[entry.first - newFirst + 1];
+        }
+
+        std::partial_sum(newStart.begin(), newStart.end(), newStart.begin());
+
+        auto merged = std::vector<T>(newStart.back());
+        auto next = newStart;
+
+        for (auto r = 0*oldNumRegions; r < oldNumRegions; ++r) {
+            for (auto i = start[r]; i < start[r + 1]; ++i) {
+                merged[next[r + shift]++] = std::move(entries[i]);
+            }
+        }
+
+        for (auto& entry : added) {
+            merged[next[entry.first - newFirst]++] = std::move(entry.second);
+        }
+
+        start.swap(newStart);
+        entries.swap(merged);
+    }
+
+} // Anonymous namespace
+
 Opm::out::RegionCache::RegionCache(const std::set<std::string>& fip_regions,
                                    const FieldPropsManager&     fp,
                                    const EclipseGrid&           grid,
@@ -49,67 +100,173 @@ void Opm::out::RegionCache::buildCache(const std::set<std::string>& fip_regions,
                                        const EclipseGrid&           grid,
                                        const Schedule&              schedule)
 {
+    this->region_sets.clear();
+    this->well_names.clear();
+    this->well_index.clear();
+    this->known_connections.clear();
+
     if (fip_regions.empty()) {
         return;
     }
 
-    auto regions = std::vector<std::reference_wrapper<const std::vector<int>>>{};
     for (const auto& fipReg : fip_regions) {
-        regions.push_back(std::cref(fp.get_int(fipReg)));
+        this->region_sets.emplace_back().name = fipReg;
     }
 
-    for (const auto& wname : schedule.back().well_order()) {
-        const auto& conns = schedule.back().wells(wname).getConnections();
+    this->addConnections(fp, grid, schedule, schedule.size() - 1);
+}
+
+void Opm::out::RegionCache::updateCache(const FieldPropsManager& fp,
+                                        const EclipseGrid&       grid,
+                                        const Schedule&          schedule,
+                                        const std::size_t        report_step)
+{
+    this->addConnections(fp, grid, schedule, report_step);
+}
+
+void Opm::out::RegionCache::addConnections(const FieldPropsManager& fp,
+                                           const EclipseGrid&       grid,
+                                           const Schedule&          schedule,
+                                           const std::size_t        report_step)
+{
+    if (this->region_sets.empty()) {
+        return;
+    }
+
+    const auto numSets = this->region_sets.size();
+
+    auto regions = std::vector<std::reference_wrapper<const std::vector<int>>>{};
+    for (const auto& regSet : this->region_sets) {
+        regions.push_back(std::cref(fp.get_int(regSet.name)));
+    }
+
+    auto newConns = std::vector<std::vector<std::pair<int, WellConn>>>(numSets);
+    auto newWells = std::vector<std::vector<std::pair<int, std::size_t>>>(numSets);
+
+    const auto& state = schedule[report_step];
+    for (const auto& wname : state.well_order()) {
+        const auto& conns = state.wells(wname).getConnections();
         if (conns.empty()) { continue; }
 
-        auto regID = regions.begin();
-        for (const auto& fipReg : fip_regions) {
-            auto first = true;
+        // A well is registered, and assigned to the regions of, its first
+        // active connection.
+        auto wellIx = this->well_index.find(wname);
 
-            for (const auto& conn : conns) {
-                if (! grid.cellActive(conn.global_index())) {
-                    continue;
-                }
+        for (const auto& conn : conns) {
+            if (! grid.cellActive(conn.global_index())) {
+                continue;
+            }
 
-                const auto region = regID->get()[grid.activeIndex(conn.global_index())];
-                const auto reg_pair = std::make_pair(fipReg, region);
+            const auto isNewWell = wellIx == this->well_index.end();
+            if (isNewWell) {
+                wellIx = this->well_index.emplace(wname, this->well_names.size()).first;
+                this->well_names.push_back(wname);
+            }
+
+            const auto key = (static_cast<std::uint64_t>(wellIx->second) << 32)
+                | static_cast<std::uint64_t>(conn.global_index());
+
+            if (! this->known_connections.insert(key).second) {
+                continue;
+            }
 
-                this->connection_map[reg_pair]
-                    .emplace_back(wname, conn.global_index());
+            const auto activeIx = grid.activeIndex(conn.global_index());
+            for (auto set = 0*numSets; set < numSets; ++set) {
+                const auto region = regions[set].get()[activeIx];
 
-                if (first) {
-                    this->well_map[reg_pair].push_back(wname);
+                newConns[set].emplace_back(region, WellConn { wname, conn.global_index() });
 
-                    first = false;
+                if (isNewWell) {
+                    newWells[set].emplace_back(region, wellIx->second);
                 }
             }
+        }
+    }
 
-            ++regID;
+    for (auto set = 0*numSets; set < numSets; ++set) {
+        if (newConns[set].empty()) {
+            continue;
         }
+
+        auto& regSet = this->region_sets[set];
+
+        const auto oldNumRegions = regSet.connStart.size() - 1;
+        const auto [minReg, maxReg] = std::minmax_element(newConns[set].begin(), newConns[set].end());
+
+        const auto first = (oldNumRegions == 0)
+            ? minReg->first
+            : std::min(minReg->first, regSet.firstRegion);
+
+        const auto last = (oldNumRegions == 0)
+            ? maxReg->first
+            : std::max(maxReg->first, regSet.firstRegion + static_cast<int>(oldNumRegions) - 1);
+
+        const auto numRegions = static_cast<std::size_t>(last - first + 1);
+
+        // Wells are assigned to the region of an active connection, so
+        // their region IDs are always inside the connection range.
+        const auto oldFirst = (oldNumRegions == 0) ? first : regSet.firstRegion;
+
+        mergeEntries(regSet.connStart, regSet.conns, oldFirst, first, numRegions, std::move(newConns[set]));
+        mergeEntries(regSet.wellStart, regSet.wells, oldFirst, first, numRegions, std::move(newWells[set]));
+
+        regSet.firstRegion = first;
     }
 }
 
+const Opm::out::RegionCache::RegionSet*
+Opm::out::RegionCache::regionSet(const std::string& region_name) const
+{
+    // Typically very few region sets, so a linear search is cheaper than
+    // a map lookup.
+    auto pos = std::find_if(this->region_sets.begin(), this->region_sets.end(),
+                            [&region_name](const RegionSet& regSet)
+                            { return regSet.name == region_name; });
+
+    return (pos == this->region_sets.end()) ? nullptr : &*pos;
+}
 
-const std::vector<std::pair<std::string, std::size_t>>&
+Opm::out::RegionCache::ConnectionRange
 Opm::out::RegionCache::connections(const std::string& region_name,
                                    const int          region_id) const
 {
-    const auto key = std::make_pair(region_name, region_id);
-    auto iter = this->connection_map.find(key);
+    static const auto connections_empty = std::vector<WellConn>{};
+
+    const auto* regSet = this->regionSet(region_name);
+    if ((regSet == nullptr) || (region_id < regSet->firstRegion)) {
+        return { connections_empty.begin(), connections_empty.end() };
+    }
 
-    return (iter == this->connection_map.end())
-        ? this->connections_empty
-        : iter->second;
+    const auto r = static_cast<std::size_t>(region_id - regSet->firstRegion);
+    if (r + 1 >= regSet->connStart.size()) {
+        return { connections_empty.begin(), connections_empty.end() };
+    }
+
+    return { regSet->conns.begin() + regSet->connStart[r],
+             regSet->conns.begin() + regSet->connStart[r + 1] };
 }
 
 std::vector<std::string>
 Opm::out::RegionCache::wells(const std::string& region_name,
                              const int          region_id) const
 {
-    const auto key = std::make_pair(region_name, region_id);
-    auto iter = this->well_map.find(key);
+    auto result = std::vector<std::string>{};
+
+    const auto* regSet = this->regionSet(region_name);
+    if ((regSet == nullptr) || (region_id < regSet->firstRegion)) {
+        return result;
+    }
+
+    const auto r = static_cast<std::size_t>(region_id - regSet->firstRegion);
+    if (r + 1 >= regSet->wellStart.size()) {
+        return result;
+    }
+
+    std::transform(regSet->wells.begin() + regSet->wellStart[r],
+                   regSet->wells.begin() + regSet->wellStart[r + 1],
+                   std::back_inserter(result),
+                   [this](const std::size_t wellIx)
+                   { return this->well_names[wellIx]; });
 
-    return (iter == this->well_map.end())
-        ? std::vector<std::string> {}
-        : iter->second;
+    return result;
 }
@@ -21,9 +21,12 @@
 #define OPM_REGION_CACHE_HPP
 
 #include <cstddef>
-#include <map>
+#include <cstdint>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -35,6 +38,32 @@ namespace Opm {
 namespace Opm { namespace out {
     class RegionCache {
     public:
+        using WellConn = std::pair<std::string, std::size_t>; // { Well name, cell ID }
+
+        // Connections of a single region.  Refers to storage inside the
+        // RegionCache and is invalidated by buildCache() and updateCache().
+        class ConnectionRange {
+        public:
+            using const_iterator = std::vector<WellConn>::const_iterator;
+
+            ConnectionRange(const_iterator begin, const_iterator end)
+                : begin_(begin), end_(end)
+            {}
+
+            const_iterator begin() const { return this->begin_; }
+            const_iterator end() const { return this->end_; }
+
+            std::size_t size() const { return this->end_ - this->begin_; }
+            bool empty() const { return this->begin_ == this->end_; }
+
+            const WellConn& front() const { return *this->begin_; }
+            const WellConn& operator[](const std::size_t i) const { return this->begin_[i]; }
+
+        private:
+            const_iterator begin_;
+            const_iterator end_;
+        };
+
         RegionCache() = default;
         RegionCache(const std::set<std::string>& fip_regions,
                     const FieldPropsManager&     fp,
@@ -46,19 +75,49 @@ namespace Opm { namespace out {
                         const EclipseGrid&           grid,
                         const Schedule&              schedule);
 
-        const std::vector<std::pair<std::string, std::size_t>>&
-        connections(const std::string& region_name, int region_id) const;
+        // Add connections of the wells at report_step which are not yet in
+        // the cache, e.g., because they were introduced by ACTIONX after
+        // the cache was built.  Cheap if there are no new connections.
+        void updateCache(const FieldPropsManager& fp,
+                         const EclipseGrid&       grid,
+                         const Schedule&          schedule,
+                         std::size_t              report_step);
+
+        ConnectionRange connections(const std::string& region_name, int region_id) const;
 
         // A well is assigned to the region_id of its first connection.
         std::vector<std::string> wells(const std::string& region_name, int region_id) const;
 
     private:
-        using RegID = std::pair<std::string, int>;            // { Region set, region ID }
-        using WellConn = std::pair<std::string, std::size_t>; // { Well name, cell ID }
+        // Connections and wells of one region set in compressed sparse
+        // row format.  The connections of region ID 'r' are
+        // conns[connStart[r - firstRegion] .. connStart[r - firstRegion + 1]),
+        // and likewise for wells.
+        struct RegionSet {
+            std::string name{};
+            int firstRegion{0};
+
+            std::vector<std::size_t> connStart{0};
+            std::vector<WellConn> conns{};
+
+            std::vector<std::size_t> wellStart{0};
+            std::vector<std::size_t> wells{}; // Indices into well_names
+        };
+
+        std::vector<RegionSet> region_sets{};
+
+        std::vector<std::string> well_names{};
+        std::unordered_map<std::string, std::size_t> well_index{};
+
+        // Known { well index, cell ID } pairs, packed into a single integer.
+        std::unordered_set<std::uint64_t> known_connections{};
+
+        const RegionSet* regionSet(const std::string& region_name) const;
 
-        std::vector<WellConn> connections_empty{};
-        std::map<RegID, std::vector<WellConn>> connection_map{};
-        std::map<RegID, std::vector<std::string>> well_map{};
+        void addConnections(const FieldPropsManager& fp,
+                            const EclipseGrid&       grid,
+                            const Schedule&          schedule,
+                            std::size_t              report_step);
     };
 }} // namespace Opm::out
 
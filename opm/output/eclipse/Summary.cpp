@@ -81,6 +81,7 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <regex>
 #include <stdexcept>
 #include <string>
@@ -3186,36 +3187,149 @@ namespace Evaluator {
                             Opm::SummaryState&      st) const = 0;
     };
 
-    class FunctionRelation : public Base
+    /// Summary vector values computed by a single evaluation task, but
+    /// not yet applied to the SummaryState object.
+    ///
+    /// Enables evaluating independent summary vectors concurrently.  Each
+    /// task collects its values in a separate staging buffer and the
+    /// buffers are committed to the SummaryState in a fixed order once
+    /// all tasks have completed.
+    class StagingBuffer
     {
     public:
-        explicit FunctionRelation(Opm::EclIO::SummaryNode node, ofun fcn)
-            : node_(std::move(node))
-            , fcn_ (std::move(fcn))
+        void clear()
         {
-            if (this->use_number()) {
-                this->number_ = std::max(0, this->node_.number);
+            this->values_.clear();
+        }
+
+        void add(const Opm::EclIO::SummaryNode& node, const double value)
+        {
+            this->values_.emplace_back(&node, value);
+        }
+
+        void commit(Opm::SummaryState& st) const
+        {
+            for (const auto& [node, value] : this->values_) {
+                updateValue(*node, value, st);
             }
         }
 
+    private:
+        std::vector<std::pair<const Opm::EclIO::SummaryNode*, double>> values_{};
+    };
+
+    /// Evaluator of a single summary node whose value is computed without
+    /// modifying the SummaryState.  Such evaluators may run concurrently
+    /// with each other.
+    class NodeValue : public Base
+    {
+    public:
+        explicit NodeValue(Opm::EclIO::SummaryNode node)
+            : node_(std::move(node))
+        {}
+
         void update(const std::size_t       sim_step,
                     const double            stepSize,
                     const InputData&        input,
                     const SimulatorResults& simRes,
                     Opm::SummaryState&      st) const override
         {
-            const auto wells = need_wells(this->node_)
-                ? find_wells(input.sched, this->node_,
+            const auto val = this->value(sim_step, stepSize, input, simRes, st);
+            if (val.has_value()) {
+                updateValue(this->node_, *val, st);
+            }
+        }
+
+        void stage(const std::size_t        sim_step,
+                   const double             stepSize,
+                   const InputData&         input,
+                   const SimulatorResults&  simRes,
+                   const Opm::SummaryState& st,
+                   StagingBuffer&           buffer) const
+        {
+            const auto val = this->value(sim_step, stepSize, input, simRes, st);
+            if (val.has_value()) {
+                buffer.add(this->node_, *val);
+            }
+        }
+
+        /// Whether or not this evaluator may be run concurrently with
+        /// other evaluators.  False for those evaluators which read
+        /// summary vectors computed in the same evaluation pass.
+        virtual bool isConcurrent() const
+        {
+            return true;
+        }
+
+        /// Whether or not evaluating this node aggregates contributions
+        /// from many wells or cells.  Such nodes are scheduled as separate
+        /// evaluation tasks.
+        bool isAggregate() const
+        {
+            using Cat = ::Opm::EclIO::SummaryNode::Category;
+            const auto cat = this->node_.category;
+
+            return (cat == Cat::Field) || (cat == Cat::Group) || (cat == Cat::Region);
+        }
+
+    protected:
+        const Opm::EclIO::SummaryNode& node() const
+        {
+            return this->node_;
+        }
+
+        /// Compute summary node's value, in output units.  Nullopt if
+        /// the value is not available from the simulator results.
+        virtual std::optional<double>
+        value(const std::size_t        sim_step,
+              const double             stepSize,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& st) const = 0;
+
+    private:
+        Opm::EclIO::SummaryNode node_;
+    };
+
+    class FunctionRelation : public NodeValue
+    {
+    public:
+        explicit FunctionRelation(Opm::EclIO::SummaryNode node, ofun fcn)
+            : NodeValue(std::move(node))
+            , fcn_     (std::move(fcn))
+        {
+            if (this->use_number()) {
+                this->number_ = std::max(0, this->node().number);
+            }
+        }
+
+        bool isConcurrent() const override
+        {
+            // ROEW is computed from the COPT values of the same
+            // evaluation pass.  See comment on function roew().
+            return this->node().keyword.rfind("ROEW", 0) != 0;
+        }
+
+    protected:
+        std::optional<double>
+        value(const std::size_t        sim_step,
+              const double             stepSize,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& st) const override
+        {
+            const auto wells = need_wells(this->node())
+                ? find_wells(input.sched, this->node(),
                              static_cast<int>(sim_step), input.reg)
                 : std::vector<const Opm::Well*>{};
 
             EfficiencyFactor efac{};
-            efac.setFactors(this->node_, input.sched, wells, sim_step);
+            efac.setFactors(this->node(), input.sched, wells, sim_step);
 
             const fn_args args {
-                wells, this->group_name(), this->node_.keyword,
+                wells, this->group_name(), this->node().keyword,
                 stepSize, static_cast<int>(sim_step),
-                this->number_, this->node_.fip_region,
+                this->number_, this->node().fip_region,
                 st,
                 simRes.wellSol, simRes.wbp, simRes.grpNwrkSol,
                 input.reg, input.grid, input.sched,
@@ -3227,11 +3341,10 @@ namespace Evaluator {
             const auto& usys = input.es.getUnits();
             const auto  prm  = this->fcn_(args);
 
-            updateValue(this->node_, usys.from_si(prm.unit, prm.value), st);
+            return usys.from_si(prm.unit, prm.value);
         }
 
     private:
-        Opm::EclIO::SummaryNode node_;
         ofun                    fcn_;
         int                     number_{0};
 
@@ -3240,17 +3353,17 @@ namespace Evaluator {
             using Cat = ::Opm::EclIO::SummaryNode::Category;
 
             const auto need_grp_name =
-                (this->node_.category == Cat::Group) ||
-                (this->node_.category == Cat::Node);
+                (this->node().category == Cat::Group) ||
+                (this->node().category == Cat::Node);
 
             return need_grp_name
-                ? this->node_.wgname : std::string{""};
+                ? this->node().wgname : std::string{""};
         }
 
         bool use_number() const
         {
             using Cat = ::Opm::EclIO::SummaryNode::Category;
-            const auto cat = this->node_.category;
+            const auto cat = this->node().category;
 
             return ! ((cat == Cat::Well) ||
                       (cat == Cat::Group) ||
@@ -3260,155 +3373,160 @@ namespace Evaluator {
         }
     };
 
-    class BlockValue : public Base
+    class BlockValue : public NodeValue
     {
     public:
         explicit BlockValue(Opm::EclIO::SummaryNode node,
                             const Opm::UnitSystem::measure m)
-            : node_(std::move(node))
-            , m_   (m)
+            : NodeValue(std::move(node))
+            , m_       (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+    protected:
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double             /* stepSize */,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             auto xPos = simRes.block.find(this->lookupKey());
             if (xPos == simRes.block.end()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second), st);
+            return usys.from_si(this->m_, xPos->second);
         }
 
     private:
-        Opm::EclIO::SummaryNode  node_;
         Opm::UnitSystem::measure m_;
 
         Opm::out::Summary::BlockValues::key_type lookupKey() const
         {
-            return { this->node_.keyword, this->node_.number };
+            return { this->node().keyword, this->node().number };
         }
     };
 
-    class AquiferValue: public Base
+    class AquiferValue : public NodeValue
     {
     public:
         explicit AquiferValue(Opm::EclIO::SummaryNode node,
                               const Opm::UnitSystem::measure m)
-        : node_(std::move(node))
-        , m_   (m)
+            : NodeValue(std::move(node))
+            , m_       (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+    protected:
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double             /* stepSize */,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
         {
-            auto xPos = simRes.aquifers.find(this->node_.number);
+            auto xPos = simRes.aquifers.find(this->node().number);
             if (xPos == simRes.aquifers.end()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second.get(this->node_.keyword)), st);
+            return usys.from_si(this->m_, xPos->second.get(this->node().keyword));
         }
     private:
-        Opm::EclIO::SummaryNode  node_;
         Opm::UnitSystem::measure m_;
     };
 
-    class RegionValue : public Base
+    class RegionValue : public NodeValue
     {
     public:
         explicit RegionValue(Opm::EclIO::SummaryNode node,
                              const Opm::UnitSystem::measure m)
-            : node_(std::move(node))
-            , m_   (m)
+            : NodeValue(std::move(node))
+            , m_       (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+    protected:
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double             /* stepSize */,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
         {
-            if (this->node_.number < 0) {
-                return;
+            if (this->node().number < 0) {
+                return std::nullopt;
             }
 
-            auto xPos = simRes.region.find(this->node_.keyword);
+            auto xPos = simRes.region.find(this->node().keyword);
             if (xPos == simRes.region.end()) {
                 // Vector (e.g., RPR) not available from simulator.
                 // Typically at time zero.
-                return;
+                return std::nullopt;
             }
 
             const auto ix = this->index();
             if (ix >= xPos->second.size()) {
                 // Region ID outside active set (e.g., the node specifies
                 // region ID 12 when max(FIPNUM) == 10)
-                return;
+                return std::nullopt;
             }
 
             const auto  val  = xPos->second[ix];
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
         }
 
     private:
-        Opm::EclIO::SummaryNode  node_;
         Opm::UnitSystem::measure m_;
 
         std::vector<double>::size_type index() const
         {
-            return this->node_.number - 1;
+            return this->node().number - 1;
         }
     };
 
-    class InterRegionValue : public Base
+    class InterRegionValue : public NodeValue
     {
     public:
         explicit InterRegionValue(const Opm::EclIO::SummaryNode& node,
                                   const Opm::UnitSystem::measure m)
-            : node_   (node)
-            , m_      (m)
-            , regname_(node_.fip_region.has_value()
-                       ? node_.fip_region.value()
-                       : std::string{ "FIPNUM" })
+            : NodeValue(node)
+            , m_       (m)
+            , regname_ (node.fip_region.has_value()
+                        ? node.fip_region.value()
+                        : std::string{ "FIPNUM" })
         {
             this->analyzeKeyword();
         }
 
-        void update(const std::size_t    /* sim_step */,
-                    const double            stepSize,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+    protected:
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double             stepSize,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
         {
             if (this->component_ == Component::NumComponents) {
-                return;
+                return std::nullopt;
             }
 
             auto flows = simRes.ireg.find(this->regname_);
             if (flows == simRes.ireg.end()) {
-                return;
+                return std::nullopt;
             }
 
             auto flow = flows->second.getInterRegFlows(this->r1_, this->r2_);
             if (! flow.has_value()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
             const auto  val  = this->getValue(flow->first, flow->second, stepSize);
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
         }
 
     private:
@@ -3416,7 +3534,6 @@ namespace Evaluator {
         using Component  = RateWindow::Component;
         using Direction  = RateWindow::Direction;
 
-        Opm::EclIO::SummaryNode node_;
         Opm::UnitSystem::measure m_;
         std::string regname_{};
 
@@ -3475,7 +3592,7 @@ namespace Evaluator {
             };
 
             auto keywordPieces = std::smatch {};
-            if (std::regex_match(this->node_.keyword, keywordPieces, pattern)) {
+            if (std::regex_match(this->node().keyword, keywordPieces, pattern)) {
                 this->identifyComponent(keywordPieces);
                 this->identifyDirection(keywordPieces);
                 this->identifyCumulative(keywordPieces);
@@ -3504,7 +3621,7 @@ namespace Evaluator {
         void assignRegionIDs()
         {
             const auto& [r1, r2] =
-                Opm::EclIO::splitSummaryNumber(this->node_.number);
+                Opm::EclIO::splitSummaryNumber(this->node().number);
 
             this->r1_ = r1 - 1;
             this->r2_ = r2 - 1;
@@ -3564,33 +3681,34 @@ namespace Evaluator {
         }
     };
 
-    class GlobalProcessValue : public Base
+    class GlobalProcessValue : public NodeValue
     {
     public:
         explicit GlobalProcessValue(Opm::EclIO::SummaryNode node,
                                     const Opm::UnitSystem::measure m)
-            : node_(std::move(node))
-            , m_   (m)
+            : NodeValue(std::move(node))
+            , m_       (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+    protected:
+        std::optional<double>
+        value(const std::size_t        /* sim_step */,
+              const double             /* stepSize */,
+              const InputData&         input,
+              const SimulatorResults&  simRes,
+              const Opm::SummaryState& /* st */) const override
         {
-            auto xPos = simRes.single.find(this->node_.keyword);
+            auto xPos = simRes.single.find(this->node().keyword);
             if (xPos == simRes.single.end())
-                return;
+                return std::nullopt;
 
             const auto  val  = xPos->second;
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
         }
 
     private:
-        Opm::EclIO::SummaryNode  node_;
         Opm::UnitSystem::measure m_;
     };
 
@@ -4342,6 +4460,10 @@ public:
     void internal_store(const SummaryState& st, const int report_step, bool isSubstep);
     void write(const bool is_final_summary);
 
+    /// Refresh region cache with the connections of simulation step
+    /// sim_step.  Must be called before eval() for that step.
+    void updateRegionCache(const int sim_step);
+
 private:
     struct MiniStep
     {
@@ -4353,10 +4475,19 @@ private:
 
     using EvalPtr = SummaryOutputParameters::EvalPtr;
 
+    /// Contiguous range of concurrent evaluators processed by a single
+    /// evaluation task.
+    struct EvaluationTask
+    {
+        std::vector<const Evaluator::NodeValue*>::size_type begin{0};
+        std::vector<const Evaluator::NodeValue*>::size_type end{0};
+    };
+
     std::reference_wrapper<const Opm::EclipseGrid> grid_;
     std::reference_wrapper<const Opm::EclipseState> es_;
     std::reference_wrapper<const Opm::Schedule> sched_;
     Opm::out::RegionCache regCache_{};
+    int regCacheStep_{-1};
 
     std::unique_ptr<SMSpecStreamDeferredCreation> deferredSMSpec_;
 
@@ -4373,6 +4504,12 @@ private:
 
     SummaryOutputParameters                  outputParameters_{};
     std::unordered_map<std::string, EvalPtr> extra_parameters{};
+
+    std::vector<const Evaluator::NodeValue*> concurrentEvaluators_{};
+    std::vector<const Evaluator::Base*>      sequentialEvaluators_{};
+    std::vector<EvaluationTask>              evaluationTasks_{};
+    mutable std::vector<Evaluator::StagingBuffer> stagingBuffers_{};
+
     std::vector<std::string> valueKeys_{};
     std::vector<std::string> valueUnits_{};
     std::vector<MiniStep>    unwritten_{};
@@ -4398,6 +4535,8 @@ private:
                       Evaluator::Factory& evaluatorFactory,
                       SummaryConfig&      summary_config);
 
+    void partitionEvaluators();
+
     MiniStep& getNextMiniStep(const int report_step, bool isSubstep);
     const MiniStep& lastUnwritten() const;
 
@@ -4438,6 +4577,8 @@ SummaryImplementation(SummaryConfig&      sumcfg,
 
     this->configureUDQ(es, sched, evaluatorFactory, sumcfg);
 
+    this->partitionEvaluators();
+
     this->regCache_.buildCache(sumcfg.fip_regions(),
                                es.globalFieldProps(),
                                grid, sched);
@@ -4476,6 +4617,24 @@ internal_store(const SummaryState& st, const int report_step, bool isSubstep)
     }
 }
 
+void
+Opm::out::Summary::SummaryImplementation::
+updateRegionCache(const int sim_step)
+{
+    if (sim_step == this->regCacheStep_) {
+        return;
+    }
+
+    // Pick up connections added to the schedule, e.g., by ACTIONX, after
+    // the region cache was built.
+    const auto step = std::min(static_cast<std::size_t>(sim_step),
+                               this->sched_.get().size() - 1);
+
+    this->regCache_.updateCache(this->es_.get().globalFieldProps(),
+                                this->grid_, this->sched_, step);
+    this->regCacheStep_ = sim_step;
+}
+
 void
 Opm::out::Summary::SummaryImplementation::
 eval(const int                              sim_step,
@@ -4508,13 +4667,41 @@ eval(const int                              sim_step,
         region_values, block_values, aquifer_values, interreg_flows
     };
 
-    for (auto& evalPtr : this->outputParameters_.getEvaluators()) {
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    // Evaluation tasks only read the SummaryState.  Values are collected
+    // in per-task staging buffers and committed in task order, so the
+    // final SummaryState does not depend on the number of threads.
+    const auto numTasks = static_cast<int>(this->evaluationTasks_.size());
+    auto failures = std::vector<std::exception_ptr>(numTasks);
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (int task = 0; task < numTasks; ++task) {
+        auto& buffer = this->stagingBuffers_[task];
+        buffer.clear();
+
+        try {
+            const auto& [begin, end] = this->evaluationTasks_[task];
+            for (auto i = begin; i < end; ++i) {
+                this->concurrentEvaluators_[i]->stage(sim_step, duration, input, simRes,
+                                                      std::as_const(st), buffer);
+            }
+        }
+        catch (...) {
+            failures[task] = std::current_exception();
+        }
     }
 
-    for (auto& [_, evalPtr] : this->extra_parameters) {
-        (void)_;
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    for (const auto& failure : failures) {
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
+
+    for (const auto& buffer : this->stagingBuffers_) {
+        buffer.commit(st);
+    }
+
+    for (const auto* evaluator : this->sequentialEvaluators_) {
+        evaluator->update(sim_step, duration, input, simRes, st);
     }
 
     st.update_elapsed(duration);
@@ -4825,6 +5012,62 @@ configureUDQ(const EclipseState& es,
     }
 }
 
+void
+Opm::out::Summary::SummaryImplementation::partitionEvaluators()
+{
+    // Maximum number of inexpensive evaluators, e.g., single well or
+    // connection values, processed by a single evaluation task.
+    const auto maxTaskSize = std::vector<const Evaluator::NodeValue*>::size_type{64};
+
+    auto partition = [this](const EvalPtr& evalPtr)
+    {
+        const auto* nodeValue = dynamic_cast<const Evaluator::NodeValue*>(evalPtr.get());
+
+        if ((nodeValue != nullptr) && nodeValue->isConcurrent()) {
+            this->concurrentEvaluators_.push_back(nodeValue);
+        }
+        else {
+            this->sequentialEvaluators_.push_back(evalPtr.get());
+        }
+    };
+
+    for (const auto& evalPtr : this->outputParameters_.getEvaluators()) {
+        partition(evalPtr);
+    }
+
+    for (const auto& [_, evalPtr] : this->extra_parameters) {
+        (void)_;
+        partition(evalPtr);
+    }
+
+    // Evaluators which aggregate over many wells or connections--field,
+    // group, and region level quantities--get an evaluation task of their
+    // own.  Other evaluators are grouped into tasks of at most maxTaskSize
+    // elements.
+    const auto numEval = this->concurrentEvaluators_.size();
+    auto begin = 0*numEval;
+    for (auto i = 0*numEval; i < numEval; ++i) {
+        if (this->concurrentEvaluators_[i]->isAggregate()) {
+            if (begin < i) {
+                this->evaluationTasks_.push_back({ begin, i });
+            }
+
+            this->evaluationTasks_.push_back({ i, i + 1 });
+            begin = i + 1;
+        }
+        else if (i + 1 - begin == maxTaskSize) {
+            this->evaluationTasks_.push_back({ begin, i + 1 });
+            begin = i + 1;
+        }
+    }
+
+    if (begin < numEval) {
+        this->evaluationTasks_.push_back({ begin, numEval });
+    }
+
+    this->stagingBuffers_.resize(this->evaluationTasks_.size());
+}
+
 void
 Opm::out::Summary::SummaryImplementation::
 configureRequiredRestartParameters(const SummaryConfig& sumcfg,
@@ -4977,6 +5220,7 @@ void Summary::eval(SummaryState&                          st,
 
     auto process_values = single_values;
 
+    this->pImpl_->updateRegionCache(sim_step);
     this->pImpl_->eval(sim_step, secs_elapsed,
                        well_solution, wbp, grp_nwrk_solution,
                        std::move(process_values),
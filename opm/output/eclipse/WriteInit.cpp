@@ -240,6 +240,16 @@ namespace {
         return { x.begin(), x.end() };
     }
 
+    std::vector<float> singlePrecision(const ::Opm::UnitSystem&         units,
+                                       const ::Opm::UnitSystem::measure m,
+                                       const std::vector<double>&       si)
+    {
+        auto raw = std::vector<float>(si.size());
+        units.from_si(m, si.data(), si.size(), raw.data());
+
+        return raw;
+    }
+
     ::Opm::RestartIO::LogiHEAD::PVTModel
     pvtFlags(const ::Opm::Runspec& rspec, const ::Opm::TableManager& tabMgr)
     {
@@ -320,9 +330,8 @@ namespace {
                          const ::Opm::UnitSystem&          units,
                          ::Opm::EclIO::OutputStream::Init& initFile)
     {
-        auto porv = es.globalFieldProps().porv(true);
-        units.from_si(::Opm::UnitSystem::measure::volume, porv);
-        initFile.write("PORV", singlePrecision(porv));
+        const auto porv = es.globalFieldProps().porv(true);
+        initFile.write("PORV", singlePrecision(units, ::Opm::UnitSystem::measure::volume, porv));
     }
 
     void writeIntegerCellProperties(const ::Opm::EclipseState&        es,
@@ -353,25 +362,25 @@ namespace {
         const auto length = ::Opm::UnitSystem::measure::length;
         const auto nAct   = grid.getNumActive();
 
-        auto dx    = std::vector<float>{};  dx   .reserve(nAct);
-        auto dy    = std::vector<float>{};  dy   .reserve(nAct);
-        auto dz    = std::vector<float>{};  dz   .reserve(nAct);
-        auto depth = std::vector<float>{};  depth.reserve(nAct);
+        auto dx    = std::vector<double>{};  dx   .reserve(nAct);
+        auto dy    = std::vector<double>{};  dy   .reserve(nAct);
+        auto dz    = std::vector<double>{};  dz   .reserve(nAct);
+        auto depth = std::vector<double>{};  depth.reserve(nAct);
 
         for (auto cell = 0*nAct; cell < nAct; ++cell) {
             const auto  globCell = grid.getGlobalIndex(cell);
             const auto& dims     = grid.getCellDims(globCell);
 
-            dx   .push_back(units.from_si(length, dims[0]));
-            dy   .push_back(units.from_si(length, dims[1]));
-            dz   .push_back(units.from_si(length, dims[2]));
-            depth.push_back(units.from_si(length, grid.getCellDepth(globCell)));
+            dx   .push_back(dims[0]);
+            dy   .push_back(dims[1]);
+            dz   .push_back(dims[2]);
+            depth.push_back(grid.getCellDepth(globCell));
         }
 
-        initFile.write("DEPTH", depth);
-        initFile.write("DX"   , dx);
-        initFile.write("DY"   , dy);
-        initFile.write("DZ"   , dz);
+        initFile.write("DEPTH", singlePrecision(units, length, depth));
+        initFile.write("DX"   , singlePrecision(units, length, dx));
+        initFile.write("DY"   , singlePrecision(units, length, dy));
+        initFile.write("DZ"   , singlePrecision(units, length, dz));
     }
 
     template <class WriteVector>
@@ -418,20 +427,17 @@ namespace {
                                     std::vector<bool>&&   dflt,
                                     std::vector<double>&& value)
             {
-                units.from_si(prop.unit, value);
+                auto raw = singlePrecision(units, prop.unit, value);
 
                 for (auto n = dflt.size(), i = 0*n; i < n; ++i) {
                     if (dflt[i]) {
                         // Element defaulted.  Output sentinel value
                         // (-1.0e+20) to signify defaulted element.
-                        //
-                        // Note: Start as float for roundtripping through
-                        // function singlePrecision().
-                        value[i] = static_cast<double>(-1.0e+20f);
+                        raw[i] = -1.0e+20f;
                     }
                 }
 
-                initFile.write(prop.name, singlePrecision(value));
+                initFile.write(prop.name, raw);
             });
         }
         else {
@@ -439,8 +445,7 @@ namespace {
                 [&units, &initFile](const CellProperty&   prop,
                                     std::vector<double>&& value)
             {
-                units.from_si(prop.unit, value);
-                initFile.write(prop.name, singlePrecision(value));
+                initFile.write(prop.name, singlePrecision(units, prop.unit, value));
             });
         }
     }
@@ -575,9 +580,8 @@ namespace {
             tran.push_back(nd.trans);
         }
 
-        units.from_si(::Opm::UnitSystem::measure::transmissibility, tran);
-
-        initFile.write("TRANNNC", singlePrecision(tran));
+        initFile.write("TRANNNC",
+                       singlePrecision(units, ::Opm::UnitSystem::measure::transmissibility, tran));
     }
 
     // output aquifer cell and aquifer connection information for numerical aquifers
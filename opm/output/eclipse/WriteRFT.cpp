@@ -46,6 +46,8 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <functional>
 #include <initializer_list>
 #include <memory>
@@ -1782,6 +1784,9 @@ namespace {
 // ===========================================================================
 
 namespace {
+    // Fewer wells than this are processed by a single thread.
+    constexpr auto minParallelRFTWells = std::int64_t{4};
+
     std::vector<WellRFTOutputData::DataTypes>
     rftDataTypes(const Opm::RFTConfig& rft_config,
                  const std::string&    well_name)
@@ -1821,6 +1826,11 @@ void Opm::RftIO::write(const int                        reportStep,
     const auto timePoint = ::Opm::RestartIO::
         getSimulationTimePoint(schedule.getStartTime(), elapsed);
 
+    // Record objects refer to themselves through their data handlers and
+    // must therefore not be moved once created.
+    auto rftOutput = std::vector<std::unique_ptr<WellRFTOutputData>>{};
+    auto rftWellSol = std::vector<const ::Opm::data::Well*>{};
+
     for (const auto& wname : schedule.wellNames(reportStep)) {
         const auto rftTypes = rftDataTypes(rftCfg, wname);
 
@@ -1836,17 +1846,39 @@ void Opm::RftIO::write(const int                        reportStep,
         }
 
         // RFT file output requested for 'wname' at this time and dynamic
-        // data is available.  Collect requisite information.
-        auto rftOutput = WellRFTOutputData {
-            rftTypes, elapsed, timePoint, usys, grid,
-            schedule[reportStep].wells(wname)
-        };
+        // data is available.
+        rftOutput.push_back(std::make_unique<WellRFTOutputData>
+                            (rftTypes, elapsed, timePoint, usys, grid,
+                             schedule[reportStep].wells(wname)));
+
+        rftWellSol.push_back(&xwPos->second);
+    }
+
+    // Collect requisite information.  Wells are independent, so form the
+    // records concurrently.
+    const auto numWells = static_cast<std::int64_t>(rftOutput.size());
+    auto failures = std::vector<std::exception_ptr>(numWells);
 
-        rftOutput.addDynamicData(xwPos->second);
+#pragma omp parallel for schedule(dynamic) if (numWells >= minParallelRFTWells)
+    for (std::int64_t well = 0; well < numWells; ++well) {
+        try {
+            rftOutput[well]->addDynamicData(*rftWellSol[well]);
+        }
+        catch (...) {
+            failures[well] = std::current_exception();
+        }
+    }
+
+    for (const auto& failure : failures) {
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
 
-        // Emit RFT file output record for 'wname'.  This transparently
-        // handles wells without connections--e.g., if the well is only
-        // connected in inactive/deactivated cells.
-        rftOutput.write(rftFile);
+    // Emit RFT file output records in well order.  This transparently
+    // handles wells without connections--e.g., if the well is only
+    // connected in inactive/deactivated cells.
+    for (const auto& output : rftOutput) {
+        output->write(rftFile);
     }
 }
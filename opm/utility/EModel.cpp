@@ -22,14 +22,57 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <filesystem>
 #include <iterator>
+#include <numeric>
 #include <string>
 
 using EclEntry = std::tuple<std::string, Opm::EclIO::eclArrType, long int>;
 using ParamEntry = std::tuple<std::string, Opm::EclIO::eclArrType>;
 
+namespace {
+
+    // Filters are applied as branch free passes over the byte mask, one
+    // element per active cell, such that the loops vectorise and may be
+    // split between threads.
+    template <typename T, typename Predicate>
+    void applyPredicate(const std::vector<T>& param, std::vector<unsigned char>& mask, Predicate pred)
+    {
+        const auto size = static_cast<std::int64_t>(std::min(param.size(), mask.size()));
+
+        const T* p = param.data();
+        unsigned char* m = mask.data();
+
+#pragma omp parallel for schedule(static)
+        for (std::int64_t i = 0; i < size; i++)
+            m[i] &= static_cast<unsigned char>(pred(p[i]));
+    }
+
+    template <typename T>
+    double maskedSum(const std::vector<T>& param, const std::vector<unsigned char>& mask)
+    {
+        const auto size = static_cast<std::int64_t>(std::min(param.size(), mask.size()));
+
+        double sum = 0.0;
+
+#pragma omp parallel for schedule(static) reduction(+:sum)
+        for (std::int64_t i = 0; i < size; i++)
+            sum += mask[i] ? static_cast<double>(param[i]) : 0.0;
+
+        return sum;
+    }
+
+    void unknownOperator(const std::string& opperator)
+    {
+        const std::string message =
+            fmt::format("Unknown operator {} used to set filter", opperator);
+        throw std::invalid_argument(message);
+    }
+
+} // Anonymous namespace
+
 
 EModel::EModel(const std::string& filename) :
     initfile(filename)
@@ -136,6 +179,7 @@ EModel::EModel(const std::string& filename) :
 
     celVolCalculated = false;
     activeFilter = false;
+    filterIndicesValid = false;
 }
 
 void EModel::setReportStep(int rstep)
@@ -195,10 +239,10 @@ void EModel::get_cell_volumes_from_grid()
         throw std::runtime_error(message);
     }
 
-    CELLVOL.clear();
+    CELLVOL.resize(nActive);
 
     for (size_t n = 0;n < nActive; n++)
-        CELLVOL.push_back(grid->getCellVolume(I[n]-1, J[n]-1, K[n]-1));
+        CELLVOL[n] = grid->getCellVolume(I[n]-1, J[n]-1, K[n]-1);
 
     celVolCalculated = true;
 }
@@ -222,7 +266,49 @@ std::vector<ParamEntry> EModel::getListOfParameters() const
 
 int EModel::getNumberOfActiveCells()
 {
-    return std::count(ActFilter.begin(), ActFilter.end(), true);
+    if (!activeFilter)
+        return static_cast<int>(nActive);
+
+    return static_cast<int>(getFilterIndices().size());
+}
+
+const std::vector<int>& EModel::getFilterIndices()
+{
+    if (filterIndicesValid)
+        return filterIndices;
+
+    // Two passes over fixed size chunks of the mask; count selected cells
+    // per chunk, then write the indices of each chunk at its offset.
+    const std::int64_t chunkSize = 1 << 16;
+    const auto size = static_cast<std::int64_t>(ActFilter.size());
+    const std::int64_t numChunks = (size + chunkSize - 1) / chunkSize;
+
+    std::vector<std::int64_t> offset(numChunks + 1, 0);
+
+#pragma omp parallel for schedule(static)
+    for (std::int64_t c = 0; c < numChunks; c++) {
+        const auto first = ActFilter.begin() + c*chunkSize;
+        const auto last = ActFilter.begin() + std::min(size, (c + 1)*chunkSize);
+
+        offset[c + 1] = std::count_if(first, last, [](const unsigned char m) { return m != 0; });
+    }
+
+    std::partial_sum(offset.begin(), offset.end(), offset.begin());
+
+    filterIndices.resize(offset.back());
+
+#pragma omp parallel for schedule(static)
+    for (std::int64_t c = 0; c < numChunks; c++) {
+        auto pos = offset[c];
+
+        for (std::int64_t i = c*chunkSize; i < std::min(size, (c + 1)*chunkSize); i++)
+            if (ActFilter[i])
+                filterIndices[pos++] = static_cast<int>(i);
+    }
+
+    filterIndicesValid = true;
+
+    return filterIndices;
 }
 
 bool EModel::hasInitParameter(const std::string &name) const
@@ -255,52 +341,41 @@ bool EModel::hasReportStep(int rstep)
 void EModel::resetFilter()
 {
     activeFilter=false;
-    std::fill(ActFilter.begin(), ActFilter.end(), true);
+    filterIndicesValid = false;
+    std::fill(ActFilter.begin(), ActFilter.end(), 1);
 }
 
 
 template <typename T>
 void EModel::updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value)
 {
-    if ((opperator == "eq") || (opperator == "==")){
-       for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] != value))
-                ActFilter[i] = false;
+    if ((opperator == "eq") || (opperator == "=="))
+        applyPredicate(paramVect, ActFilter, [value](const T x) { return x == value; });
 
-    } else if ((opperator=="lt") || (opperator=="<")) {
-        for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] >= value))
-                ActFilter[i] = false;
+    else if ((opperator=="lt") || (opperator=="<"))
+        applyPredicate(paramVect, ActFilter, [value](const T x) { return !(x >= value); });
 
-    } else if ((opperator == "gt") || (opperator == ">")){
-        for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] <= value))
-                ActFilter[i] = false;
+    else if ((opperator == "gt") || (opperator == ">"))
+        applyPredicate(paramVect, ActFilter, [value](const T x) { return !(x <= value); });
 
-    } else {
-        const std::string message =
-            fmt::format("Unknown operator {} used to set filter", opperator);
-        throw std::invalid_argument(message);
-    }
+    else
+        unknownOperator(opperator);
 
     activeFilter = true;
+    filterIndicesValid = false;
 }
 
 template <typename T>
 void EModel::updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value1, T value2)
 {
-    if ((opperator == "in") || (opperator == "between")) {
-        for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && ((paramVect[i] <= value1) || (paramVect[i] >= value2)))
-                ActFilter[i] = false;
+    if ((opperator == "in") || (opperator == "between"))
+        applyPredicate(paramVect, ActFilter, [value1, value2](const T x) { return !((x <= value1) || (x >= value2)); });
 
-    } else {
-        const std::string message =
-            fmt::format("Unknown operator {} used to set filter", opperator);
-        throw std::invalid_argument(message);
-    }
+    else
+        unknownOperator(opperator);
 
     activeFilter = true;
+    filterIndicesValid = false;
 }
 
 template <typename T>
@@ -345,21 +420,21 @@ const std::vector<T>& EModel::get_filter_param(const std::string& param)
 template <>
 void EModel::addFilter<int>(const std::string& param1, const std::string& opperator, int num)
 {
-    std::vector<int> paramVect = get_filter_param<int>(param1);
+    const auto& paramVect = get_filter_param<int>(param1);
     updateActiveFilter(paramVect, opperator, num);
 }
 
 template <>
 void EModel::addFilter<int>(const std::string& param1, const std::string& opperator, int num1, int num2)
 {
-    std::vector<int> paramVect = get_filter_param<int>(param1);;
+    const auto& paramVect = get_filter_param<int>(param1);
     updateActiveFilter(paramVect, opperator, num1, num2);
 }
 
 template <>
 void EModel::addFilter<float>(const std::string& param1, const std::string& opperator, float num)
 {
-    std::vector<float> paramVect = get_filter_param<float>(param1);
+    const auto& paramVect = get_filter_param<float>(param1);
     updateActiveFilter(paramVect, opperator, num);
 }
 
@@ -367,7 +442,7 @@ void EModel::addFilter<float>(const std::string& param1, const std::string& oppe
 template <>
 void EModel::addFilter<float>(const std::string& param1, const std::string& opperator, float num1, float num2)
 {
-    std::vector<float> paramVect = get_filter_param<float>(param1);
+    const auto& paramVect = get_filter_param<float>(param1);
     updateActiveFilter(paramVect, opperator, num1, num2);
 }
 
@@ -379,57 +454,88 @@ void EModel::addHCvolFilter()
                                  "function setDepthfwl before using "
                                  "filter HC filter");
 
-    auto eqlnum = initfile.get<int>("EQLNUM");
-    auto depth = initfile.get<float>("DEPTH");
+    const auto& eqlnum = initfile.get<int>("EQLNUM");
+    const auto& depth = initfile.get<float>("DEPTH");
     activeFilter = true;
+    filterIndicesValid = false;
 
-    for (size_t n = 0; n < eqlnum.size();n++){
-        int eql = eqlnum[n];
-        float fwl = FreeWaterlevel[eql-1];
+    const auto size = static_cast<std::int64_t>(std::min(eqlnum.size(), ActFilter.size()));
+    const auto& fwl = FreeWaterlevel;
 
-        if ((ActFilter[n]) && (depth[n] > fwl))
-            ActFilter[n] = false;
-    }
+#pragma omp parallel for schedule(static)
+    for (std::int64_t n = 0; n < size; n++)
+        ActFilter[n] &= static_cast<unsigned char>(!(depth[n] > fwl[eqlnum[n] - 1]));
 }
 
 
-template <>
-const std::vector<float>& EModel::getParam<float>(const std::string& name)
+template <typename T>
+const std::vector<T>& EModel::getFilteredParam(const std::string& name, std::vector<T>& filtered)
 {
-    if (activeFilter) {
-        std::vector<float> param = get_filter_param<float>(name);
-        filteredFloatVect.clear();
+    const auto& param = get_filter_param<T>(name);
 
-        for (size_t i = 0; i < param.size(); i++)
-            if (ActFilter[i])
-                filteredFloatVect.push_back(param[i]);
+    if (!activeFilter)
+        return param;
 
-        return filteredFloatVect;
+    const auto& indices = getFilterIndices();
+    const auto size = static_cast<std::int64_t>(indices.size());
 
-    } else {
+    filtered.resize(indices.size());
 
-        return get_filter_param<float>(name);
-    }
+#pragma omp parallel for schedule(static)
+    for (std::int64_t i = 0; i < size; i++)
+        filtered[i] = param[indices[i]];
+
+    return filtered;
+}
+
+
+template <>
+const std::vector<float>& EModel::getParam<float>(const std::string& name)
+{
+    return getFilteredParam(name, filteredFloatVect);
 }
 
 
 template <>
 const std::vector<int>& EModel::getParam<int>(const std::string& name)
 {
-    if (activeFilter) {
-        std::vector<int> param = get_filter_param<int>(name);
-        filteredIntVect.clear();
+    return getFilteredParam(name, filteredIntVect);
+}
 
-        for (size_t i = 0; i < param.size(); i++)
-            if (ActFilter[i])
-                filteredIntVect.push_back(param[i]);
 
-        return filteredIntVect;
+template <>
+double EModel::getSum<float>(const std::string& name)
+{
+    return maskedSum(get_filter_param<float>(name), ActFilter);
+}
+
+
+template <>
+double EModel::getSum<int>(const std::string& name)
+{
+    return maskedSum(get_filter_param<int>(name), ActFilter);
+}
 
-    } else {
 
-        return get_filter_param<int>(name);
+double EModel::getHCPoreVolume()
+{
+    if (!hasSolutionParameter("SWAT")) {
+        const std::string message =
+            fmt::format("parameter SWAT, needed for hydrocarbon pore volume, "
+                        "not found for report step {}", activeReportStep);
+        throw std::invalid_argument(message);
     }
+
+    const auto& swat = getSolutionFloat("SWAT");
+    const auto size = static_cast<std::int64_t>(std::min(swat.size(), ActFilter.size()));
+
+    double sum = 0.0;
+
+#pragma omp parallel for schedule(static) reduction(+:sum)
+    for (std::int64_t n = 0; n < size; n++)
+        sum += ActFilter[n] ? static_cast<double>(PORV[n]) * (1.0 - swat[n]) : 0.0;
+
+    return sum;
 }
 
 
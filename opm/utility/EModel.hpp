@@ -64,6 +64,21 @@ public:
 
     int getNumberOfActiveCells();
 
+    // Zero based indices, among the active cells, of the cells passing all
+    // filters. Rebuilt on first use after the filter has changed.
+    const std::vector<int>& getFilterIndices();
+
+    // One byte per active cell, non-zero for cells passing all filters
+    const std::vector<unsigned char>& getFilterMask() const { return ActFilter; }
+
+    // Sum of parameter over cells passing all filters
+    template <typename T>
+    double getSum(const std::string& name);
+
+    // Hydrocarbon pore volume, PORV * (1 - SWAT), summed over cells
+    // passing all filters. Requires SWAT in the active report step.
+    double getHCPoreVolume();
+
 
     std::tuple<int, int, int> gridDims(){ return std::make_tuple(nI, nJ, nK); };
 
@@ -75,7 +90,7 @@ private:
 
     size_t nActive;
 
-    bool activeFilter, celVolCalculated;
+    bool activeFilter, celVolCalculated, filterIndicesValid;
 
     std::vector<float> filteredFloatVect;
     std::vector<int> filteredIntVect;
@@ -83,7 +98,8 @@ private:
     std::vector<float> PORV;
     std::vector<float> CELLVOL;
     std::vector<int> I, J, K;
-    std::vector<bool> ActFilter;
+    std::vector<unsigned char> ActFilter;
+    std::vector<int> filterIndices;
 
     Opm::EclIO::EclFile initfile;
     std::optional<Opm::EclipseGrid> grid;
@@ -122,6 +138,9 @@ private:
     template <typename T>
     void updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value1, T value2);
 
+    template <typename T>
+    const std::vector<T>& getFilteredParam(const std::string& name, std::vector<T>& filtered);
+
 };
 
 #endif
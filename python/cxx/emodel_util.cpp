@@ -57,6 +57,26 @@ py::array get_param(EModel * file_ptr, std::string key)
 }
 
 
+py::array get_filter_indices(EModel * file_ptr)
+{
+    const auto& indices = file_ptr->getFilterIndices();
+    return py::array(py::dtype("i"), {indices.size()}, {}, indices.data());
+}
+
+
+double get_sum(EModel * file_ptr, std::string key)
+{
+    Opm::EclIO::eclArrType arrType = getArrayType(file_ptr, key);
+
+    if (arrType == Opm::EclIO::REAL)
+        return file_ptr->getSum<float>(key);
+    else if (arrType == Opm::EclIO::INTE)
+        return file_ptr->getSum<int>(key);
+    else
+        throw std::logic_error("Data type not supported");
+}
+
+
 void add_int_filter_1value(EModel * file_ptr, std::string key, std::string opr, int value)
 {
     file_ptr->addFilter<int>(key, opr, value);
@@ -98,6 +118,9 @@ void python::common::export_EModel(py::module& m) {
         .def("set_report_step", &EModel::setReportStep)
         .def("reset_filter", &EModel::resetFilter)
         .def("get", &get_param)
+        .def("active_indices", &get_filter_indices)
+        .def("sum", &get_sum)
+        .def("hc_pore_volume", &EModel::getHCPoreVolume)
         .def("__add_filter", &add_int_filter_1value)
         .def("__add_filter", &add_float_filter_1value)
         .def("__add_filter", &add_int_filter_2values)
@@ -1,6 +1,8 @@
 #include <ctime>
 #include <chrono>
 #include <map>
+#include <memory>
+#include <mutex>
 
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
@@ -54,18 +56,29 @@ namespace {
         return system_clock::from_time_t(local_time);
     }
 
-    const Well& get_well( const Schedule& sch, const std::string& name, const size_t& timestep ) try {
-        return sch.getWell( name, timestep );
+    /*
+      While a PYACTION script runs, the report steps after inserted keywords are
+      only re-evaluated when the script returns. Everything which reads the
+      schedule from Python completes that first, so scripts read back their
+      own changes.
+    */
+    const Schedule& current( Schedule& sch ) {
+        sch.applyPendingUpdates();
+        return sch;
+    }
+
+    const Well& get_well( Schedule& sch, const std::string& name, const size_t& timestep ) try {
+        return current(sch).getWell( name, timestep );
     } catch( const std::invalid_argument& e ) {
         throw py::key_error( name );
     }
 
     std::map<std::string, double> get_production_properties(
-        const Schedule& sch, const std::string& well_name, const size_t& report_step)
+        Schedule& sch, const std::string& well_name, const size_t& report_step)
     {
         const Well* well = nullptr;
         try{
-            well = &(sch.getWell( well_name, report_step ));
+            well = &(current(sch).getWell( well_name, report_step ));
         } catch( const std::out_of_range& e ) {
             throw py::index_error( fmt::format("well {} is not defined", well_name ));
         }
@@ -88,11 +101,11 @@ namespace {
     }
 
     std::map<std::string, double> get_injection_properties(
-        const Schedule& sch, const std::string& well_name, const size_t& report_step)
+        Schedule& sch, const std::string& well_name, const size_t& report_step)
     {
         const Well* well = nullptr;
         try{
-            well = &(sch.getWell( well_name, report_step ));
+            well = &(current(sch).getWell( well_name, report_step ));
         } catch( const std::out_of_range& e ) {
             throw py::index_error( fmt::format("well {}: invalid well name", well_name ));
         }
@@ -115,12 +128,13 @@ namespace {
         return datetime(s.posixStartTime());
     }
 
-    system_clock::time_point get_end_time( const Schedule& s ) {
-        return datetime(s.posixEndTime());
+    system_clock::time_point get_end_time( Schedule& sch ) {
+        return datetime(current(sch).posixEndTime());
     }
 
-    std::vector<system_clock::time_point> get_timesteps( const Schedule& s ) {
+    std::vector<system_clock::time_point> get_timesteps( Schedule& sch ) {
         std::vector< system_clock::time_point > v;
+        const auto& s = current(sch);
 
         for( size_t i = 0; i < s.size(); ++i )
             v.push_back( datetime( std::chrono::system_clock::to_time_t(s[i].start_time() )));
@@ -128,27 +142,51 @@ namespace {
         return v;
     }
 
-    std::vector<Group> get_groups( const Schedule& sch, size_t timestep ) {
+    std::vector<Group> get_groups( Schedule& sch, size_t timestep ) {
         std::vector< Group > groups;
-        for( const auto& group_name : sch.groupNames())
+        for( const auto& group_name : current(sch).groupNames())
             groups.push_back( sch.getGroup(group_name, timestep) );
 
         return groups;
     }
 
-    bool has_well( const Schedule& sch, const std::string& wellName) {
-        return sch.hasWell( wellName );
+    bool has_well( Schedule& sch, const std::string& wellName) {
+        return current(sch).hasWell( wellName );
+    }
+
+    const ScheduleState& getitem(Schedule& sch, std::size_t report_step) {
+        return current(sch)[report_step];
+    }
+
+    std::size_t size( Schedule& sch ) {
+        return current(sch).size();
+    }
+
+    std::vector<Well> get_wells( Schedule& sch, std::size_t report_step ) {
+        return current(sch).getWells(report_step);
     }
 
-    const ScheduleState& getitem(const Schedule& sch, std::size_t report_step) {
-        return sch[report_step];
+    std::vector<std::string> well_names( Schedule& sch, const std::string& well_name_pattern ) {
+        return current(sch).wellNames(well_name_pattern);
+    }
+
+    /*
+      Creating a Parser instantiates all keyword definitions, which is too slow
+      to do for every insert_keywords() call. The parser is created on first use
+      and shared by all interpreters in the process; it lives until the process
+      exits. It is only used through const member functions.
+    */
+    const Parser& keyword_parser() {
+        static std::once_flag created;
+        static std::unique_ptr<const Parser> parser;
+        std::call_once(created, []() { parser = std::make_unique<const Parser>(); });
+        return *parser;
     }
 
     std::vector<std::unique_ptr<DeckKeyword>> parseKeywords(const std::string& deck_string, const UnitSystem& unit_system)
     {
-        Parser parser;
         std::string str {unit_system.deck_name() + "\n\n" + deck_string};
-        auto deck = parser.parseString(str);
+        auto deck = keyword_parser().parseString(str);
         std::vector<std::unique_ptr<DeckKeyword>> keywords;
         for (auto &keyword : deck) {
             keywords.push_back(std::make_unique<DeckKeyword>(keyword));
@@ -208,7 +246,7 @@ void python::common::export_Schedule(py::module& module) {
     .def_property_readonly( "start",  &get_start_time )
     .def_property_readonly( "end",    &get_end_time )
     .def_property_readonly( "timesteps", &get_timesteps )
-    .def("__len__", &Schedule::size)
+    .def("__len__", &size)
     .def("__getitem__", &getitem, py::arg("report_step"), Schedule_getitem_docstring)
     .def("shut_well", py::overload_cast<const std::string&, std::size_t>(&Schedule::shut_well), py::arg("well_name"), py::arg("step"), Schedule_shut_well_well_name_step_docstring)
     .def("shut_well", py::overload_cast<const std::string&>(&Schedule::shut_well), py::arg("well_name"), Schedule_shut_well_well_name_docstring)
@@ -216,15 +254,15 @@ void python::common::export_Schedule(py::module& module) {
     .def("open_well", py::overload_cast<const std::string&>(&Schedule::open_well), py::arg("well_name"), Schedule_open_well_well_name_docstring)
     .def("stop_well", py::overload_cast<const std::string&, std::size_t>(&Schedule::stop_well), py::arg("well_name"), py::arg("step"), Schedule_stop_well_well_name_step_docstring)
     .def("stop_well", py::overload_cast<const std::string&>(&Schedule::stop_well), py::arg("well_name"), Schedule_stop_well_well_name_docstring)
-    .def( "get_wells", &Schedule::getWells, py::arg("well_name_pattern"), Schedule_get_wells_docstring)
+    .def( "get_wells", &get_wells, py::arg("well_name_pattern"), Schedule_get_wells_docstring)
     .def( "get_injection_properties", &get_injection_properties, py::arg("well_name"), py::arg("report_step"), Schedule_get_injection_properties_docstring)
     .def( "get_production_properties", &get_production_properties, py::arg("well_name"), py::arg("report_step"), Schedule_get_production_properties_docstring)
-    .def("well_names", py::overload_cast<const std::string&>(&Schedule::wellNames, py::const_), py::arg("well_name_pattern"))
+    .def("well_names", &well_names, py::arg("well_name_pattern"))
     .def( "get_well", &get_well, py::arg("well_name"), py::arg("report_step"), Schedule_get_well_docstring)
     .def( "insert_keywords", py::overload_cast<Schedule&, py::list&, std::size_t>(&insert_keywords), py::arg("keywords"), py::arg("step"))
     .def( "insert_keywords", py::overload_cast<Schedule&, const std::string&, std::size_t, const UnitSystem&>(&insert_keywords), py::arg("data"), py::arg("step"), py::arg("unit_system"))
-    .def( "insert_keywords", py::overload_cast<Schedule&, const std::string&, std::size_t>(&insert_keywords), py::arg("data"), py::arg("step"))
-    .def( "insert_keywords", py::overload_cast<Schedule&, const std::string&>(&insert_keywords),py::arg("data"))
+    .def( "insert_keywords", py::overload_cast<Schedule&, const std::string&, std::size_t>(&insert_keywords), py::arg("data"), py::arg("step"), Schedule_insert_keywords_data_step_docstring)
+    .def( "insert_keywords", py::overload_cast<Schedule&, const std::string&>(&insert_keywords),py::arg("data"), Schedule_insert_keywords_data_docstring)
     .def("__contains__", &has_well, py::arg("well_name"))
     ;
 }
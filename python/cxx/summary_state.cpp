@@ -17,6 +17,9 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include <chrono>
+#include <limits>
+#include <string>
+#include <vector>
 
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/common/utility/TimeService.hpp>
@@ -24,6 +27,7 @@
 #include <pybind11/stl.h>
 #include <pybind11/chrono.h>
 #include "export.hpp"
+#include "converters.hpp"
 
 #include <python/cxx/OpmCommonPythonDoc.hpp>
 
@@ -38,6 +42,26 @@ std::vector<std::string> wells(const SummaryState * st) {
     return st->wells();
 }
 
+// Values of one variable for a list of wells or groups in a single call,
+// with NaN for the entities which do not have the variable.  UDQ results
+// are stored in the summary state too, so this also serves WU* and GU*
+// variables.
+py::array_t<double> well_var_array(const SummaryState * st, const std::string& var, const std::vector<std::string>& well_names) {
+    return convert::numpy_array(st->get_well_vars(var, well_names, std::numeric_limits<double>::quiet_NaN()));
+}
+
+py::array_t<double> all_well_var_array(const SummaryState * st, const std::string& var) {
+    return well_var_array(st, var, st->wells());
+}
+
+py::array_t<double> group_var_array(const SummaryState * st, const std::string& var, const std::vector<std::string>& group_names) {
+    return convert::numpy_array(st->get_group_vars(var, group_names, std::numeric_limits<double>::quiet_NaN()));
+}
+
+py::array_t<double> all_group_var_array(const SummaryState * st, const std::string& var) {
+    return group_var_array(st, var, st->groups());
+}
+
 
 }
 
@@ -53,6 +77,10 @@ void python::common::export_SummaryState(py::module& module) {
         .def("update_group_var", &SummaryState::update_group_var, py::arg("group_name"), py::arg("variable_name"), py::arg("new_value"), SummaryState_update_group_var_docstring)
         .def("well_var", py::overload_cast<const std::string&, const std::string&>(&SummaryState::get_well_var, py::const_), py::arg("well_name"), py::arg("variable_name"), SummaryState_well_var_docstring)
         .def("group_var", py::overload_cast<const std::string&, const std::string&>(&SummaryState::get_group_var, py::const_), py::arg("group_name"), py::arg("variable_name"), SummaryState_group_var_docstring)
+        .def("well_var_array", &well_var_array, py::arg("variable_name"), py::arg("well_names"), SummaryState_well_var_array_docstring)
+        .def("well_var_array", &all_well_var_array, py::arg("variable_name"), SummaryState_well_var_array_docstring)
+        .def("group_var_array", &group_var_array, py::arg("variable_name"), py::arg("group_names"), SummaryState_group_var_array_docstring)
+        .def("group_var_array", &all_group_var_array, py::arg("variable_name"), SummaryState_group_var_array_docstring)
         .def("elapsed", &SummaryState::get_elapsed, SummaryState_elapsed_docstring)
         .def_property_readonly("groups", groups, SummaryState_groups_docstring)
         .def_property_readonly("wells", wells, SummaryState_wells_docstring)
@@ -2738,12 +2738,20 @@ class SummaryState:
     def __init__(self, arg0: int) -> None: ...
     def elapsed(self) -> float: ...
     def group_var(self, group_name: str, variable_name: str) -> float: ...
+    @overload
+    def group_var_array(self, variable_name: str, group_names: List[str]) -> numpy.ndarray[numpy.float64]: ...
+    @overload
+    def group_var_array(self, variable_name: str) -> numpy.ndarray[numpy.float64]: ...
     def has_group_var(self, group_name: str, variable_name: str) -> bool: ...
     def has_well_var(self, well_name: str, variable_name: str) -> bool: ...
     def update(self, arg0: str, arg1: float) -> None: ...
     def update_group_var(self, group_name: str, variable_name: str, new_value: float) -> None: ...
     def update_well_var(self, well_name: str, variable_name: str, new_value: float) -> None: ...
     def well_var(self, well_name: str, variable_name: str) -> float: ...
+    @overload
+    def well_var_array(self, variable_name: str, well_names: List[str]) -> numpy.ndarray[numpy.float64]: ...
+    @overload
+    def well_var_array(self, variable_name: str) -> numpy.ndarray[numpy.float64]: ...
     def __contains__(self, arg0: str) -> bool: ...
     def __getitem__(self, arg0: str) -> float: ...
     def __setitem__(self, arg0: str, arg1: float) -> None: ...
@@ -178,6 +178,23 @@ class TestEModel(unittest.TestCase):
         ivect = mod1.get("I")
 
 
+    def test_aggregates(self):
+
+        mod1 = EModel(test_path("data/9_EDITNNC.INIT"))
+
+        mod1.add_filter("EQLNUM","eq", 1);
+        mod1.add_filter("DEPTH","lt", 2645.21);
+
+        porv = mod1.get("PORV")
+        ind = mod1.active_indices()
+
+        self.assertEqual(len(ind), len(porv))
+        self.assertAlmostEqual(mod1.sum("PORV"), sum(porv), delta = 1.0e-5 * sum(porv))
+        self.assertEqual(mod1.sum("EQLNUM"), len(porv))
+
+        self.assertTrue(mod1.hc_pore_volume() < mod1.sum("PORV"))
+
+
 if __name__ == "__main__":
 
     unittest.main()
@@ -1,4 +1,5 @@
 import datetime
+import math
 import unittest
 
 import opm.io.sim
@@ -44,3 +45,26 @@ class TestSummaryState(unittest.TestCase):
         self.assertTrue( "OP3" in wells )
 
         el = st.elapsed()
+
+    def test_var_arrays(self):
+        st = opm.io.sim.SummaryState(int(datetime.datetime.now().timestamp()))
+        st.update_well_var("OP1", "WOPR", 100)
+        st.update_well_var("OP2", "WOPR", 200)
+        st.update_well_var("OP3", "WWPR", 300)
+        st.update_group_var("G1", "GOPR", 10)
+
+        wopr = st.well_var_array("WOPR", ["OP2", "OP1", "OP3"])
+        self.assertEqual(len(wopr), 3)
+        self.assertEqual(wopr[0], 200)
+        self.assertEqual(wopr[1], 100)
+        self.assertTrue(math.isnan(wopr[2]))
+
+        wopr = st.well_var_array("WOPR")
+        self.assertEqual(len(wopr), len(st.wells))
+        for well, value in zip(st.wells, wopr):
+            if st.has_well_var(well, "WOPR"):
+                self.assertEqual(value, st.well_var(well, "WOPR"))
+
+        gopr = st.group_var_array("GOPR", ["G1", "G2"])
+        self.assertEqual(gopr[0], 10)
+        self.assertTrue(math.isnan(gopr[1]))
@@ -0,0 +1,301 @@
+/*
+   Copyright 2024 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include "EclArrayStream.hpp"
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/ERst.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace {
+
+struct ArrayRecord {
+    std::string name;
+    Opm::EclIO::eclArrType type;
+    int elementSize;
+
+    std::variant<std::monostate,
+                 std::vector<int>,
+                 std::vector<float>,
+                 std::vector<double>,
+                 std::vector<bool>,
+                 std::vector<std::string>> data;
+
+    std::size_t bytes;
+};
+
+template <typename T>
+std::size_t byteSize(const std::vector<T>& data)
+{
+    return data.size() * sizeof(T);
+}
+
+std::size_t byteSize(const std::vector<bool>& data)
+{
+    return data.size() / 8;
+}
+
+std::size_t byteSize(const std::vector<std::string>& data)
+{
+    return std::accumulate(data.begin(), data.end(), data.size() * sizeof(std::string),
+                           [](const std::size_t sum, const std::string& s) { return sum + s.capacity(); });
+}
+
+template <typename T>
+void assignData(Opm::EclIO::EclFile& input, const int arrIndex, ArrayRecord& record)
+{
+    auto data = input.release<T>(arrIndex);
+
+    record.bytes = byteSize(data);
+    record.data = std::move(data);
+}
+
+ArrayRecord readArray(Opm::EclIO::EclFile& input,
+                      const std::vector<Opm::EclIO::EclFile::EclEntry>& arrayList,
+                      const int arrIndex)
+{
+    using namespace Opm::EclIO;
+
+    const auto& entry = arrayList[arrIndex];
+
+    ArrayRecord record { std::get<0>(entry), std::get<1>(entry),
+                         input.getElementSizeList()[arrIndex], {}, 0 };
+
+    switch (record.type) {
+    case INTE:
+        assignData<int>(input, arrIndex, record);
+        break;
+    case REAL:
+        assignData<float>(input, arrIndex, record);
+        break;
+    case DOUB:
+        assignData<double>(input, arrIndex, record);
+        break;
+    case LOGI:
+        assignData<bool>(input, arrIndex, record);
+        break;
+    case CHAR:
+    case C0NN:
+        assignData<std::string>(input, arrIndex, record);
+        break;
+    case MESS:
+        input.clearData(arrIndex);
+        break;
+    default:
+        OPM_THROW(std::runtime_error, "Unknown array type for array " + record.name);
+    }
+
+    return record;
+}
+
+void writeArray(const ArrayRecord& record, Opm::EclIO::EclOutput& output)
+{
+    using namespace Opm::EclIO;
+
+    switch (record.type) {
+    case INTE:
+        output.write(record.name, std::get<std::vector<int>>(record.data));
+        break;
+    case REAL:
+        output.write(record.name, std::get<std::vector<float>>(record.data));
+        break;
+    case DOUB:
+        output.write(record.name, std::get<std::vector<double>>(record.data));
+        break;
+    case LOGI:
+        output.write(record.name, std::get<std::vector<bool>>(record.data));
+        break;
+    case CHAR:
+        output.write(record.name, std::get<std::vector<std::string>>(record.data));
+        break;
+    case C0NN:
+        output.write(record.name, std::get<std::vector<std::string>>(record.data), record.elementSize);
+        break;
+    case MESS:
+        output.message(record.name);
+        break;
+    default:
+        break;
+    }
+}
+
+} // Anonymous namespace
+
+EclArrayStream::EclArrayStream(Opm::EclIO::EclFile& input, std::size_t maxBufferedBytes)
+    : input_(input)
+    , maxBufferedBytes_(maxBufferedBytes)
+{}
+
+void EclArrayStream::copy(const std::vector<int>& arrayIndices, Opm::EclIO::EclOutput& output)
+{
+    std::mutex mutex;
+    std::condition_variable queueChanged;
+    std::deque<ArrayRecord> queue;
+    std::size_t bufferedBytes = 0;
+    bool readerDone = false;
+    bool writerDone = false;
+    std::exception_ptr readerFailure;
+
+    const auto arrayList = this->input_.getList();
+
+    std::thread reader([&]() {
+        try {
+            for (const auto arrIndex : arrayIndices) {
+                auto record = readArray(this->input_, arrayList, arrIndex);
+
+                std::unique_lock<std::mutex> lock(mutex);
+                queueChanged.wait(lock, [&]() {
+                    return writerDone || queue.empty() ||
+                        (bufferedBytes + record.bytes <= this->maxBufferedBytes_);
+                });
+
+                if (writerDone) {
+                    break;
+                }
+
+                bufferedBytes += record.bytes;
+                queue.push_back(std::move(record));
+                queueChanged.notify_all();
+            }
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            readerFailure = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        readerDone = true;
+        queueChanged.notify_all();
+    });
+
+    try {
+        while (true) {
+            ArrayRecord record;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                queueChanged.wait(lock, [&]() { return readerDone || !queue.empty(); });
+
+                if (queue.empty()) {
+                    break;
+                }
+
+                record = std::move(queue.front());
+                queue.pop_front();
+                bufferedBytes -= record.bytes;
+                queueChanged.notify_all();
+            }
+
+            writeArray(record, output);
+        }
+    }
+    catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            writerDone = true;
+            queueChanged.notify_all();
+        }
+
+        reader.join();
+        throw;
+    }
+
+    reader.join();
+
+    if (readerFailure) {
+        std::rethrow_exception(readerFailure);
+    }
+}
+
+std::vector<int> EclArrayStream::allArrays() const
+{
+    std::vector<int> indices(this->input_.size());
+    std::iota(indices.begin(), indices.end(), 0);
+
+    return indices;
+}
+
+std::vector<int> EclArrayStream::selectArrays(const std::vector<int>& arrayIndices,
+                                              const std::vector<std::string>& names) const
+{
+    if (names.empty()) {
+        return arrayIndices;
+    }
+
+    const auto& arrayNames = this->input_.arrayNames();
+
+    std::vector<int> selected;
+    std::copy_if(arrayIndices.begin(), arrayIndices.end(), std::back_inserter(selected),
+                 [&arrayNames, &names](const int arrIndex)
+                 {
+                     return std::find(names.begin(), names.end(), arrayNames[arrIndex]) != names.end();
+                 });
+
+    return selected;
+}
+
+std::vector<int> EclArrayStream::reportStepArrays(Opm::EclIO::ERst& rst, int reportStepNumber)
+{
+    if (!rst.hasReportStepNumber(reportStepNumber)) {
+        OPM_THROW(std::invalid_argument,
+                  "Restart file doesn't have report step number " + std::to_string(reportStepNumber));
+    }
+
+    // Global arrays of a report step start with its SEQNUM array and are
+    // stored contiguously in the file.
+    const auto& arrayNames = rst.arrayNames();
+
+    int first = -1;
+    for (int arrIndex = 0; arrIndex < static_cast<int>(arrayNames.size()); ++arrIndex) {
+        if ((arrayNames[arrIndex] == "SEQNUM") &&
+            (rst.get<int>(arrIndex).front() == reportStepNumber))
+        {
+            first = arrIndex;
+            break;
+        }
+    }
+
+    if (first < 0) {
+        OPM_THROW(std::invalid_argument,
+                  "SEQNUM array for report step number " + std::to_string(reportStepNumber) + " not found");
+    }
+
+    const auto numArrays = static_cast<int>(rst.listOfRstArrays(reportStepNumber).size());
+
+    std::vector<int> indices(numArrays);
+    std::iota(indices.begin(), indices.end(), first);
+
+    return indices;
+}
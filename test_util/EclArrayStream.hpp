@@ -0,0 +1,67 @@
+/*
+   Copyright 2024 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef ECLARRAYSTREAM_HPP
+#define ECLARRAYSTREAM_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+    class EclFile;
+    class EclOutput;
+    class ERst;
+}} // namespace Opm::EclIO
+
+//! \brief Copy arrays from an ECLIPSE file to an output stream without
+//! loading the whole file into memory.
+//! \details A read-ahead thread loads arrays, in file order, into a queue
+//! whose size is limited by a memory budget. The calling thread writes the
+//! queued arrays in the same order. Arrays larger than the budget are passed
+//! through one at a time. Decoding of formatted input and encoding of
+//! formatted output are themselves parallel (see EclFile and EclOutput).
+class EclArrayStream {
+public:
+    //! \param input File from which to read arrays. Must not be used by
+    //! other threads while copy() runs.
+    //! \param maxBufferedBytes Memory budget of the read-ahead queue.
+    EclArrayStream(Opm::EclIO::EclFile& input, std::size_t maxBufferedBytes);
+
+    //! \brief Copy arrays with the given indices, in order, to output.
+    void copy(const std::vector<int>& arrayIndices, Opm::EclIO::EclOutput& output);
+
+    //! \brief Indices of all arrays in input file.
+    std::vector<int> allArrays() const;
+
+    //! \brief Indices of arrays whose names are in the list of names.
+    //! \details An empty list of names selects all arrays.
+    std::vector<int> selectArrays(const std::vector<int>& arrayIndices,
+                                  const std::vector<std::string>& names) const;
+
+    //! \brief Indices of the global arrays of a report step in a unified
+    //! restart file.
+    static std::vector<int> reportStepArrays(Opm::EclIO::ERst& rst, int reportStepNumber);
+
+private:
+    Opm::EclIO::EclFile& input_;
+    std::size_t maxBufferedBytes_;
+};
+
+#endif // ECLARRAYSTREAM_HPP
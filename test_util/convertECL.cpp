@@ -4,115 +4,34 @@
 #include <tuple>
 #include <getopt.h>
 #include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/ERst.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 
-using namespace Opm::EclIO;
-using EclEntry = EclFile::EclEntry;
+#include "EclArrayStream.hpp"
 
-template <typename T>
-void write(EclOutput& outFile, EclFile& file1,
-           const std::string& name, int index)
-{
-    auto vect = file1.get<T>(index);
-    outFile.write(name, vect);
-}
-
-
-template<typename T>
-void write(EclOutput& outFile, ERst& file1,
-           const std::string& name, int index, int reportStepNumber)
-{
-    auto vect = file1.getRestartData<T>(index, reportStepNumber);
-    outFile.write(name, vect);
-}
+using namespace Opm::EclIO;
 
-template<typename T>
-void write(EclOutput& outFile, ERst& file1,
-           const std::string& name, int index)
+static std::vector<std::string> splitList(const std::string& list)
 {
-    auto vect = file1.get<T>(index);
-    outFile.write(name, vect);
-}
+    std::vector<std::string> items;
+    std::stringstream ss(list);
+    std::string item;
 
-
-template <typename T>
-void writeArray(std::string name, eclArrType arrType, T& file1, int index, EclOutput& outFile) {
-
-    if (arrType == INTE) {
-        write<int>(outFile, file1, name, index);
-    } else if (arrType == REAL) {
-        write<float>(outFile, file1, name,index);
-    } else if (arrType == DOUB) {
-        write<double>(outFile, file1, name, index);
-    } else if (arrType == LOGI) {
-        write<bool>(outFile, file1, name, index);
-    } else if (arrType == CHAR) {
-        write<std::string>(outFile, file1, name, index);
-    } else if (arrType == C0NN) {
-        write<std::string>(outFile, file1, name, index);
-    } else if (arrType == MESS) {
-        outFile.message(name);
-    } else {
-        std::cout << "unknown array type " << std::endl;
-        exit(1);
-    }
-}
-
-
-template <typename T>
-void writeArray(std::string name, eclArrType arrType, T& file1, int index, int reportStepNumber, EclOutput& outFile) {
-
-    if (arrType == INTE) {
-        write<int>(outFile, file1, name, index, reportStepNumber);
-    } else if (arrType == REAL) {
-        write<float>(outFile, file1, name, index, reportStepNumber);
-    } else if (arrType == DOUB) {
-        write<double>(outFile, file1, name, index, reportStepNumber);
-    } else if (arrType == LOGI) {
-        write<bool>(outFile, file1, name, index, reportStepNumber);
-    } else if (arrType == CHAR) {
-        write<std::string>(outFile, file1, name, index, reportStepNumber);
-    } else if (arrType == MESS) {
-        outFile.message(name);
-    } else {
-        std::cout << "unknown array type " << std::endl;
-        exit(1);
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
     }
-}
-
 
-void writeC0nnArray(std::string name, int elementSize, EclFile& file1, int index, EclOutput& outFile)
-{
-    auto vect = file1.get<std::string>(index);
-    outFile.write(name, vect, elementSize);
+    return items;
 }
 
 
-void writeArrayList(std::vector<EclEntry>& arrayList, std::vector<int>& elementSizeList, EclFile file1, EclOutput& outFile) {
-
-    for (size_t index = 0; index < arrayList.size(); index++) {
-        std::string name = std::get<0>(arrayList[index]);
-        eclArrType arrType = std::get<1>(arrayList[index]);
-
-        if (arrType == Opm::EclIO::C0NN){
-            writeC0nnArray(name, elementSizeList[index], file1, index, outFile);
-        } else
-            writeArray(name, arrType, file1, index, outFile);
-    }
-}
-
-void writeArrayList(std::vector<EclEntry>& arrayList, ERst file1, int reportStepNumber, EclOutput& outFile) {
-
-    for (size_t index = 0; index < arrayList.size(); index++) {
-        std::string name = std::get<0>(arrayList[index]);
-        eclArrType arrType = std::get<1>(arrayList[index]);
-        writeArray(name, arrType, file1, index , reportStepNumber, outFile);
-    }
-}
-
 static void printHelp() {
 
     std::cout << "\nconvertECL needs one argument which is the input file to be converted. If this is a binary file the output file will be formatted. If the input file is formatted the output will be binary. \n"
@@ -122,7 +41,9 @@ static void printHelp() {
               << "-g Convert file to grdecl format.\n"
               << "-o Specify output file name (only valid with grdecl option).\n"
               << "-i Enforce IX standard on output file.\n"
-              << "-r Extract and convert a specific report time step number from a unified restart file. \n\n";
+              << "-r Extract and convert specific report time step numbers from a unified restart file. Comma separated list, e.g. -r 10,20,30.\n"
+              << "-k Extract and convert only arrays with the given names. Comma separated list, e.g. -k PRESSURE,SWAT.\n"
+              << "-m Maximum size in MB of arrays read ahead of output (default 1024).\n\n";
 }
 
 
@@ -214,7 +135,9 @@ void open_grdecl_output(const std::string& output_fname, const std::string& inpu
 int main(int argc, char **argv) {
 
     int c                          = 0;
-    int reportStepNumber           = -1;
+    std::vector<int> reportStepNumbers;
+    std::vector<std::string> arrayNames;
+    std::size_t maxBufferedMB      = 1024;
     bool specificReportStepNumber  = false;
     bool listProperties            = false;
     bool enforce_ix_output         = false;
@@ -230,7 +153,7 @@ int main(int argc, char **argv) {
     std::string output_fname;
 
 
-    while ((c = getopt(argc, argv, "hr:ligo:")) != -1) {
+    while ((c = getopt(argc, argv, "hr:k:m:ligo:")) != -1) {
         switch (c) {
         case 'h':
             printHelp();
@@ -246,7 +169,15 @@ int main(int argc, char **argv) {
             break;
         case 'r':
             specificReportStepNumber=true;
-            reportStepNumber = atoi(optarg);
+            for (const auto& step : splitList(optarg)) {
+                reportStepNumbers.push_back(std::stoi(step));
+            }
+            break;
+        case 'k':
+            arrayNames = splitList(optarg);
+            break;
+        case 'm':
+            maxBufferedMB = std::stoul(optarg);
             break;
         case 'o':
             output_fname = optarg;
@@ -281,28 +212,29 @@ int main(int argc, char **argv) {
     if (to_grdecl) {
     
         auto array_list = file1.getList();
-        file1.loadData();
 
         auto start_g = std::chrono::system_clock::now();
 
         std::ofstream ofileH;
         open_grdecl_output(output_fname, filename, ofileH);
 
-        for (size_t n = 0; n < array_list.size(); n ++) {
+        EclArrayStream stream(file1, maxBufferedMB * 1024 * 1024);
+
+        for (const int n : stream.selectArrays(stream.allArrays(), arrayNames)) {
             std::string name = std::get<0>(array_list[n]);
             auto arr_type = std::get<1>(array_list[n]);
 
             if (arr_type == Opm::EclIO::REAL) {
-                auto  data = file1.get<float>(n);
+                auto  data = file1.release<float>(n);
                 writeGrdeclData(ofileH, name, data);
              } else if (arr_type == Opm::EclIO::DOUB) {
-                auto  data = file1.get<double>(n);
+                auto  data = file1.release<double>(n);
                 writeGrdeclData(ofileH, name, data);
             } else if (arr_type == Opm::EclIO::INTE) {
-                auto  data = file1.get<int>(n);
+                auto  data = file1.release<int>(n);
                 writeGrdeclData(ofileH, name, data);
             } else if (arr_type == Opm::EclIO::CHAR) {
-                auto  data = file1.get<std::string>(n);
+                auto  data = file1.release<std::string>(n);
                 writeGrdeclData(ofileH, name, data);
             } else if (arr_type == Opm::EclIO::LOGI) {
                 std::cout << "\n!Warning, skipping array '" << name << " of type LOGI \n";
@@ -312,6 +244,8 @@ int main(int argc, char **argv) {
                 std::cout << "unknown data type for array " << name << std::endl;
                 exit(1);
             }
+
+            file1.clearData(n);
         }
 
         auto end_g = std::chrono::system_clock::now();
@@ -391,6 +325,9 @@ int main(int argc, char **argv) {
         outFile.set_ix();
     }
 
+    EclArrayStream stream(file1, maxBufferedMB * 1024 * 1024);
+    std::vector<int> arrayIndices;
+
     if (specificReportStepNumber) {
 
         if (extension!=".UNRST") {
@@ -400,25 +337,22 @@ int main(int argc, char **argv) {
 
         ERst rst1(filename);
 
-        if (!rst1.hasReportStepNumber(reportStepNumber)) {
-            std::cout << "\n!ERROR, selected unified restart file doesn't have report step number " << reportStepNumber << "\n" << std::endl;
-            exit(1);
-        }
-
-        rst1.loadReportStepNumber(reportStepNumber);
-
-        auto arrayList = rst1.listOfRstArrays(reportStepNumber);
+        for (auto reportStepNumber : reportStepNumbers) {
+            if (!rst1.hasReportStepNumber(reportStepNumber)) {
+                std::cout << "\n!ERROR, selected unified restart file doesn't have report step number " << reportStepNumber << "\n" << std::endl;
+                exit(1);
+            }
 
-        writeArrayList(arrayList, rst1, reportStepNumber, outFile);
+            auto stepArrays = EclArrayStream::reportStepArrays(rst1, reportStepNumber);
+            arrayIndices.insert(arrayIndices.end(), stepArrays.begin(), stepArrays.end());
+        }
 
     } else {
-
-        file1.loadData();
-        auto arrayList = file1.getList();
-        std::vector<int> elementSizeList = file1.getElementSizeList();
-        writeArrayList(arrayList, elementSizeList, file1, outFile);
+        arrayIndices = stream.allArrays();
     }
 
+    stream.copy(stream.selectArrays(arrayIndices, arrayNames), outFile);
+
     auto end = std::chrono::system_clock::now();
     std::chrono::duration<double> elapsed_seconds = end-start;
 
@@ -28,6 +28,8 @@
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 
+#include "EclArrayStream.hpp"
+
 
 static void printHelp() {
 
@@ -53,7 +55,6 @@ int main(int argc, char **argv) {
     int argOffset = optind;
 
     Opm::EclIO::EclFile reffile(argv[argOffset]);
-    auto arrayList = reffile.getList();
 
     std::string outputFile=std::string(argv[argOffset]);
 
@@ -66,37 +67,8 @@ int main(int argc, char **argv) {
     if (reffile.is_ix())
         outFile.set_ix();
 
-    reffile.loadData();
-
-    std::vector<int> elementSizeList = reffile.getElementSizeList();
-
-    for (size_t n = 0; n < arrayList.size(); n++){
-
-        std::string name = std::get<0>(arrayList[n]);
-        auto arrType = std::get<1>(arrayList[n]);
-
-        if (arrType == Opm::EclIO::INTE) {
-            auto data = reffile.get<int>(n);
-            outFile.write(name, data);
-        } else if (arrType == Opm::EclIO::CHAR) {
-            auto data = reffile.get<std::string>(n);
-            outFile.write(name, data);
-        } else if (arrType == Opm::EclIO::C0NN) {
-            auto data = reffile.get<std::string>(n);
-            outFile.write(name, data, elementSizeList[n]);
-        } else if (arrType == Opm::EclIO::REAL) {
-            auto data = reffile.get<float>(n);
-            outFile.write(name, data);
-        } else if (arrType == Opm::EclIO::DOUB) {
-            auto data = reffile.get<double>(n);
-            outFile.write(name, data);
-        } else if (arrType == Opm::EclIO::LOGI) {
-            auto data = reffile.get<bool>(n);
-            outFile.write(name, data);
-        } else if (arrType == Opm::EclIO::MESS) {
-            outFile.message(name);
-        }
-    }
+    EclArrayStream stream(reffile, 1024 * 1024 * 1024);
+    stream.copy(stream.allArrays(), outFile);
 
     return 0;
 }
@@ -37,10 +37,17 @@
 #include <opm/material/common/UniformXTabulated2DFunction.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 #include <opm/material/common/IntervalTabulated2DFunction.hpp>
+#include <opm/material/common/PiecewiseUniformTabulated2DFunction.hpp>
 
 #include <memory>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <sstream>
+#include <vector>
 
 template <class ScalarT>
 struct Test
@@ -335,6 +342,186 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(UniformXTabulatedFunction2, Scalar, Types)
                                     1e-2);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(UniformXTabulatedFunctionSegments, Scalar, Types)
+{
+    Test<Scalar> test;
+    auto uniformXTab = test.createUniformXTabulatedFunction2(test.testFn3);
+
+    // the y segment must bracket the y value, whether or not the line is
+    // sampled uniformly
+    for (unsigned i = 0; i < uniformXTab.numX(); ++i) {
+        const unsigned n = uniformXTab.numY(i);
+        for (unsigned k = 0; k <= 10*n; ++k) {
+            Scalar y = -4.0 + Scalar(k)/(10*n) * 9.0;
+            unsigned j = uniformXTab.ySegmentIndex(y, i);
+            BOOST_REQUIRE(j + 1 < n);
+            if (j > 0) {
+                BOOST_CHECK(uniformXTab.yAt(i, j) <= y);
+            }
+            if (j + 2 < n) {
+                BOOST_CHECK(y <= uniformXTab.yAt(i, j + 1));
+            }
+        }
+    }
+
+    // a table rebuilt from the sampling points is identical
+    Opm::UniformXTabulated2DFunction<Scalar> copy(uniformXTab.xPos(),
+                                                  uniformXTab.yPos(),
+                                                  uniformXTab.toSamplePoints(),
+                                                  uniformXTab.interpolationGuide());
+    BOOST_CHECK(copy == uniformXTab);
+
+    // batched evaluation gives the same values as point-wise evaluation
+    std::vector<Scalar> x, y, values;
+    for (unsigned k = 0; k <= 100; ++k) {
+        x.push_back(-2.0 + Scalar(k)/100 * 5.0);
+        y.push_back(-4.0 + Scalar((k*37) % 101)/100 * 9.0);
+    }
+    uniformXTab.eval(x, y, values);
+    BOOST_REQUIRE_EQUAL(values.size(), x.size());
+    for (std::size_t k = 0; k < x.size(); ++k) {
+        BOOST_CHECK_EQUAL(values[k], uniformXTab.eval(x[k], y[k]));
+    }
+
+    // ... also for repeated and unsorted x values
+    for (unsigned k = 0; k <= 100; ++k) {
+        x[k] = -2.0 + Scalar((k/4*13) % 26)/25 * 5.0;
+    }
+    uniformXTab.eval(x, y, values);
+    for (std::size_t k = 0; k < x.size(); ++k) {
+        BOOST_CHECK_EQUAL(values[k], uniformXTab.eval(x[k], y[k]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(PiecewiseUniformTabulatedFunction, Scalar, Types)
+{
+    using Table = Opm::PiecewiseUniformTabulated2DFunction<Scalar>;
+    using Axis = typename Table::Axis;
+
+    Test<Scalar> test;
+
+    // refine the axes locally, with overlapping refinement ranges on the y axis
+    const auto xAxis = Axis::refined(-2.0, 3.0, 25, {{0.0, 1.0, 8}});
+    const auto yAxis = Axis::refined(-4.0, 5.0, 30, {{-1.0, 2.0, 4}, {0.0, 1.0, 16}});
+    BOOST_CHECK_EQUAL(xAxis.numPoints(), 20u*1 + 5u*8 + 1);
+    BOOST_CHECK_EQUAL(yAxis.numPoints(), 20u + 6u*4 + 4u*16 + 1);
+    BOOST_CHECK_EQUAL(xAxis.pointAt(0), Scalar(-2.0));
+    BOOST_CHECK_EQUAL(xAxis.pointAt(xAxis.numPoints() - 1), Scalar(3.0));
+
+    // the cell index brackets the position and agrees with a search over the
+    // sampling points
+    for (const auto* axis : {&xAxis, &yAxis}) {
+        const unsigned n = axis->numPoints();
+        for (unsigned k = 0; k <= 10*n; ++k) {
+            const Scalar x = axis->min() + Scalar(k)/(10*n) * (axis->max() - axis->min());
+            Scalar alpha;
+            const unsigned i = axis->cellIndex(x, alpha);
+            BOOST_REQUIRE(i + 1 < n);
+
+            unsigned expected = 0;
+            while (expected + 2 < n && axis->pointAt(expected + 1) <= x)
+                ++expected;
+            BOOST_CHECK_MESSAGE(i == expected || (i + 1 == expected && alpha >= 1 - 1e-3),
+                                "cellIndex(" << x << ") = " << i << ", expected " << expected);
+            BOOST_CHECK(alpha >= -1e-3 && alpha <= 1 + 1e-3);
+        }
+
+        // positions outside of the axis map to the boundary cells
+        Scalar alpha;
+        BOOST_CHECK_EQUAL(axis->cellIndex(axis->min() - 1, alpha), 0u);
+        BOOST_CHECK(alpha < 0);
+        BOOST_CHECK_EQUAL(axis->cellIndex(axis->max() + 1, alpha), n - 2);
+        BOOST_CHECK(alpha > 1);
+    }
+
+    // x*y is reproduced by bi-linear interpolation
+    const Table table(xAxis, yAxis, test.testFn3);
+    test.compareTableWithAnalyticFn(table,
+                                    -2.0, 3.0, 100,
+                                    -4.0, 5.0, 100,
+                                    test.testFn3,
+                                    1e-4);
+
+    // a table converted from a uniform table evaluates to the same values
+    const auto uniformTab = test.createUniformTabulatedFunction(test.testFn3);
+    const Table converted(uniformTab);
+    BOOST_CHECK_EQUAL(converted.numX(), uniformTab.numX());
+    BOOST_CHECK_EQUAL(converted.numY(), uniformTab.numY());
+    for (unsigned k = 0; k <= 100; ++k) {
+        const Scalar x = -2.0 + Scalar(k)/100 * 5.0;
+        const Scalar y = -1/2.0 + Scalar((k*37) % 101)/100 * (1/3.0 + 1/2.0);
+        BOOST_CHECK_SMALL(converted.eval(x, y, false) - uniformTab.eval(x, y, false), Scalar(1e-5));
+    }
+
+    // binary round trip
+    std::stringstream ss;
+    table.writeBinary(ss);
+    BOOST_CHECK(Table::readBinary(ss) == table);
+
+    std::stringstream truncated(ss.str().substr(0, ss.str().size() / 2));
+    BOOST_CHECK_THROW(Table::readBinary(truncated), std::runtime_error);
+
+    std::stringstream garbage("not a table");
+    BOOST_CHECK_THROW(Table::readBinary(garbage), std::runtime_error);
+
+    // corrupt cell counts of the x axis: the header is followed by the break points
+    // and then the cell counts of each segment
+    const auto corruptNumCells = [&ss, &xAxis](std::initializer_list<std::uint32_t> numCells)
+    {
+        std::string data = ss.str();
+        std::size_t offset = sizeof(std::uint64_t) + 2*sizeof(std::uint32_t)
+                           + sizeof(std::uint64_t) + xAxis.breakPoints().size()*sizeof(Scalar)
+                           + sizeof(std::uint64_t);
+        for (const auto n : numCells) {
+            std::memcpy(&data[offset], &n, sizeof(n));
+            offset += sizeof(n);
+        }
+        return std::stringstream(data);
+    };
+
+    // the total number of points does not fit into an unsigned
+    auto overflow = corruptNumCells({0x80000000u, 0x80000000u});
+    BOOST_CHECK_THROW(Table::readBinary(overflow), std::runtime_error);
+
+    // the number of points is valid, but the table would be too large
+    auto tooLarge = corruptNumCells({0xFFFF0000u});
+    BOOST_CHECK_THROW(Table::readBinary(tooLarge), std::runtime_error);
+
+    auto zero = corruptNumCells({0u});
+    BOOST_CHECK_THROW(Table::readBinary(zero), std::runtime_error);
+
+    // binary round trip through a file
+    const std::string fileName = "piecewise_uniform_table.bin";
+    {
+        std::ofstream os(fileName, std::ios::binary);
+        table.writeBinary(os);
+    }
+    BOOST_CHECK(Table::readBinaryFile(fileName) == table);
+    std::remove(fileName.c_str());
+    BOOST_CHECK_THROW(Table::readBinaryFile(fileName), std::runtime_error);
+
+    // many segments which are much shorter than the range of the axis
+    std::vector<Scalar> breakPoints;
+    std::vector<unsigned> numCells;
+    for (unsigned k = 0; k < 200; ++k) {
+        breakPoints.push_back(k*Scalar(5e-6));
+        numCells.push_back(1 + k % 3);
+    }
+    breakPoints.push_back(1.0);
+    numCells.push_back(10);
+    breakPoints.push_back(2.0);
+
+    const Axis fineAxis(breakPoints, numCells);
+    for (unsigned k = 0; k <= 4000; ++k) {
+        const Scalar x = (k < 2000) ? k*Scalar(1e-3)/2000 : Scalar(k - 2000)/1000;
+        Scalar alpha;
+        const unsigned i = fineAxis.cellIndex(x, alpha);
+        BOOST_REQUIRE(i + 1 < fineAxis.numPoints());
+        BOOST_CHECK_MESSAGE(alpha >= -1e-3 && alpha <= 1 + 1e-3,
+                            "cellIndex(" << x << ") = " << i << ", alpha = " << alpha);
+    }
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(IntervalTabulatedFunction1, Scalar, Types)
 {
     Test<Scalar> test;
@@ -70,10 +70,15 @@
 #include <opm/material/components/C10.hpp>
 #include <opm/material/components/H2.hpp>
 
+#include <opm/material/common/PiecewiseUniformTabulated2DFunction.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 
 #include <opm/json/JsonObject.hpp>
 
+#include <cstdio>
+#include <fstream>
+#include <string>
+
 template <class Scalar, class Evaluation>
 void testAllComponents()
 {
@@ -773,3 +778,61 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(H2Class, Scalar, Types)
         }
     }
 }
+
+template <class Component>
+void checkLoadedTables(const std::string& prefix,
+                       double tMin, double tMax, double pMin, double pMax)
+{
+    using Scalar = typename Component::Scalar;
+    using Evaluation = Opm::DenseAd::Evaluation<Scalar, 2>;
+    using Table = Opm::PiecewiseUniformTabulated2DFunction<double>;
+
+    // sample the built-in tables, with a finer resolution close to the lower end
+    const auto tAxis = Table::Axis::refined(tMin, tMax, 20, {{tMin, tMin + (tMax - tMin)/4, 4}});
+    const auto pAxis = Table::Axis::refined(pMin, pMax, 20, {{pMin, pMin + (pMax - pMin)/4, 4}});
+    const Table enthalpy(tAxis, pAxis, [](double T, double p)
+                         { return Component::gasEnthalpy(T, p, true); });
+    const Table density(tAxis, pAxis, [](double T, double p)
+                        { return Component::gasDensity(T, p, true); });
+
+    const Scalar midT = (tMin + tMax)/2;
+    const Scalar midP = (pMin + pMax)/2;
+    const Scalar builtInDensity = Component::gasDensity(midT, midP);
+
+    const std::string enthalpyFile = prefix + "_enthalpy.bin";
+    const std::string densityFile = prefix + "_density.bin";
+    {
+        std::ofstream os(enthalpyFile, std::ios::binary);
+        enthalpy.writeBinary(os);
+    }
+    {
+        std::ofstream os(densityFile, std::ios::binary);
+        density.writeBinary(os);
+    }
+
+    BOOST_CHECK_THROW(Component::loadTables(enthalpyFile, "missing.bin"), std::runtime_error);
+    Component::loadTables(enthalpyFile, densityFile);
+    std::remove(enthalpyFile.c_str());
+    std::remove(densityFile.c_str());
+
+    for (unsigned k = 0; k <= 50; ++k) {
+        const Evaluation T(tMin + k*(tMax - tMin)/50, 0);
+        const Evaluation p(pMin + ((k*37) % 51)*(pMax - pMin)/50, 1);
+
+        const Evaluation h = Component::gasEnthalpy(T, p);
+        const Evaluation rho = Component::gasDensity(T, p);
+        BOOST_CHECK_CLOSE(h.value(), enthalpy.eval(T.value(), p.value(), false), 1e-3);
+        BOOST_CHECK_CLOSE(rho.value(), density.eval(T.value(), p.value(), false), 1e-3);
+        BOOST_CHECK(std::isfinite(h.derivative(0)) && std::isfinite(h.derivative(1)));
+    }
+
+    // the built-in tables are used again after a reset
+    Component::resetTables();
+    BOOST_CHECK_EQUAL(Component::gasDensity(midT, midP), builtInDensity);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(LoadedTables, Scalar, Types)
+{
+    checkLoadedTables<Opm::CO2<Scalar>>("co2", 290.0, 340.0, 1e6, 3e7);
+    checkLoadedTables<Opm::H2<Scalar>>("h2", 290.0, 340.0, 1e6, 3e7);
+}
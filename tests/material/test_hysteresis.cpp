@@ -2182,4 +2182,71 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(HysteresisKilloughWetting3phaseBaker, Scalar, Type
             BOOST_CHECK_CLOSE(kr_restart[phaseIdx], kr[phaseIdx], tol);
         }
     }
-}
\ No newline at end of file
+}
+BOOST_AUTO_TEST_CASE_TEMPLATE(HysteresisBatchedUpdate, Scalar, Types)
+{
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    using FluidState = typename Fixture<Scalar>::FluidState;
+
+    Opm::Parser parser;
+
+    const auto deck = parser.parseString(hysterDeckStringKillough3pBakerWetting);
+    const Opm::EclipseState eclState(deck);
+
+    const auto& eclGrid = eclState.getInputGrid();
+    std::size_t n = eclGrid.getCartesianSize();
+
+    MaterialLawManager single;
+    single.initFromState(eclState);
+    single.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    MaterialLawManager batched;
+    batched.initFromState(eclState);
+    batched.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    // Drainage, imbibition and partial drainage again.
+    std::vector<Scalar> sgPath;
+    for (int i = 0; i <= 60; ++i)
+        sgPath.push_back(Scalar(i) / 100);
+    for (int i = 60; i >= 10; --i)
+        sgPath.push_back(Scalar(i) / 100);
+    for (int i = 10; i <= 40; ++i)
+        sgPath.push_back(Scalar(i) / 100);
+
+    const Scalar Sw = 0.12;
+    const Scalar tol = 1e-10;
+    std::vector<unsigned char> changed(n);
+
+    for (const auto Sg : sgPath) {
+        FluidState fs;
+        fs.setSaturation(Fixture<Scalar>::waterPhaseIdx, Sw);
+        fs.setSaturation(Fixture<Scalar>::oilPhaseIdx, 1 - Sw - Sg);
+        fs.setSaturation(Fixture<Scalar>::gasPhaseIdx, Sg);
+
+        std::vector<unsigned char> expectChanged(n);
+        std::size_t expectNumChanged = 0;
+        for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+            expectChanged[elemIdx] = single.updateHysteresis(fs, elemIdx);
+            expectNumChanged += expectChanged[elemIdx];
+        }
+
+        const auto numChanged =
+            batched.updateHysteresis(0, n, [&fs](unsigned) -> const FluidState& { return fs; }, &changed);
+
+        BOOST_CHECK_EQUAL(numChanged, expectNumChanged);
+
+        for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+            Scalar sgmax, shmax, somin, sgmax2, shmax2, somin2;
+            single.gasOilHysteresisParams(sgmax, shmax, somin, elemIdx);
+            batched.gasOilHysteresisParams(sgmax2, shmax2, somin2, elemIdx);
+
+            BOOST_CHECK_CLOSE(sgmax, sgmax2, tol);
+            BOOST_CHECK_CLOSE(shmax, shmax2, tol);
+            BOOST_CHECK_CLOSE(somin, somin2, tol);
+            BOOST_CHECK_EQUAL(changed[elemIdx], expectChanged[elemIdx]);
+        }
+    }
+
+    // Empty range
+    BOOST_CHECK_EQUAL(batched.updateHysteresis(0, 0, [](unsigned) -> FluidState { return {}; }), 0U);
+}
@@ -0,0 +1,54 @@
+def wconprod(well, status):
+	return """
+		WCONPROD
+			'{}' '{}' '{}' {} 4* {} /
+		/
+			""".format(well, status, 'ORAT', 4000, 1000)
+
+def run(ecl_state, schedule, report_step, summary_state, actionx_callback):
+	num_steps = len(schedule)
+	end = schedule.end
+
+	if (report_step == 2):
+		# Insert for the later report step first, the keywords for the earlier
+		# report step must still be applied before the later ones.
+		schedule.insert_keywords(wconprod('P1', 'OPEN'), report_step + 2)
+		schedule.insert_keywords(wconprod('P1', 'SHUT'), report_step + 1)
+
+		# The inserted keywords are visible to the script.
+		if schedule.get_well('P1', report_step + 1).status() != 'SHUT':
+			raise RuntimeError('P1 should be shut at report step {}'.format(report_step + 1))
+		if schedule.get_well('P1', report_step + 2).status() != 'OPEN':
+			raise RuntimeError('P1 should be open at report step {}'.format(report_step + 2))
+
+		# Errors in inserted keywords are raised from the insert call.
+		try:
+			schedule.insert_keywords("""
+			PORO
+			    300*0.1 /
+			""", report_step + 1)
+		except Exception:
+			pass
+		else:
+			raise RuntimeError('Inserting PORO should fail')
+
+		# Reading the schedule after an insert sees all report steps.
+		if len(schedule) != num_steps:
+			raise RuntimeError('The schedule should have {} report steps'.format(num_steps))
+		if schedule.end != end:
+			raise RuntimeError('The schedule end should be {}'.format(end))
+
+	if (report_step == 5):
+		# Insert for consecutive report steps in ascending order.
+		schedule.insert_keywords(wconprod('P2', 'SHUT'), report_step + 1)
+		schedule.insert_keywords(wconprod('P2', 'OPEN'), report_step + 2)
+		schedule.insert_keywords(wconprod('P2', 'SHUT'), report_step + 3)
+
+		for step, status in [(report_step + 1, 'SHUT'), (report_step + 2, 'OPEN'), (report_step + 3, 'SHUT')]:
+			if schedule.get_well('P2', step).status() != status:
+				raise RuntimeError('P2 should be {} at report step {}'.format(status, step))
+
+		if schedule.end != end:
+			raise RuntimeError('The schedule end should be {}'.format(end))
+		if len(schedule) != num_steps:
+			raise RuntimeError('The schedule should have {} report steps'.format(num_steps))
@@ -532,6 +532,33 @@ BOOST_AUTO_TEST_CASE(MSIM_PYACTION_INSERT_KEYWORD) {
         }
     }
 }
+BOOST_AUTO_TEST_CASE(MSIM_PYACTION_INSERT_KEYWORD_MULTI_STEP) {
+    const auto& deck = Parser().parseFile("msim/MSIM_PYACTION_INSERT_KEYWORD_MULTI_STEP.DATA");
+    test_data td( deck );
+    msim sim(td.state, td.schedule);
+    {
+        WorkArea work_area("test_msim");
+        EclipseIO io(td.state, td.state.getInputGrid(), sim.schedule, td.summary_config);
+        const auto num_steps = sim.schedule.size();
+
+        // The script checks that it reads back its own inserts and that it
+        // can catch the error from an invalid insert.
+        sim.run(io, false);
+
+        BOOST_CHECK_EQUAL(sim.schedule.size(), num_steps);
+        BOOST_CHECK(sim.schedule.getWell("P1", 2).getStatus() == Well::Status::OPEN);
+        BOOST_CHECK(sim.schedule.getWell("P1", 3).getStatus() == Well::Status::SHUT);
+        BOOST_CHECK(sim.schedule.getWell("P1", 4).getStatus() == Well::Status::OPEN);
+        BOOST_CHECK(sim.schedule.getWell("P1", num_steps - 1).getStatus() == Well::Status::OPEN);
+
+        // Inserted at report steps 6, 7 and 8 in ascending order.
+        BOOST_CHECK(sim.schedule.getWell("P2", 5).getStatus() == Well::Status::OPEN);
+        BOOST_CHECK(sim.schedule.getWell("P2", 6).getStatus() == Well::Status::SHUT);
+        BOOST_CHECK(sim.schedule.getWell("P2", 7).getStatus() == Well::Status::OPEN);
+        BOOST_CHECK(sim.schedule.getWell("P2", 8).getStatus() == Well::Status::SHUT);
+        BOOST_CHECK(sim.schedule.getWell("P2", num_steps - 1).getStatus() == Well::Status::SHUT);
+    }
+}
 BOOST_AUTO_TEST_CASE(PYTHON_WELL_CLOSE_EXAMPLE) {
     const auto& deck1 = Parser().parseFile("msim/MSIM_PYACTION.DATA");
     const auto& deck2 = Parser().parseFile("msim/MSIM_PYACTION_NO_RUN_FUNCTION.DATA");
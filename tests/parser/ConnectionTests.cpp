@@ -50,6 +50,12 @@
 #include <cstddef>
 #include <stdexcept>
 #include <ostream>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
 
 namespace {
     double cp_rm3_per_db()
@@ -737,3 +743,143 @@ BOOST_AUTO_TEST_CASE(loadCOMPTRAJTESTSPE1) {
          BOOST_CHECK_EQUAL(connections[i].global_index(), global_index[i]);  
     }
 }
+
+namespace {
+
+// Eight vertical trajectory wells, one per column of a 4x2x5 grid, each
+// perforated from 2001 to 2049 m TVD, i.e., in all five layers.  Enough
+// perforations to intersect them concurrently.
+const auto trajectoryWellNames = std::vector<std::string> {
+    "W1", "W2", "W3", "W4", "W5", "W6", "W7", "W8",
+};
+
+std::string trajectoryWellsDeck(const std::string& actnum)
+{
+    std::string weltraj, comptraj, welspecs;
+    for (std::size_t well = 0; well < trajectoryWellNames.size(); ++well) {
+        const auto& name = trajectoryWellNames[well];
+        const auto x = 50.0 + 100.0*(well % 4);
+        const auto y = 50.0 + 100.0*(well / 4);
+
+        welspecs += "'" + name + "' 'G1' " + std::to_string(1 + well % 4) + " "
+            + std::to_string(1 + well / 4) + " 1* 'OIL' /\n";
+        weltraj += "'" + name + "' 1* " + std::to_string(x) + " " + std::to_string(y) + " 1900.0 0.0 /\n";
+        weltraj += "'" + name + "' 1* " + std::to_string(x) + " " + std::to_string(y) + " 2100.0 200.0 /\n";
+        comptraj += "'" + name + "' 1* 101.0 149.0 1* 1* 1* 1* 1* 0.2 1* 0.0 1* /\n";
+    }
+
+    return R"(
+RUNSPEC
+DIMENS
+ 4 2 5 /
+OIL
+WATER
+START
+ 1 JAN 2020 /
+GRID
+DX
+ 40*100 /
+DY
+ 40*100 /
+DZ
+ 40*10 /
+TOPS
+ 8*2000 /
+)" + actnum + R"(
+PORO
+ 40*0.25 /
+PERMX
+ 8*100 8*200 8*300 8*400 8*500 /
+PERMY
+ 8*100 8*200 8*300 8*400 8*500 /
+PERMZ
+ 40*10 /
+SCHEDULE
+WELSPECS
+)" + welspecs + R"(/
+WELTRAJ
+)" + weltraj + R"(/
+COMPTRAJ
+)" + comptraj + R"(/
+)";
+}
+
+Opm::Schedule trajectoryWellsSchedule(const std::string& actnum)
+{
+    const auto deck = Opm::Parser{}.parseString(trajectoryWellsDeck(actnum));
+    const auto state = Opm::EclipseState { deck };
+
+    return { deck, state, std::make_shared<Opm::Python>() };
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(COMPTRAJ_Multiple_Wells_Serial_And_Parallel)
+{
+#ifdef _OPENMP
+    const auto maxThreads = omp_get_max_threads();
+    omp_set_num_threads(1);
+#endif // _OPENMP
+
+    const auto serial = trajectoryWellsSchedule("");
+
+#ifdef _OPENMP
+    omp_set_num_threads(4);
+#endif // _OPENMP
+
+    const auto parallel = trajectoryWellsSchedule("");
+
+#ifdef _OPENMP
+    omp_set_num_threads(maxThreads);
+#endif // _OPENMP
+
+    for (std::size_t well = 0; well < trajectoryWellNames.size(); ++well) {
+        const auto& name = trajectoryWellNames[well];
+        const auto& connections = serial.getWell(name, 0).getConnections();
+
+        // All five layers of the well's own column, top to bottom.
+        const auto length = std::vector<double> { 9.0, 10.0, 10.0, 10.0, 9.0 };
+
+        BOOST_REQUIRE_EQUAL(connections.size(), 5U);
+        for (std::size_t k = 0; k < connections.size(); ++k) {
+            BOOST_CHECK_EQUAL(connections[k].global_index(), well + 8*k);
+            BOOST_CHECK_CLOSE(connections[k].connectionLength(), length[k], 1.0e-6);
+        }
+
+        BOOST_CHECK_MESSAGE(connections == parallel.getWell(name, 0).getConnections(),
+                            "COMPTRAJ connections of well " << name
+                            << " must not depend on the number of threads");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(COMPTRAJ_Inactive_Cells)
+{
+    // Deactivate the third layer of the first well's column.
+    const auto allActive = trajectoryWellsSchedule("");
+    const auto oneInactive = trajectoryWellsSchedule("ACTNUM\n 16*1 0 23*1 /\n");
+
+    const auto& expect = allActive.getWell("W1", 0).getConnections();
+    const auto& connections = oneInactive.getWell("W1", 0).getConnections();
+
+    // The inactive cell is skipped while the intersections of the
+    // remaining cells are unchanged.
+    BOOST_REQUIRE_EQUAL(expect.size(), 5U);
+    BOOST_REQUIRE_EQUAL(connections.size(), 4U);
+
+    const auto expectIndex = std::vector<std::size_t> { 0, 1, 3, 4 };
+    for (std::size_t i = 0; i < connections.size(); ++i) {
+        const auto& expectConn = expect[expectIndex[i]];
+
+        BOOST_CHECK_EQUAL(connections[i].global_index(), expectConn.global_index());
+        BOOST_CHECK_CLOSE(connections[i].CF(), expectConn.CF(), 1.0e-8);
+        BOOST_CHECK_CLOSE(connections[i].connectionLength(), expectConn.connectionLength(), 1.0e-8);
+    }
+
+    // Other wells are unaffected.
+    for (std::size_t well = 1; well < trajectoryWellNames.size(); ++well) {
+        const auto& name = trajectoryWellNames[well];
+        BOOST_CHECK_MESSAGE(oneInactive.getWell(name, 0).getConnections() ==
+                            allActive.getWell(name, 0).getConnections(),
+                            "Connections of well " << name << " must not change");
+    }
+}
@@ -20,6 +20,7 @@
 
 #include <stdexcept>
 #include <sstream>
+#include <vector>
 
 #define BOOST_TEST_MODULE DeckTests
 
@@ -325,6 +326,84 @@ BOOST_AUTO_TEST_CASE(GetSIMultipleDim) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(GetSIMultipleDimWithDefaults) {
+    const auto temperature = Dimension{ 1.0, 273.15 };
+    DeckItem item( "HEI", double(), { Dimension{ 2 }, temperature, Dimension{ 8 } },
+                   { Dimension{ 20 }, Dimension{ 40 }, Dimension{ 80 } } );
+
+    for (int record = 0; record < 5; ++record) {
+        item.push_back( 1.0 );
+        item.push_backDefault( 1.0 );
+        item.push_back( 1.0 );
+        item.push_backDefault( 1.0 );
+        item.push_back( 1.0, 2 );
+    }
+
+    const auto& si = item.getSIDoubleData();
+    BOOST_REQUIRE_EQUAL( si.size(), 30U );
+
+    const std::vector<double> expect = { 2.0, 40.0, 8.0, 20.0, 274.15, 8.0 };
+    for (std::size_t i = 0; i < si.size(); ++i)
+        BOOST_CHECK_EQUAL( si[i], expect[i % expect.size()] );
+}
+
+BOOST_AUTO_TEST_CASE(GetSIAndRawInterleaved) {
+    Dimension dim{ 100 };
+    Dimension defaultDim{ 1000 };
+    DeckItem item( "HEI", double(), { dim }, { defaultDim } );
+
+    item.push_back( 1.0, 3 );
+    item.push_backDefault( 2.0 );
+
+    const auto& si = item.getSIDoubleData();
+    BOOST_CHECK_EQUAL( &si, &item.getSIDoubleData() );
+    BOOST_CHECK_EQUAL( si[0], 100.0 );
+    BOOST_CHECK_EQUAL( si[3], 2000.0 );
+
+    const auto& raw = item.getData< double >();
+    BOOST_CHECK_EQUAL( raw[0], 1.0 );
+    BOOST_CHECK_EQUAL( raw[3], 2.0 );
+    BOOST_CHECK_EQUAL( item.get< double >(0), 1.0 );
+    BOOST_CHECK_EQUAL( item.getSIDouble(0), 100.0 );
+
+    const auto copy = item;
+    BOOST_CHECK_EQUAL( copy.getSIDouble(3), 2000.0 );
+    BOOST_CHECK_EQUAL( copy.getData< double >()[3], 2.0 );
+
+    item.push_back( 3.0 );
+    BOOST_CHECK_EQUAL( item.getSIDoubleData().size(), 5U );
+    BOOST_CHECK_EQUAL( item.getSIDouble(4), 300.0 );
+}
+
+BOOST_AUTO_TEST_CASE(GetSIIdentityDimension) {
+    DeckItem item( "HEI", double(), { Dimension{} }, { Dimension{} } );
+    item.push_back( 0.5, 10 );
+
+    BOOST_CHECK_EQUAL( &item.getSIDoubleData(), &item.getData< double >() );
+    BOOST_CHECK_EQUAL( item.getSIDouble(9), 0.5 );
+}
+
+BOOST_AUTO_TEST_CASE(GetSIConcurrent) {
+    Dimension dim{ 10 };
+    DeckItem item( "HEI", double(), { dim }, { dim } );
+    for (int i = 0; i < 1000; ++i)
+        item.push_back( static_cast<double>(i) );
+
+    // Many concurrent first requests for the SI values of the same item.
+    auto failures = 0;
+#pragma omp parallel for reduction(+:failures)
+    for (int rep = 0; rep < 64; ++rep) {
+        const auto& si = item.getSIDoubleData();
+        const auto& raw = item.getData< double >();
+        for (std::size_t i = 0; i < raw.size(); ++i) {
+            if ((raw[i] != i) || (si[i] != 10.0 * i))
+                ++failures;
+        }
+    }
+
+    BOOST_CHECK_EQUAL( failures, 0 );
+}
+
 BOOST_AUTO_TEST_CASE(HasValue) {
     DeckItem deckIntItem( "TEST", int() );
     BOOST_CHECK_EQUAL( false , deckIntItem.hasValue(0) );
@@ -608,6 +687,64 @@ BOOST_AUTO_TEST_CASE(DeckItemWriteString) {
 }
 
 
+BOOST_AUTO_TEST_CASE(DeckItemWriteCompressed) {
+    auto dims = make_dims();
+    DeckItem item("TEST", double(), dims.first, dims.second);
+    item.push_back(0.25);
+    item.push_back(0.25);
+    item.push_back(0.25);
+    item.push_backDefault(1.0);
+    item.push_back(0.25);
+    item.push_back(1.5);
+    item.push_back(2.0);
+    item.push_back(2.0);
+
+    {
+        std::stringstream s;
+        DeckOutput w(s);
+        item.write( w );
+        BOOST_CHECK_EQUAL( s.str() , "0.25 0.25 0.25 1* 0.25 1.5 2 2");
+    }
+
+    {
+        std::stringstream s;
+        DeckOutput w(s);
+        w.fmt.compress_repeats = true;
+        item.write( w );
+        BOOST_CHECK_EQUAL( s.str() , "3*0.25 1* 0.25 1.5 2*2");
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(DeckOutputWriteKeywords) {
+    auto write_keyword = [](const std::size_t index, DeckOutput& out)
+    {
+        out.start_keyword("KW" + std::to_string(index), true);
+        out.start_record();
+        for (std::size_t i = 0; i < 10; i++)
+            out.write<double>(index + 0.125*i);
+        out.end_record();
+        out.end_keyword(true);
+    };
+
+    const std::size_t num_keywords = 100;
+
+    std::stringstream expected;
+    {
+        DeckOutput out(expected);
+        for (std::size_t index = 0; index < num_keywords; index++)
+            write_keyword(index, out);
+    }
+
+    std::stringstream s;
+    {
+        DeckOutput out(s);
+        out.write_keywords(num_keywords, write_keyword);
+    }
+
+    BOOST_CHECK_EQUAL( s.str(), expected.str() );
+}
+
 BOOST_AUTO_TEST_CASE(RecordWrite) {
     auto dims = make_dims();
     DeckRecord deckRecord;
@@ -41,6 +41,12 @@ along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 #include <opm/input/eclipse/Deck/DeckItem.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
 
+#include <string>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
 using namespace Opm;
 
 inline std::string prepath() {
@@ -673,4 +679,138 @@ BOOST_AUTO_TEST_CASE(SALTMFTest) {
     const auto& saltmf = config_saltmf.salinity();
     const double epsilon = 0.00001;
     BOOST_CHECK_CLOSE(salinity, saltmf, epsilon);
-}
\ No newline at end of file
+}
+namespace {
+
+std::string concurrentConstructionDeck(const std::string& tops,
+                                       const std::string& swof)
+{
+    return R"(
+RUNSPEC
+
+DIMENS
+ 3 3 2 /
+
+OIL
+WATER
+
+GRID
+
+DX
+18*100 /
+DY
+18*100 /
+DZ
+18*10 /
+)" + tops + R"(
+PORO
+18*0.25 /
+PERMX
+18*100 /
+
+NNC
+ 1 1 1  3 3 2  0.5 /
+ 2 1 1  2 3 2  0.7 /
+/
+
+PROPS
+
+)" + swof + R"(
+PVTW
+ 250 1.0 4.0e-5 0.5 0 /
+
+DENSITY
+ 800 1000 1 /
+)";
+}
+
+const std::string validTops = "TOPS\n 9*2000 /\n";
+const std::string validSwof = R"(SWOF
+ 0.2 0.0 1.0 0.0
+ 0.5 0.3 0.3 0.0
+ 1.0 1.0 0.0 0.0 /
+)";
+
+// TOPS gives one value too few.
+const std::string invalidTops = "TOPS\n 8*2000 /\n";
+
+// The water saturation decreases in the second row.
+const std::string invalidSwof = R"(SWOF
+ 0.5 0.0 1.0 0.0
+ 0.2 0.3 0.3 0.0
+ 1.0 1.0 0.0 0.0 /
+)";
+
+EclipseState makeState(const std::string& deckString)
+{
+    return EclipseState { Parser{}.parseString(deckString) };
+}
+
+std::string constructionError(const std::string& deckString)
+{
+    try {
+        makeState(deckString);
+    }
+    catch (const std::exception& e) {
+        return e.what();
+    }
+
+    return {};
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(ConcurrentConstructionMatchesSerial)
+{
+    const auto deckString = concurrentConstructionDeck(validTops, validSwof);
+
+#ifdef _OPENMP
+    const auto maxThreads = omp_get_max_threads();
+    omp_set_num_threads(1);
+#endif // _OPENMP
+
+    const auto serial = makeState(deckString);
+
+#ifdef _OPENMP
+    omp_set_num_threads(4);
+#endif // _OPENMP
+
+    const auto concurrent = makeState(deckString);
+
+#ifdef _OPENMP
+    omp_set_num_threads(maxThreads);
+#endif // _OPENMP
+
+    BOOST_CHECK_EQUAL(serial.getInputNNC().input().size(), 2U);
+    BOOST_CHECK(serial.getTableManager().hasTables("SWOF"));
+
+    BOOST_CHECK_MESSAGE(serial == concurrent,
+                        "EclipseState built concurrently must equal serially built state");
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentConstructionErrors)
+{
+    BOOST_CHECK(constructionError(concurrentConstructionDeck(validTops, validSwof)).empty());
+
+    // Error while constructing the tables only
+    {
+        const auto error = constructionError(concurrentConstructionDeck(validTops, invalidSwof));
+        BOOST_CHECK_MESSAGE(error.find("SWOF") != std::string::npos,
+                            "Unexpected error message: " << error);
+    }
+
+    // Error while constructing the grid only
+    {
+        const auto error = constructionError(concurrentConstructionDeck(invalidTops, validSwof));
+        BOOST_CHECK_MESSAGE(error.find("TOPS") != std::string::npos,
+                            "Unexpected error message: " << error);
+    }
+
+    // Errors in both tables and grid.  The tables are constructed first
+    // in sequential construction, so their error must be reported.
+    for (int i = 0; i < 10; ++i) {
+        const auto error = constructionError(concurrentConstructionDeck(invalidTops, invalidSwof));
+        BOOST_CHECK_MESSAGE(error.find("SWOF") != std::string::npos,
+                            "Unexpected error message: " << error);
+    }
+}
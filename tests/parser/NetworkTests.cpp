@@ -473,6 +473,79 @@ GRUPNET
     BOOST_CHECK(p == network.roots()[0]);
 }
 
+BOOST_AUTO_TEST_CASE(Topology)
+{
+    Network::ExtNetwork network;
+    network.add_branch(Network::Branch { "B1", "PLAT-A", 1, 0.0 });
+    network.add_branch(Network::Branch { "C1", "PLAT-A", 2, 0.0 });
+    network.add_branch(Network::Branch { "PLAT-A", "FIELD", 3, 0.0 });
+    network.add_branch(Network::Branch { "D1", "C1", 4, 0.0 });
+    network.update_node(Network::Node { "LONE" });
+
+    {
+        const auto topology = network.topology();
+
+        BOOST_CHECK_EQUAL(topology->numNodes(), 6);
+        BOOST_CHECK_EQUAL(topology->numBranches(), 4);
+
+        // Insertion order, followed by nodes not connected to any branch.
+        const auto expect_names = std::vector<std::string> {
+            "B1", "PLAT-A", "C1", "FIELD", "D1", "LONE",
+        };
+        for (auto node = 0; node < topology->numNodes(); ++node) {
+            BOOST_CHECK_EQUAL(topology->nodeName(node), expect_names[node]);
+            BOOST_CHECK_EQUAL(topology->nodeId(expect_names[node]).value(), node);
+        }
+        BOOST_CHECK(!topology->nodeId("NO_SUCH_NODE").has_value());
+
+        const auto plat = topology->nodeId("PLAT-A").value();
+        const auto down = topology->downtreeBranches(plat);
+        BOOST_REQUIRE_EQUAL(down.size(), 2U);
+        BOOST_CHECK_EQUAL(down[0], 0);
+        BOOST_CHECK_EQUAL(down[1], 1);
+        BOOST_CHECK_EQUAL(topology->downtreeNode(down[1]), topology->nodeId("C1").value());
+
+        const auto up = topology->uptreeBranches(plat);
+        BOOST_REQUIRE_EQUAL(up.size(), 1U);
+        BOOST_CHECK_EQUAL(topology->uptreeNode(up[0]), topology->nodeId("FIELD").value());
+        BOOST_CHECK_EQUAL(network.branch(up[0]).vfp_table().value(), 3);
+
+        BOOST_CHECK(topology->uptreeBranches(topology->nodeId("FIELD").value()).empty());
+        BOOST_CHECK(topology->downtreeBranches(topology->nodeId("LONE").value()).empty());
+
+        // Every node after all of its uptree nodes.
+        const auto& order = topology->topologicalOrder();
+        BOOST_REQUIRE_EQUAL(order.size(), 6U);
+
+        auto position = std::vector<int>(order.size());
+        for (auto i = 0*order.size(); i < order.size(); ++i) {
+            position[order[i]] = static_cast<int>(i);
+        }
+
+        for (auto branch = 0; branch < topology->numBranches(); ++branch) {
+            BOOST_CHECK_LT(position[topology->uptreeNode(branch)],
+                           position[topology->downtreeNode(branch)]);
+        }
+    }
+
+    // Modifying the network rebuilds the topology.  A topology retrieved
+    // earlier remains valid and still describes the old network.
+    const auto old_topology = network.topology();
+    network.add_or_replace_branch(Network::Branch { "D1", "PLAT-A", 5, 0.0 });
+    BOOST_CHECK(network.topology() != old_topology);
+    BOOST_CHECK_EQUAL(old_topology->downtreeBranches(old_topology->nodeId("PLAT-A").value()).size(), 2U);
+
+    const auto topology = network.topology();
+    const auto plat = topology->nodeId("PLAT-A").value();
+    BOOST_CHECK_EQUAL(topology->downtreeBranches(plat).size(), 3U);
+    BOOST_CHECK(topology->downtreeBranches(topology->nodeId("C1").value()).empty());
+
+    const auto d1_uptree = network.uptree_branch("D1");
+    BOOST_REQUIRE(d1_uptree.has_value());
+    BOOST_CHECK_EQUAL(d1_uptree->uptree_node(), "PLAT-A");
+    BOOST_CHECK_EQUAL(network.downtree_branches("C1").size(), 0U);
+}
+
 BOOST_AUTO_TEST_SUITE_END()     // Basic_Functionality
 
 // ===========================================================================
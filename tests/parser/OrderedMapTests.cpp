@@ -48,6 +48,23 @@ BOOST_AUTO_TEST_CASE( check_similar) {
                           });
 }
 
+BOOST_AUTO_TEST_CASE( check_index ) {
+    Opm::OrderedMap<std::string> map;
+    map.insert(std::make_pair("CKEY1" , "Value1"));
+    map.insert(std::make_pair("BKEY2" , "Value2"));
+    map.insert(std::make_pair("CKEY2" , "Value3"));
+
+    BOOST_CHECK_EQUAL( map.index("CKEY1"), 0U);
+    BOOST_CHECK_EQUAL( map.index("BKEY2"), 1U);
+    BOOST_CHECK_EQUAL( map.index("CKEY2"), 2U);
+    BOOST_CHECK_EXCEPTION(map.index("CKEY"), std::invalid_argument,
+                          [](const std::invalid_argument& e)
+                          {
+                              return std::string("Key CKEY not found. "
+                                                 "Similar entries are CKEY1, CKEY2.") == e.what();
+                          });
+}
+
 BOOST_AUTO_TEST_CASE( operator_square ) {
     Opm::OrderedMap<std::string> map;
     map.insert(std::make_pair("CKEY1" , "Value1"));
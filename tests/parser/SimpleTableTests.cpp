@@ -85,3 +85,24 @@ BOOST_AUTO_TEST_CASE( CreateTest ) {
     }
 }
 
+
+BOOST_AUTO_TEST_CASE( EvaluateColumnIndex ) {
+    TableSchema schema;
+    schema.addColumn( ColumnSchema("X" , Table::STRICTLY_INCREASING , Table::DEFAULT_NONE) );
+    schema.addColumn( ColumnSchema("Y" , Table::RANDOM , Table::DEFAULT_NONE) );
+
+    SimpleTable table(schema);
+    table.addRow( {1, 10}, "TableTested" );
+    table.addRow( {2, 30}, "TableTested" );
+    table.addRow( {4, 20}, "TableTested" );
+
+    const auto y = table.columnIndex( "Y" );
+    BOOST_CHECK_EQUAL( y , 1U );
+    BOOST_CHECK_THROW( table.columnIndex( "Z" ) , std::invalid_argument );
+
+    for (const auto x : { 0.0, 1.0, 1.5, 3.0, 4.0, 5.0 })
+        BOOST_CHECK_EQUAL( table.evaluate( y , x ) , table.evaluate( "Y" , x ) );
+
+    BOOST_CHECK_EQUAL( table.evaluate( y , 1.5 ) , 20.0 );
+    BOOST_CHECK_EQUAL( table.evaluate( y , 3.0 ) , 25.0 );
+}
@@ -287,6 +287,42 @@ BOOST_AUTO_TEST_CASE( Test_EVAL_DECREASING ) {
 
 
 
+BOOST_AUTO_TEST_CASE( Test_LOOKUP_REPEATED_VALUES ) {
+    {
+        ColumnSchema schema("COLUMN" , Table::INCREASING , Table::DEFAULT_NONE);
+        TableColumn column( schema );
+        for (const auto x : { 0.0, 1.0, 1.0, 2.0, 4.0, 4.0 })
+            column.addValue(x, "TableTested");
+
+        BOOST_CHECK_EQUAL( column.lookup( 1.0 ).getIndex1() , 0U );
+        BOOST_CHECK_EQUAL( column.lookup( 1.5 ).getIndex1() , 2U );
+        BOOST_CHECK_EQUAL( column.lookup( 3.0 ).getIndex1() , 3U );
+        BOOST_CHECK_EQUAL( column.lookup( 4.0 ).getIndex1() , 4U );
+        BOOST_CHECK_EQUAL( column.lookup( 5.0 ).getIndex1() , 4U );
+        BOOST_CHECK_EQUAL( column.lookup( 0.0 ).getIndex1() , 0U );
+        BOOST_CHECK_EQUAL( column.eval( column.lookup( 3.0 )) , 3.0 );
+        BOOST_CHECK_EQUAL( column.min() , 0.0 );
+        BOOST_CHECK_EQUAL( column.max() , 4.0 );
+    }
+
+    {
+        ColumnSchema schema("COLUMN" , Table::DECREASING , Table::DEFAULT_NONE);
+        TableColumn column( schema );
+        for (const auto x : { 4.0, 4.0, 2.0, 1.0, 1.0, 0.0 })
+            column.addValue(x, "TableTested");
+
+        BOOST_CHECK_EQUAL( column.lookup( 5.0 ).getIndex1() , 0U );
+        BOOST_CHECK_EQUAL( column.lookup( 3.0 ).getIndex1() , 1U );
+        BOOST_CHECK_EQUAL( column.lookup( 1.0 ).getIndex1() , 4U );
+        BOOST_CHECK_EQUAL( column.lookup( 0.5 ).getIndex1() , 4U );
+        BOOST_CHECK_EQUAL( column.lookup( -1.0 ).getIndex1() , 5U );
+        BOOST_CHECK_EQUAL( column.eval( column.lookup( 3.0 )) , 3.0 );
+        BOOST_CHECK_EQUAL( column.min() , 0.0 );
+        BOOST_CHECK_EQUAL( column.max() , 4.0 );
+    }
+}
+
+
 BOOST_AUTO_TEST_CASE( Test_CONST_DEFAULT ) {
     ColumnSchema schema("COLUMN" , Table::DECREASING , 1.0);
     TableColumn column( schema );
@@ -1830,6 +1830,113 @@ VFPINJ \n\
 
 
 
+BOOST_AUTO_TEST_CASE(VFPProdTable_interpolate) {
+    // Multi-linear function, reproduced exactly by interpolation and
+    // linear extrapolation.
+    auto bhp = [](const double flo, const double thp, const double wfr,
+                  const double gfr, const double alq)
+    {
+        return 1.0 + 2.0*thp + 3.0*wfr + 4.0*gfr + 5.0*alq + 6.0*flo + 0.5*thp*flo;
+    };
+
+    const auto flo = std::vector<double> { 1.0, 2.0, 4.0, 8.0 };
+    const auto thp = std::vector<double> { 10.0, 20.0, 25.0 };
+    const auto wfr = std::vector<double> { 0.0, 0.5 };
+    const auto gfr = std::vector<double> { 100.0 };
+    const auto alq = std::vector<double> { 0.0, 1.0, 3.0 };
+
+    auto data = std::vector<double>{};
+    for (const auto& t : thp) {
+        for (const auto& w : wfr) {
+            for (const auto& g : gfr) {
+                for (const auto& a : alq) {
+                    for (const auto& f : flo) {
+                        data.push_back(bhp(f, t, w, g, a));
+                    }
+                }
+            }
+        }
+    }
+
+    const auto table = Opm::VFPProdTable {
+        1, 1000.0,
+        Opm::VFPProdTable::FLO_TYPE::FLO_OIL,
+        Opm::VFPProdTable::WFR_TYPE::WFR_WCT,
+        Opm::VFPProdTable::GFR_TYPE::GFR_GOR,
+        Opm::VFPProdTable::ALQ_TYPE::ALQ_GRAT,
+        flo, thp, wfr, gfr, alq, data
+    };
+
+    // Table nodes, interior points, and points outside the table.
+    auto points = std::vector<Opm::VFPProdTable::EvaluationPoint> {
+        { 1.0, 10.0, 0.0, 100.0, 0.0 },
+        { 8.0, 25.0, 0.5, 100.0, 3.0 },
+        { 3.0, 12.5, 0.2, 100.0, 2.0 },
+        { 0.5,  5.0, -0.1, 50.0, -1.0 },
+        { 9.0, 30.0, 0.75, 200.0, 4.0 },
+    };
+
+    // Enough points to use the parallel code path, if enabled.
+    for (auto i = 0; i < 2000; ++i) {
+        points.push_back({ 0.01*i, 10.0 + 0.01*i, 0.0002*i, 100.0, 0.0015*i });
+    }
+
+    auto result = std::vector<Opm::VFPProdTable::InterpolatedBHP>{};
+    table.interpolate(points, result);
+
+    BOOST_REQUIRE_EQUAL(result.size(), points.size());
+    for (auto i = 0*points.size(); i < points.size(); ++i) {
+        const auto& p = points[i];
+        const auto& r = result[i];
+
+        // Single point GFR axis.  Table is constant in that direction.
+        BOOST_CHECK_CLOSE(r.bhp, bhp(p.flo, p.thp, p.wfr, gfr.front(), p.alq), 1.0e-8);
+        BOOST_CHECK_EQUAL(r.dgfr, 0.0);
+
+        BOOST_CHECK_CLOSE(r.dflo, 6.0 + 0.5*p.thp, 1.0e-8);
+        BOOST_CHECK_CLOSE(r.dthp, 2.0 + 0.5*p.flo, 1.0e-8);
+        BOOST_CHECK_CLOSE(r.dwfr, 3.0, 1.0e-8);
+        BOOST_CHECK_CLOSE(r.dalq, 5.0, 1.0e-8);
+    }
+
+    table.interpolate({}, result);
+    BOOST_CHECK(result.empty());
+}
+
+BOOST_AUTO_TEST_CASE(VFPInjTable_interpolate) {
+    const char *deckData = "\
+VFPINJ \n\
+       5  32.9   WAT   THP METRIC   BHP /  \n\
+1 3 5 /      \n\
+7 11 /       \n\
+1 1.5 2.5 3.5 /    \n\
+2 4.5 5.5 6.5 /    \n";
+
+    const auto deck = Opm::Parser{}.parseString(deckData);
+    const auto table = Opm::VFPInjTable(deck["VFPINJ"].back(), Opm::UnitSystem::newMETRIC());
+
+    const auto day = 86400.0;
+    const auto barsa = 1.0e5;
+
+    auto result = std::vector<Opm::VFPInjTable::InterpolatedBHP>{};
+    table.interpolate({ { 3.0/day, 7.0*barsa },
+                        { 4.0/day, 9.0*barsa },
+                        { 6.0/day, 13.0*barsa } }, result);
+
+    BOOST_REQUIRE_EQUAL(result.size(), 3U);
+
+    // Table node
+    BOOST_CHECK_CLOSE(result[0].bhp, 2.5*barsa, 1.0e-10);
+
+    // Interior: halfway between FLO nodes 3 and 5, and THP nodes 7 and 11
+    BOOST_CHECK_CLOSE(result[1].bhp, 4.5*barsa, 1.0e-10);
+    BOOST_CHECK_CLOSE(result[1].dthp, 3.0*barsa / (4.0*barsa), 1.0e-10);
+    BOOST_CHECK_CLOSE(result[1].dflo, 1.0*barsa / (2.0/day), 1.0e-10);
+
+    // Extrapolated from last interval along both axes
+    BOOST_CHECK_CLOSE(result[2].bhp, 8.5*barsa, 1.0e-10);
+}
+
 BOOST_AUTO_TEST_CASE(TestTableContainer) {
     auto deck = createSingleRecordDeck();
     Opm::TableManager tables( deck );
@@ -2163,6 +2163,105 @@ BOOST_AUTO_TEST_CASE(UDQSTATE) {
     BOOST_CHECK_EQUAL(st.get_well_var("P2", "WUPR"), undefined_value);
 }
 
+BOOST_AUTO_TEST_CASE(UDQSTATE_HANDLES) {
+    UDQState st(1234);
+    BOOST_CHECK(!st.well_var_handle("WUPR").has_value());
+    BOOST_CHECK(!st.well_handle("P1").has_value());
+
+    auto wupr = UDQSet::wells("WUPR", {"P1", "P2", "P3"});
+    wupr.assign("P1", 75);
+    wupr.assign("P3", 25);
+    st.add_define(0, "WUPR", wupr);
+
+    auto guir = UDQSet::groups("GUIR", {"G1", "G2"});
+    guir.assign("G2", 1.5);
+    st.add_define(0, "GUIR", guir);
+
+    const auto var = st.well_var_handle("WUPR");
+    const auto p1 = st.well_handle("P1");
+    const auto p3 = st.well_handle("P3");
+    BOOST_REQUIRE(var.has_value());
+    BOOST_REQUIRE(p1.has_value());
+    BOOST_REQUIRE(p3.has_value());
+    BOOST_CHECK(!st.well_handle("P2").has_value());
+    BOOST_CHECK(!st.group_var_handle("WUPR").has_value());
+
+    BOOST_CHECK_EQUAL(st.well_value(*var, *p1).value(), 75);
+    BOOST_CHECK_EQUAL(st.well_value(*var, *p3).value(), 25);
+
+    // Handles are stable when values are undefined and redefined
+    wupr.assign("P1", std::optional<double>{});
+    wupr.assign("P2", 10);
+    st.add_define(1, "WUPR", wupr);
+
+    BOOST_CHECK(st.well_var_handle("WUPR") == var);
+    BOOST_CHECK(st.well_handle("P1") == p1);
+    BOOST_CHECK(!st.well_value(*var, *p1).has_value());
+    BOOST_CHECK(!st.has_well_var("P1", "WUPR"));
+    BOOST_CHECK_EQUAL(st.well_value(*var, st.well_handle("P2").value()).value(), 10);
+    BOOST_CHECK_EQUAL(st.get_well_var("P2", "WUPR"), 10);
+
+    const auto gvar = st.group_var_handle("GUIR");
+    const auto g2 = st.group_handle("G2");
+    BOOST_REQUIRE(gvar.has_value());
+    BOOST_REQUIRE(g2.has_value());
+    BOOST_CHECK_EQUAL(st.group_value(*gvar, *g2).value(), 1.5);
+    BOOST_CHECK(!st.group_handle("G1").has_value());
+}
+
+BOOST_AUTO_TEST_CASE(UDQSTATE_EQUAL_INSERTION_ORDER) {
+    UDQState st1(1234);
+    UDQState st2(1234);
+
+    // Same values, wells and groups first seen in different orders.
+    auto wupr1 = UDQSet::wells("WUPR", {"P1", "P2"});
+    wupr1.assign("P1", 1);
+    wupr1.assign("P2", 2);
+    st1.add_define(0, "WUPR", wupr1);
+
+    auto wupr2 = UDQSet::wells("WUPR", {"P2", "P1"});
+    wupr2.assign("P2", 2);
+    st2.add_define(0, "WUPR", wupr2);
+    wupr2.assign("P1", 1);
+    st2.add_define(0, "WUPR", wupr2);
+
+    auto guir1 = UDQSet::groups("GUIR", {"G1", "G2"});
+    guir1.assign("G1", 10);
+    guir1.assign("G2", 20);
+    st1.add_define(0, "GUIR", guir1);
+
+    auto guir2 = UDQSet::groups("GUIR", {"G2", "G1"});
+    guir2.assign("G2", 20);
+    guir2.assign("G1", 10);
+    st2.add_define(0, "GUIR", guir2);
+
+    auto fu1 = UDQSet::scalar("FU1", 5);
+    auto fu2 = UDQSet::scalar("FU2", 6);
+    st1.add_define(0, "FU1", fu1);
+    st1.add_define(0, "FU2", fu2);
+    st2.add_define(0, "FU2", fu2);
+    st2.add_define(0, "FU1", fu1);
+
+    BOOST_CHECK(st1 == st2);
+    BOOST_CHECK(st2 == st1);
+
+    // A value which was defined and then undefined equals one never defined.
+    auto wuwr = UDQSet::wells("WUWR", {"P1", "P3"});
+    wuwr.assign("P3", 3);
+    st1.add_define(0, "WUWR", wuwr);
+    wuwr.assign("P3", std::optional<double>{});
+    st1.add_define(0, "WUWR", wuwr);
+
+    st2.add_define(0, "WUWR", UDQSet::wells("WUWR", {"P1", "P3"}));
+    BOOST_CHECK(st1 == st2);
+
+    // A different value is still a difference.
+    wupr1.assign("P2", 3);
+    st1.add_define(0, "WUPR", wupr1);
+    BOOST_CHECK(!(st1 == st2));
+    BOOST_CHECK(!(st2 == st1));
+}
+
 BOOST_AUTO_TEST_CASE(UDQ_UADD_PARSER2) {
     std::string deck_string = R"(
 SCHEDULE
@@ -25,8 +25,13 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 using namespace Opm;
 
@@ -672,6 +677,75 @@ BOOST_AUTO_TEST_CASE(TemperatureConversions)
 
 
 
+BOOST_AUTO_TEST_CASE(BulkConversions)
+{
+    using Meas = UnitSystem::measure;
+
+    auto field = UnitSystem::newFIELD();
+
+    // Large enough to be split between threads.  The bulk results are
+    // compared as whole collections against the element-wise conversions.
+    std::vector<double> values(100'000);
+    for (std::size_t i = 0; i < values.size(); ++i)
+        values[i] = 0.01 * i - 100.0;
+
+    const auto convert = [&values](const auto& fn)
+    {
+        auto result = std::vector<std::invoke_result_t<decltype(fn), double>>{};
+        result.reserve(values.size());
+        std::transform(values.begin(), values.end(), std::back_inserter(result), fn);
+        return result;
+    };
+
+    for (const auto m : { Meas::temperature, Meas::pressure, Meas::length }) {
+        auto si = values;
+        field.to_si(m, si);
+
+        auto raw = si;
+        field.from_si(m, raw);
+
+        auto raw_f = std::vector<float>(si.size());
+        field.from_si(m, si.data(), si.size(), raw_f.data());
+
+        const auto expect_si = convert([&](const double x) { return field.to_si(m, x); });
+        const auto expect_raw = convert([&](const double x)
+        { return field.from_si(m, field.to_si(m, x)); });
+        const auto expect_raw_f = convert([&](const double x)
+        { return static_cast<float>(field.from_si(m, field.to_si(m, x))); });
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(si.begin(), si.end(),
+                                      expect_si.begin(), expect_si.end());
+        BOOST_CHECK_EQUAL_COLLECTIONS(raw.begin(), raw.end(),
+                                      expect_raw.begin(), expect_raw.end());
+        BOOST_CHECK_EQUAL_COLLECTIONS(raw_f.begin(), raw_f.end(),
+                                      expect_raw_f.begin(), expect_raw_f.end());
+    }
+
+    const auto dim = field.getDimension(Meas::temperature);
+    auto si = std::vector<double>(values.size());
+    dim.convertRawToSi(values.data(), values.size(), si.data());
+
+    auto raw = si;
+    dim.convertSiToRaw(raw.data(), raw.size(), raw.data());
+
+    const auto expect_si = convert([&dim](const double x) { return dim.convertRawToSi(x); });
+    const auto expect_raw = convert([&dim](const double x)
+    { return dim.convertSiToRaw(dim.convertRawToSi(x)); });
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(si.begin(), si.end(),
+                                  expect_si.begin(), expect_si.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(raw.begin(), raw.end(),
+                                  expect_raw.begin(), expect_raw.end());
+
+    const auto contextDependent = field.getDimension("ContextDependent");
+    BOOST_CHECK( contextDependent.isContextDependent() );
+    BOOST_CHECK_THROW(contextDependent.convertRawToSi(values.data(), values.size(), si.data()),
+                      std::logic_error);
+    BOOST_CHECK_NO_THROW(contextDependent.convertRawToSi(values.data(), 0, si.data()));
+}
+
+
+
 BOOST_AUTO_TEST_CASE(EclipseID) {
     BOOST_CHECK_THROW(UnitSystem(0), std::invalid_argument);
     BOOST_CHECK_THROW(UnitSystem(5), std::invalid_argument);
@@ -23,8 +23,10 @@
 
 #include <opm/common/utility/CSRGraphFromCoordinates.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <stdexcept>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(No_Self_Connections)
 
@@ -1447,6 +1449,128 @@ BOOST_AUTO_TEST_CASE(Linear_4x1x1_Symmetric_Multiple_Repeated_Add_3x1x1_Expand_N
     }
 }
 
+BOOST_AUTO_TEST_CASE(Bulk_Add_Connections)
+{
+    auto graph = CSRGraph{};
+
+    // Self connection (2,2) is ignored.
+    const auto rows = std::vector { 0, 1, 1, 2, 2, 3, 2 };
+    const auto cols = std::vector { 1, 0, 2, 1, 3, 2, 2 };
+
+    graph.addConnections(rows, cols);
+    graph.compress(4);
+
+    BOOST_CHECK_EQUAL(graph.numVertices(), std::size_t{4});
+    BOOST_CHECK_EQUAL(graph.numEdges(), std::size_t{6});
+
+    {
+        const auto& nzMap = graph.compressedIndexMap();
+        const auto expect = std::vector { 0, 1, 2, 3, 4, 5, };
+        BOOST_CHECK_EQUAL_COLLECTIONS(nzMap .begin(), nzMap .end(),
+                                      expect.begin(), expect.end());
+    }
+
+    BOOST_CHECK_THROW(graph.addConnections(std::vector { 0, 1 }, std::vector { 1 }),
+                      std::invalid_argument);
+
+    BOOST_CHECK_THROW(graph.addConnections(std::vector { 0, -1 }, std::vector { 1, 2 }),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Recompress_Reuse_Pattern)
+{
+    auto graph = CSRGraph{};
+
+    auto addConnections = [&graph](const int n)
+    {
+        for (auto i = 0; i < n - 1; ++i) {
+            graph.addConnection(i + 1, i);
+            graph.addConnection(i, i + 1);
+        }
+    };
+
+    addConnections(4);
+    BOOST_CHECK_MESSAGE(! graph.recompress(4), "Empty graph must not be reused");
+
+    addConnections(4);
+    BOOST_CHECK_MESSAGE(graph.recompress(4), "Identical connections must reuse structure");
+
+    BOOST_CHECK_EQUAL(graph.numVertices(), std::size_t{4});
+    BOOST_CHECK_EQUAL(graph.numEdges(), std::size_t{6});
+
+    {
+        const auto& nzMap = graph.compressedIndexMap();
+        const auto expect = std::vector { 1, 0, 3, 2, 5, 4, };
+        BOOST_CHECK_EQUAL_COLLECTIONS(nzMap .begin(), nzMap .end(),
+                                      expect.begin(), expect.end());
+    }
+
+    addConnections(4);
+    BOOST_CHECK_MESSAGE(! graph.recompress(5), "Different size must not reuse structure");
+    BOOST_CHECK_EQUAL(graph.numVertices(), std::size_t{5});
+    BOOST_CHECK_EQUAL(graph.numEdges(), std::size_t{6});
+
+    addConnections(3);
+    BOOST_CHECK_MESSAGE(! graph.recompress(5), "Different connections must not reuse structure");
+    BOOST_CHECK_EQUAL(graph.numEdges(), std::size_t{4});
+
+    {
+        const auto& ja = graph.columnIndices();
+        const auto expect = std::vector { 1, 0, 2, 1, };
+        BOOST_CHECK_EQUAL_COLLECTIONS(ja    .begin(), ja    .end(),
+                                      expect.begin(), expect.end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Large_Repeated)
+{
+    // Large enough to exercise the parallel grouping paths.  Few rows use
+    // per-thread row counts while many rows use atomic insertion.
+    for (const auto numRows : { 7, 100'003 }) {
+        auto graph = CSRGraph{};
+
+        const auto numConns = 400'000;
+        auto rows = std::vector<int>(numConns);
+        auto cols = std::vector<int>(numConns);
+
+        for (auto i = 0; i < numConns; ++i) {
+            rows[i] = static_cast<int>((i * 7919LL) % numRows);
+            cols[i] = (rows[i] + 1 + (i % 5)) % numRows;
+        }
+
+        graph.addConnections(rows, cols);
+        graph.compress(numRows);
+
+        BOOST_REQUIRE_EQUAL(graph.numVertices(), static_cast<std::size_t>(numRows));
+
+        const auto& ia = graph.startPointers();
+        const auto& ja = graph.columnIndices();
+        const auto& nzMap = graph.compressedIndexMap();
+
+        BOOST_REQUIRE_EQUAL(nzMap.size(), static_cast<std::size_t>(numConns));
+
+        auto rowsOK = true;
+        for (auto row = 0; row < numRows; ++row) {
+            rowsOK = rowsOK
+                && std::is_sorted(ja.begin() + ia[row], ja.begin() + ia[row + 1])
+                && (std::adjacent_find(ja.begin() + ia[row], ja.begin() + ia[row + 1])
+                    == ja.begin() + ia[row + 1]);
+        }
+
+        BOOST_CHECK_MESSAGE(rowsOK, "Column indices must be sorted and unique per row");
+
+        auto mapOK = true;
+        for (auto i = 0; i < numConns; ++i) {
+            const auto edge = nzMap[i];
+            mapOK = mapOK
+                && (ia[rows[i]] <= edge) && (edge < ia[rows[i] + 1])
+                && (ja[edge] == cols[i]);
+        }
+
+        BOOST_CHECK_MESSAGE(mapOK, "Compressed index map must identify input connections");
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()     // Tracked
 
 BOOST_AUTO_TEST_SUITE_END()     // No_Self_Connections
@@ -190,6 +190,50 @@ BOOST_AUTO_TEST_CASE(getCellCorners) {
 }
 
 
+BOOST_AUTO_TEST_CASE(activeCellGeometry) {
+
+    EGrid grid1("SPE1CASE1.EGRID");
+
+    const auto geometry = grid1.activeCellGeometry(true);
+
+    BOOST_CHECK_EQUAL(geometry.numCells, grid1.activeCells());
+    BOOST_CHECK_EQUAL(geometry.X.size(), 8 * static_cast<std::size_t>(grid1.activeCells()));
+    BOOST_CHECK_EQUAL(geometry.faces.size(), 24 * static_cast<std::size_t>(grid1.activeCells()));
+
+    // 11 x 11 pillars, four depths each, less two corners only touched by
+    // inactive cells.
+    BOOST_CHECK_EQUAL(geometry.vertexX.size(), 482);
+
+    std::array<double,8> X, Y, Z;
+
+    for (int actInd = 0; actInd < grid1.activeCells(); actInd++) {
+        grid1.getCellCorners(grid1.ijk_from_active_index(actInd), X, Y, Z);
+
+        for (int n = 0; n < 8; n++) {
+            BOOST_CHECK_EQUAL(geometry.X[8*actInd + n], X[n]);
+            BOOST_CHECK_EQUAL(geometry.Y[8*actInd + n], Y[n]);
+            BOOST_CHECK_EQUAL(geometry.Z[8*actInd + n], Z[n]);
+        }
+
+        // top face (K-) is made up of corners 0, 1, 3 and 2
+        const auto v = geometry.faces[24*actInd + 16 + 2];
+        BOOST_CHECK_EQUAL(geometry.vertexX[v], X[3]);
+        BOOST_CHECK_EQUAL(geometry.vertexY[v], Y[3]);
+        BOOST_CHECK_EQUAL(geometry.vertexZ[v], Z[3]);
+    }
+
+    const auto chunk = grid1.activeCellGeometry(10, 20);
+
+    BOOST_CHECK_EQUAL(chunk.firstActive, 10);
+    BOOST_CHECK_EQUAL(chunk.centerZ.size(), 20);
+    BOOST_CHECK_EQUAL(chunk.centerZ[0], geometry.centerZ[10]);
+    BOOST_CHECK_EQUAL(chunk.vertexX.size(), 0);
+
+    BOOST_CHECK_THROW(grid1.activeCellGeometry(grid1.activeCells() - 1, 2), std::invalid_argument);
+    BOOST_CHECK_THROW(grid1.activeCellGeometry(-1, 2), std::invalid_argument);
+}
+
+
 BOOST_AUTO_TEST_CASE(lgr_1) {
 
     std::string testEgridFile = "LGR_TESTMOD.EGRID";
@@ -0,0 +1,165 @@
+/*
+   Copyright 2024 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE EclArrayStreamTest
+
+#include <boost/test/unit_test.hpp>
+
+#include <test_util/EclArrayStream.hpp>
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/ERst.hpp>
+
+#include <tests/WorkArea.hpp>
+
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace Opm::EclIO;
+
+namespace {
+
+std::string fileContents(const std::string& filename)
+{
+    std::ifstream is(filename, std::ios::binary);
+    return { std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>() };
+}
+
+std::vector<double> doubleValues(const int n, const double offset)
+{
+    std::vector<double> values(n);
+    std::iota(values.begin(), values.end(), offset);
+    return values;
+}
+
+// One array of each type, with arrays larger and smaller than the
+// read-ahead budgets used below.
+void writeAllTypes(const std::string& filename, const bool formatted)
+{
+    EclOutput output(filename, formatted);
+
+    output.write("INTEHEAD", std::vector<int> { 1, 2, 3, 4, 5 });
+    output.write("PORV", std::vector<float>(1000, 0.25f));
+    output.write("DOUBHEAD", doubleValues(300, 0.5));
+    output.write("LOGIHEAD", std::vector<bool> { true, false, true });
+    output.write("KEYWORDS", std::vector<std::string> { "PRESSURE", "SWAT" });
+    output.write("ZNAMES", std::vector<std::string> { "A-LONG-NAME-FOR-C0NN", "B" }, 24);
+    output.message("STARTSOL");
+    output.write("PRESSURE", doubleValues(2000, 100.0));
+    output.message("ENDSOL");
+}
+
+void writeUnifiedRestart(const std::string& filename)
+{
+    EclOutput output(filename, false);
+
+    for (const int step : { 1, 5, 7 }) {
+        output.write("SEQNUM", std::vector<int> { step });
+        output.write("INTEHEAD", std::vector<int>(411, step));
+        output.write("PRESSURE", doubleValues(10, step));
+        output.write("SWAT", std::vector<float>(10, 0.1f * step));
+    }
+}
+
+void copyFile(const std::string& input, const std::string& output,
+              const std::size_t maxBufferedBytes)
+{
+    EclFile inputFile(input);
+    EclOutput outputFile(output, !inputFile.formattedInput());
+
+    EclArrayStream stream(inputFile, maxBufferedBytes);
+    stream.copy(stream.allArrays(), outputFile);
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(RoundTrip)
+{
+    WorkArea work("test_EclArrayStream");
+
+    writeAllTypes("REFERENCE.INIT", false);
+    writeAllTypes("REFERENCE.FINIT", true);
+
+    // budgets of less than one array, a few arrays and the whole file
+    for (const std::size_t budget : { std::size_t{1}, std::size_t{4096}, std::size_t{1} << 30 }) {
+        copyFile("REFERENCE.INIT", "CONVERTED.FINIT", budget);
+        BOOST_CHECK_MESSAGE(fileContents("CONVERTED.FINIT") == fileContents("REFERENCE.FINIT"),
+                            "Binary to formatted conversion with budget " << budget);
+
+        copyFile("CONVERTED.FINIT", "CONVERTED.INIT", budget);
+        BOOST_CHECK_MESSAGE(fileContents("CONVERTED.INIT") == fileContents("REFERENCE.INIT"),
+                            "Formatted to binary conversion with budget " << budget);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ReleasesArrays)
+{
+    WorkArea work("test_EclArrayStream");
+
+    writeAllTypes("REFERENCE.INIT", false);
+
+    EclFile input("REFERENCE.INIT");
+    {
+        EclOutput output("CONVERTED.FINIT", true);
+        EclArrayStream stream(input, 4096);
+        stream.copy(stream.allArrays(), output);
+    }
+
+    // arrays can be loaded again after they have been streamed
+    BOOST_CHECK(input.get<double>("PRESSURE") == doubleValues(2000, 100.0));
+
+    const auto pressure = input.release<double>(input.arrayNames().size() - 2);
+    BOOST_CHECK(pressure == doubleValues(2000, 100.0));
+    BOOST_CHECK(input.get<double>("PRESSURE") == pressure);
+    BOOST_CHECK_THROW(input.release<int>(1), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(SelectArrays)
+{
+    WorkArea work("test_EclArrayStream");
+
+    writeUnifiedRestart("TEST.UNRST");
+
+    ERst rst("TEST.UNRST");
+    EclArrayStream stream(rst, 1024);
+
+    const auto step5 = EclArrayStream::reportStepArrays(rst, 5);
+    BOOST_CHECK(step5 == (std::vector<int> { 4, 5, 6, 7 }));
+    BOOST_CHECK_THROW(EclArrayStream::reportStepArrays(rst, 2), std::invalid_argument);
+
+    const auto selected = stream.selectArrays(step5, { "PRESSURE", "SEQNUM" });
+    BOOST_CHECK(selected == (std::vector<int> { 4, 6 }));
+    BOOST_CHECK(stream.selectArrays(step5, {}) == step5);
+
+    {
+        EclOutput output("STEP5.FUNRST", true);
+        stream.copy(selected, output);
+    }
+
+    EclFile converted("STEP5.FUNRST");
+    BOOST_CHECK(converted.arrayNames() == (std::vector<std::string> { "SEQNUM", "PRESSURE" }));
+    BOOST_CHECK(converted.get<int>("SEQNUM") == std::vector<int> { 5 });
+    BOOST_CHECK(converted.get<double>("PRESSURE") == doubleValues(10, 5));
+}
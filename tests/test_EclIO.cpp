@@ -21,6 +21,7 @@
 #include <stdio.h>
 
 #include <algorithm>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -241,6 +242,63 @@ BOOST_AUTO_TEST_CASE(TestEclFile_FORMATTED) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestEclFile_LoadSubset) {
+
+    // loading a subset of the arrays in one call must produce the same
+    // data as loading the arrays one at a time, and leave the others alone
+
+    for (const std::string testFile : {"ECLFILE.INIT", "ECLFILE.FINIT"}) {
+        EclFile file1(testFile);
+        EclFile file2(testFile);
+
+        file1.loadData(std::vector<int>{ 4, 0, 3, 2 });
+
+        for (int arrIndex : { 0, 2, 3, 4 }) {
+            file2.loadData(arrIndex);
+        }
+
+        BOOST_CHECK(file1.get<int>(0) == file2.get<int>(0));
+        BOOST_CHECK(file1.get<float>(2) == file2.get<float>(2));
+        BOOST_CHECK(file1.get<double>(3) == file2.get<double>(3));
+        BOOST_CHECK(file1.get<std::string>(4) == file2.get<std::string>(4));
+
+        BOOST_CHECK_EQUAL(file1.get<int>("ICON").size(), 1875U);
+        BOOST_CHECK_EQUAL(file1.get<float>("PORV").size(), 3146U);
+        BOOST_CHECK_EQUAL(file1.get<bool>("LOGIHEAD").size(), 121U);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestEclFile_LoadDuplicates) {
+
+    // indices which are requested more than once are loaded once
+
+    for (const std::string testFile : {"ECLFILE.INIT", "ECLFILE.FINIT"}) {
+        EclFile file1(testFile);
+        EclFile file2(testFile);
+
+        file1.loadData(std::vector<int>{ 2, 0, 2, 0, 0, 2, 0, 2, 2, 0, 2 });
+        file2.loadData(std::vector<int>{ 0, 2 });
+
+        BOOST_CHECK(file1.get<int>(0) == file2.get<int>(0));
+        BOOST_CHECK(file1.get<float>(2) == file2.get<float>(2));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestEclFile_LoadMissingFile) {
+
+    // a binary file which has disappeared is reported even if no arrays
+    // are requested
+
+    WorkArea work;
+    work.copyIn("ECLFILE.INIT");
+
+    EclFile file1("ECLFILE.INIT");
+    std::filesystem::remove("ECLFILE.INIT");
+
+    BOOST_CHECK_THROW(file1.loadData(std::vector<int>{}), std::runtime_error);
+    BOOST_CHECK_THROW(file1.loadData(std::vector<int>{ 0, 2 }), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_CASE(TestEclFile_IX) {
 
     // file MODEL1_IX.INIT is output from comercial simulator ix with
@@ -66,6 +66,47 @@ BOOST_AUTO_TEST_CASE(TESTInplace)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Bulk_Add_And_Reset)
+{
+    Inplace oip;
+
+    oip.add("FIPNUM", Inplace::Phase::WATER, std::vector<double> { 1.0, 2.0, 3.0, 4.0 });
+    oip.add("FIPNUM", Inplace::Phase::OIL, 2, 20.0);
+    oip.add(Inplace::Phase::WATER, 10.0);
+
+    BOOST_CHECK_EQUAL(oip.max_region("FIPNUM"), 4);
+    BOOST_CHECK_EQUAL(oip.get("FIPNUM", Inplace::Phase::WATER, 3), 3.0);
+    BOOST_CHECK_EQUAL(oip.get(Inplace::Phase::WATER), 10.0);
+    BOOST_CHECK_MESSAGE(! oip.has("FIPNUM", Inplace::Phase::WATER, 0),
+                        "Bulk add() must not assign region ID zero");
+
+    {
+        std::vector<double> v1;
+        oip.get_vector("FIPNUM", Inplace::Phase::OIL, v1);
+
+        const std::vector<double> e1 = {0, 20, 0, 0};
+        BOOST_CHECK_MESSAGE(v1 == e1, "In-place oil content must match expected");
+    }
+
+    oip.reset();
+
+    BOOST_CHECK_MESSAGE(! oip.has(Inplace::Phase::WATER),
+                        "Reset object must not have field level values");
+    BOOST_CHECK_MESSAGE(! oip.has("FIPNUM", Inplace::Phase::WATER, 1),
+                        "Reset object must not have region level values");
+    BOOST_CHECK_THROW(oip.get_vector("FIPNUM", Inplace::Phase::WATER), std::exception);
+    BOOST_CHECK_MESSAGE(oip == Inplace{}, "Reset object must equal empty object");
+
+    oip.add("FIPNUM", Inplace::Phase::GAS, std::vector<double> { 5.0, 6.0 });
+
+    Inplace expect;
+    expect.add("FIPNUM", Inplace::Phase::GAS, 1, 5.0);
+    expect.add("FIPNUM", Inplace::Phase::GAS, 2, 6.0);
+
+    BOOST_CHECK_EQUAL(oip.max_region("FIPNUM"), 2);
+    BOOST_CHECK_MESSAGE(oip == expect, "Refilled object must equal freshly constructed object");
+}
+
 BOOST_AUTO_TEST_CASE(InPlace_Phases)
 {
     const auto& phases = Inplace::phases();
@@ -169,6 +210,25 @@ BOOST_AUTO_TEST_CASE(InPlace_Phases)
                         R"(phases() must have "CO2MassInGasPhaseMaximumUnTrapped")");
 }
 
+BOOST_AUTO_TEST_CASE(InPlace_All_Quantities)
+{
+    const auto last = static_cast<int>(Inplace::Phase::CO2MassInGasPhaseMaximumUnTrapped);
+    const auto& phases = Inplace::phases();
+
+    for (int i = 0; i <= last; ++i) {
+        const auto phase = static_cast<Inplace::Phase>(i);
+        const auto is_pore_volume = (phase == Inplace::Phase::PressurePV)
+            || (phase == Inplace::Phase::HydroCarbonPV)
+            || (phase == Inplace::Phase::PressureHydroCarbonPV)
+            || (phase == Inplace::Phase::DynamicPoreVolume);
+
+        BOOST_CHECK_MESSAGE(contains(phases, phase) != is_pore_volume,
+                            "Quantity " << i << " must be in phases() unless it is a pore volume");
+    }
+
+    BOOST_CHECK_EQUAL(phases.size() + 4, static_cast<std::size_t>(last + 1));
+}
+
 BOOST_AUTO_TEST_CASE(InPlace_Mixing_Phases)
 {
     const auto& phases = Inplace::mixingPhases();
@@ -60,6 +60,7 @@
 #include <array>
 #include <cstddef>
 #include <ctime>
+#include <fstream>
 #include <functional>
 #include <iomanip>
 #include <iterator>
@@ -71,6 +72,10 @@
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
 namespace std { // hack...
     // For printing ERft::RftDate objects.  Needed by EQUAL_COLLECTIONS.
     static ostream& operator<<(ostream& os, const tuple<int,int,int>& d)
@@ -2882,6 +2887,172 @@ BOOST_AUTO_TEST_CASE(PVT_M_Units)
     }
 }
 
+namespace {
+    const auto multipleWellNames = std::vector<std::string> {
+        "W_1", "W_2", "W_3", "W_4", "W_5", "W_6",
+    };
+
+    ::Opm::Deck multipleWellsDeck()
+    {
+        return ::Opm::Parser{}.parseString(R"(RUNSPEC
+OIL
+GAS
+WATER
+DIMENS
+ 6 1 4 /
+GRID
+DXV
+6*100 /
+DYV
+100 /
+DZV
+4*10 /
+TOPS
+6*2000 /
+PORO
+24*0.2 /
+PERMX
+24*100 /
+PERMY
+24*100 /
+PERMZ
+24*10 /
+START
+ 1 JAN 2020 /
+SCHEDULE
+WELSPECS
+ 'W_1' 'OP' 1 1 1* 'OIL' /
+ 'W_2' 'OP' 2 1 1* 'OIL' /
+ 'W_3' 'OP' 3 1 1* 'OIL' /
+ 'W_4' 'OP' 4 1 1* 'OIL' /
+ 'W_5' 'OP' 5 1 1* 'OIL' /
+ 'W_6' 'OP' 6 1 1* 'OIL' /
+/
+COMPDAT
+ 'W_1' 1 1 1 4 'OPEN' 1* 10 0.3 /
+ 'W_2' 2 1 1 4 'OPEN' 1* 10 0.3 /
+ 'W_3' 3 1 1 4 'OPEN' 1* 10 0.3 /
+ 'W_4' 4 1 1 4 'OPEN' 1* 10 0.3 /
+ 'W_5' 5 1 1 4 'OPEN' 1* 10 0.3 /
+ 'W_6' 6 1 1 4 'OPEN' 1* 10 0.3 /
+/
+WRFTPLT
+ 'W_1' 'YES' 'YES' /
+ 'W_2' 'YES' 'YES' /
+ 'W_3' 'YES' 'YES' /
+ 'W_4' 'YES' 'YES' /
+ 'W_5' 'YES' 'YES' /
+ 'W_6' 'YES' 'YES' /
+/
+TSTEP
+ 10 /
+END
+)");
+    }
+
+    ::Opm::data::Wells multipleWellsSol(const ::Opm::EclipseGrid& grid)
+    {
+        auto xw = ::Opm::data::Wells{};
+
+        const auto numWells = static_cast<int>(multipleWellNames.size());
+        for (auto well = 0; well < numWells; ++well) {
+            auto& xcon = xw[multipleWellNames[well]].connections;
+
+            for (auto k = 0; k < 4; ++k) {
+                auto& c = xcon.emplace_back();
+
+                c.index = grid.getGlobalIndex(well, 0, k);
+
+                c.cell_pressure = (200 + 10*well + k)*::Opm::unit::barsa;
+                c.cell_saturation_gas   = 0.05*k;
+                c.cell_saturation_water = 0.1 + 0.01*well;
+                c.trans_factor          = 1.0 + well;
+
+                c.rates.set(::Opm::data::Rates::opt::oil, -(well + 1.0)*(k + 1.0));
+            }
+        }
+
+        return xw;
+    }
+
+    std::string fileContents(const std::string& filename)
+    {
+        std::ifstream is(filename, std::ios::binary);
+        return { std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>() };
+    }
+
+    std::string writeMultipleWellsRFT(const Setup& model, const int numThreads)
+    {
+        const auto rset = RSet { "MULTRFT" };
+
+#ifdef _OPENMP
+        const auto maxThreads = omp_get_max_threads();
+        omp_set_num_threads(numThreads);
+#else
+        static_cast<void>(numThreads);
+#endif // _OPENMP
+
+        {
+            auto rftFile = ::Opm::EclIO::OutputStream::RFT {
+                rset, ::Opm::EclIO::OutputStream::Formatted  { false },
+                ::Opm::EclIO::OutputStream::RFT::OpenExisting{ false }
+            };
+
+            const auto  reportStep = 0;
+            const auto  elapsed    = model.sched.seconds(reportStep);
+            const auto& grid       = model.es.getInputGrid();
+
+            ::Opm::RftIO::write(reportStep, elapsed, model.es.getUnits(),
+                                grid, model.sched, multipleWellsSol(grid), rftFile);
+        }
+
+#ifdef _OPENMP
+        omp_set_num_threads(maxThreads);
+#endif // _OPENMP
+
+        const auto fname = ::Opm::EclIO::OutputStream::outputFileName(rset, "RFT");
+
+        // Records must be written in schedule well order, each with its
+        // own well's data.
+        {
+            using RftDate = ::Opm::EclIO::ERft::RftDate;
+
+            const auto rft = ::Opm::EclIO::ERft { fname };
+
+            const auto numWells = static_cast<int>(multipleWellNames.size());
+
+            const auto& reports = rft.listOfRftReports();
+            BOOST_REQUIRE_EQUAL(reports.size(), multipleWellNames.size());
+
+            for (auto well = 0; well < numWells; ++well) {
+                const auto& wname = multipleWellNames[well];
+
+                BOOST_CHECK_EQUAL(std::get<0>(reports[well]), wname);
+
+                const auto xRFT = RFTRresults { rft, wname, RftDate{ 2020, 1, 1 } };
+                for (auto k = 0; k < 4; ++k) {
+                    BOOST_CHECK_CLOSE(xRFT.pressure(well + 1, 1, k + 1),
+                                      200.0f + 10*well + k, 1.0e-5f);
+                }
+            }
+        }
+
+        return fileContents(fname);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Multiple_Wells_Serial_And_Parallel)
+{
+    const auto model = Setup { multipleWellsDeck() };
+
+    const auto serial   = writeMultipleWellsRFT(model, 1);
+    const auto parallel = writeMultipleWellsRFT(model, 4);
+
+    BOOST_CHECK_MESSAGE(! serial.empty(), "Serial RFT output must not be empty");
+    BOOST_CHECK_MESSAGE(serial == parallel,
+                        "RFT file written with four threads must match serial output");
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Using_Direct_Write
 
 // =====================================================================
@@ -72,6 +72,10 @@
 
 #include <fmt/format.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
 using namespace Opm;
 using rt = data::Rates::opt;
 using p_cmode = Opm::Group::ProductionCMode;
@@ -2866,6 +2870,76 @@ BOOST_AUTO_TEST_CASE(efficiency_factor) {
         BOOST_CHECK_CLOSE( 200.1 * 0.2 * 0.01, ecl_sum_get_well_connection_var( resp, 1, "W_2", "COPT", 2, 1, 1 ), 1e-5 );
 }
 
+BOOST_AUTO_TEST_CASE(serial_and_parallel_evaluation)
+{
+    setup cfg( "serial_and_parallel_evaluation" );
+
+    std::map<std::string, std::vector<double>> region_values;
+    {
+        std::vector<double> values(10, 0.0);
+        for (std::size_t r = 1; r <= 10; ++r) {
+            values[r - 1] = r * 1.0;
+        }
+        region_values["RPR"] = values;
+    }
+
+    const auto start = TimeService::now();
+    const auto undefined = cfg.es.runspec().udqParams().undefinedValue();
+
+    auto evalSummary = [&cfg, &region_values, start, undefined]
+        (const std::string& case_name)
+    {
+        out::Summary writer(cfg.config, cfg.es, cfg.grid, cfg.schedule, case_name);
+        SummaryState st(start, undefined);
+
+        for (int step = 0; step < 3; ++step) {
+            writer.eval(st, step, step*day, cfg.wells, cfg.wbp, cfg.grp_nwrk,
+                        {}, {}, {}, region_values);
+            writer.add_timestep(st, step, false);
+        }
+
+        writer.write();
+
+        return st;
+    };
+
+#ifdef _OPENMP
+    const auto maxThreads = omp_get_max_threads();
+    omp_set_num_threads(1);
+#endif // _OPENMP
+
+    const auto serial = evalSummary("SERIAL");
+
+#ifdef _OPENMP
+    omp_set_num_threads(4);
+#endif // _OPENMP
+
+    const auto parallel = evalSummary("PARALLEL");
+
+#ifdef _OPENMP
+    omp_set_num_threads(maxThreads);
+#endif // _OPENMP
+
+    BOOST_CHECK_MESSAGE(serial == parallel,
+                        "Summary state must not depend on the number of threads");
+
+    const auto serialSmry = readsum("SERIAL");
+    const auto parallelSmry = readsum("PARALLEL");
+
+    const auto& keys = serialSmry->keywordList();
+    BOOST_CHECK_EQUAL_COLLECTIONS(keys.begin(), keys.end(),
+                                  parallelSmry->keywordList().begin(),
+                                  parallelSmry->keywordList().end());
+
+    for (const auto& key : keys) {
+        const auto& expect = serialSmry->get(key);
+        const auto& actual = parallelSmry->get(key);
+
+        BOOST_CHECK_MESSAGE(actual == expect,
+                            "Summary vector " << key << " must not depend on the number of threads");
+    }
+}
+
 BOOST_AUTO_TEST_CASE(Test_SummaryState) {
     Opm::SummaryState st(TimeService::now(), 0.0);
     st.update("WWCT:OP_2", 100);
@@ -2944,6 +3018,54 @@ BOOST_AUTO_TEST_CASE(Test_SummaryState) {
     BOOST_CHECK_EQUAL(st.get_conn_var("OP2", "COPR", 101, 99), 99);
 }
 
+BOOST_AUTO_TEST_CASE(Test_SummaryState_Multiple_Entities) {
+    Opm::SummaryState st(TimeService::now(), -1.0e20);
+    st.update_well_var("OP1", "WOPR", 100.0);
+    st.update_well_var("OP2", "WOPR", 200.0);
+    st.update_well_var("OP3", "WWPR", 300.0);
+    st.update_well_var("OP2", "WUBHP", 12.0);
+    st.update_group_var("G1", "GOPR", 10.0);
+    st.update_group_var("G2", "GUOPR", 20.0);
+
+    const auto wells = std::vector<std::string> { "OP2", "OP1", "OP3", "OP99" };
+
+    {
+        const auto wopr = st.get_well_vars("WOPR", wells, -1.0);
+        const auto expect = std::vector<double> { 200.0, 100.0, -1.0, -1.0 };
+        BOOST_CHECK_EQUAL_COLLECTIONS(wopr.begin(), wopr.end(), expect.begin(), expect.end());
+    }
+
+    {
+        const auto wgpr = st.get_well_vars("WGPR", wells, -1.0);
+        const auto expect = std::vector<double>(wells.size(), -1.0);
+        BOOST_CHECK_EQUAL_COLLECTIONS(wgpr.begin(), wgpr.end(), expect.begin(), expect.end());
+    }
+
+    // Missing UDQ values are reported as undefined, as in get_well_var().
+    {
+        const auto wubhp = st.get_well_vars("WUBHP", wells, -1.0);
+        for (std::size_t i = 0; i < wells.size(); ++i) {
+            BOOST_CHECK_EQUAL(wubhp[i], st.get_well_var(wells[i], "WUBHP", -1.0));
+        }
+        BOOST_CHECK_EQUAL(wubhp[0], 12.0);
+        BOOST_CHECK_EQUAL(wubhp[1], -1.0e20);
+    }
+
+    {
+        const auto groups = std::vector<std::string> { "G2", "G1" };
+
+        const auto gopr = st.get_group_vars("GOPR", groups, -1.0);
+        BOOST_CHECK_EQUAL(gopr[0], -1.0);
+        BOOST_CHECK_EQUAL(gopr[1], 10.0);
+
+        const auto guopr = st.get_group_vars("GUOPR", groups, -1.0);
+        BOOST_CHECK_EQUAL(guopr[0], 20.0);
+        BOOST_CHECK_EQUAL(guopr[1], -1.0e20);
+    }
+
+    BOOST_CHECK(st.get_well_vars("WOPR", {}, -1.0).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Summary
 
 // ####################################################################
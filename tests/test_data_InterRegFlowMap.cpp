@@ -23,6 +23,10 @@
 
 #include <opm/output/data/InterRegFlowMap.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
 #include <optional>
 #include <stdexcept>
 #include <utility>
@@ -975,4 +979,145 @@ BOOST_AUTO_TEST_CASE(LinearBuffer_ManyReadWrite)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Parallel_Build)
+{
+    using Component = Opm::data::InterRegFlowMap::ReadOnlyWindow::Component;
+
+    auto flowMap = Opm::data::InterRegFlowMap{};
+
+    const auto numConns = 1000;
+
+#pragma omp parallel for
+    for (int conn = 0; conn < numConns; ++conn) {
+        if (conn % 2 == 0) {
+            flowMap.addConnection(0, 1, conn_1());
+        }
+        else {
+            flowMap.addConnection(2, 1, conn_2());
+        }
+    }
+
+    flowMap.compress(3);
+
+    BOOST_CHECK_EQUAL(flowMap.numRegions(), 3);
+
+    {
+        auto flows = flowMap.getInterRegFlows(0, 1);
+        BOOST_REQUIRE_MESSAGE(flows.has_value(),
+                              "Registered region pair must have a value");
+
+        const auto& [ iregFlow, sign ] = flows.value();
+        BOOST_CHECK_EQUAL(sign, 1.0);
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Oil), 500 * 1.0, 5.0e-3);
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Vapoil), 500 * 5.0, 5.0e-3);
+    }
+
+    {
+        auto flows = flowMap.getInterRegFlows(1, 2);
+        BOOST_REQUIRE_MESSAGE(flows.has_value(),
+                              "Registered region pair must have a value");
+
+        const auto& [ iregFlow, sign ] = flows.value();
+        BOOST_CHECK_EQUAL(sign, 1.0);
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Oil), -500 * 0.1, 5.0e-3);
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Water), -500 * 0.3, 5.0e-3);
+    }
+}
+
+#ifdef _OPENMP
+BOOST_AUTO_TEST_CASE(Parallel_Build_More_Threads)
+{
+    using Component = Opm::data::InterRegFlowMap::ReadOnlyWindow::Component;
+
+    const auto maxThreads = omp_get_max_threads();
+
+    // Thread buffers follow the number of threads at the time of clear().
+    omp_set_num_threads(1);
+    auto flowMap = Opm::data::InterRegFlowMap{};
+    omp_set_num_threads(4);
+    flowMap.clear();
+
+    const auto numConns = 1000;
+
+#pragma omp parallel for num_threads(4)
+    for (int conn = 0; conn < numConns; ++conn) {
+        flowMap.addConnection(0, 1, conn_1());
+    }
+
+    flowMap.compress(2);
+    omp_set_num_threads(maxThreads);
+
+    auto flows = flowMap.getInterRegFlows(0, 1);
+    BOOST_REQUIRE_MESSAGE(flows.has_value(),
+                          "Registered region pair must have a value");
+
+    const auto& [ iregFlow, sign ] = flows.value();
+    BOOST_CHECK_CLOSE(iregFlow.flow(Component::Oil), numConns * 1.0, 5.0e-3);
+}
+#endif // _OPENMP
+
+BOOST_AUTO_TEST_CASE(Incremental_Update)
+{
+    using Component = Opm::data::InterRegFlowMap::ReadOnlyWindow::Component;
+
+    auto flowMap = Opm::data::InterRegFlowMap{};
+    flowMap.addConnection(0, 1, conn_1());
+    flowMap.addConnection(1, 2, conn_2());
+    flowMap.compress(3);
+
+    // Same topology, new rates.
+    flowMap.resetRates();
+    flowMap.addConnection(0, 1, conn_2());
+    flowMap.addConnection(1, 0, conn_3());
+    flowMap.compress(3);
+
+    BOOST_CHECK_EQUAL(flowMap.numRegions(), 3);
+
+    {
+        auto flows = flowMap.getInterRegFlows(0, 1);
+        BOOST_REQUIRE_MESSAGE(flows.has_value(),
+                              "Registered region pair must have a value");
+
+        const auto& [ iregFlow, sign ] = flows.value();
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Oil), 0.1 + 0.2, 1.0e-5);
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Gas), 0.2 + 0.4, 1.0e-5);
+    }
+
+    {
+        auto flows = flowMap.getInterRegFlows(1, 2);
+        BOOST_REQUIRE_MESSAGE(flows.has_value(),
+                              "Known region pair must retain its value");
+
+        const auto& [ iregFlow, sign ] = flows.value();
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Oil), 0.0, 1.0e-6);
+    }
+
+    // New region pair.  Structure must be rebuilt.
+    flowMap.resetRates();
+    flowMap.addConnection(0, 1, conn_1());
+    flowMap.addConnection(0, 3, conn_2());
+    flowMap.compress(4);
+
+    BOOST_CHECK_EQUAL(flowMap.numRegions(), 4);
+
+    {
+        auto flows = flowMap.getInterRegFlows(0, 1);
+        BOOST_REQUIRE_MESSAGE(flows.has_value(),
+                              "Registered region pair must have a value");
+
+        const auto& [ iregFlow, sign ] = flows.value();
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Oil), 1.0, 1.0e-6);
+    }
+
+    {
+        auto flows = flowMap.getInterRegFlows(3, 0);
+        BOOST_REQUIRE_MESSAGE(flows.has_value(),
+                              "New region pair must have a value");
+
+        const auto& [ iregFlow, sign ] = flows.value();
+        BOOST_CHECK_EQUAL(sign, -1.0);
+        BOOST_CHECK_CLOSE(iregFlow.flow(Component::Oil), 0.1, 1.0e-5);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // InterRegMap
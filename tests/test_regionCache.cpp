@@ -96,6 +96,28 @@ BOOST_AUTO_TEST_CASE(create)
     BOOST_CHECK( cmp_list(regCache.wells("FIPNUM", 11), {"W_6"}));
 }
 
+BOOST_AUTO_TEST_CASE(UpdateKnownConnections)
+{
+    const auto  deck     = summaryDeck();
+    const auto  es       = Opm::EclipseState { deck };
+    const auto  schedule = Opm::Schedule { deck, es, std::make_shared<Opm::Python>() };
+    const auto& grid     = es.getInputGrid();
+
+    auto regCache = Opm::out::RegionCache {
+        {"FIPNUM"}, es.fieldProps(), grid, schedule
+    };
+
+    // Connections already in the cache must not be added again.
+    for (auto step = 0*schedule.size(); step < schedule.size(); ++step) {
+        regCache.updateCache(es.fieldProps(), grid, schedule, step);
+    }
+
+    BOOST_CHECK_EQUAL( regCache.connections("FIPNUM", 1).size(), 4U );
+    BOOST_CHECK_EQUAL( regCache.connections("FIPNUM", 4).size(), 0U );
+    BOOST_CHECK( cmp_list(regCache.wells("FIPNUM", 1),  {"W_1", "W_2", "W_3", "W_4"}));
+    BOOST_CHECK( cmp_list(regCache.wells("FIPNUM", 11), {"W_6"}));
+}
+
 BOOST_AUTO_TEST_CASE(InactiveLayers)
 {
     const auto deck = Opm::Parser{}.parseString(R"(RUNSPEC